@@ -0,0 +1,43 @@
+/*
+ F4LAA : CW Decoder, trous entre 2 acquisitions
+
+   L'acquisition s'arrête pendant le reste de loop() (Goertzel, décodage, TFT, Serial) : cette partie
+   de l'audio n'est jamais échantillonnée. Pour chaque bloc : début et fin de l'acquisition (us),
+   le trou est le temps depuis la fin du bloc précédent.
+   Toutes les secondes (window()) : taux d'échantillonnage (temps acquis / temps écoulé), trou max,
+   et dépassements : trous plus longs que maxGap (un quart de point au WPM courant : au-delà,
+   un élément court peut être raccourci ou perdu).
+*/
+#ifndef AcqMonitor_h
+#define AcqMonitor_h
+
+#include <stdint.h>
+
+class AcqMonitor
+{
+  public:
+    void block(uint32_t start, uint32_t end);
+    void window(); // Results of the last window, then a new one
+
+    // maxGap for a WPM : a quarter of a dot
+    static uint32_t gapForWpm(int wpm) { return 1200000UL / ((wpm > 0) ? wpm : 20) / 4; }
+
+    uint32_t maxGap = gapForWpm(20); // us
+
+    // Last window
+    uint16_t dutyPermil = 1000; // Sampled time / elapsed time
+    uint32_t gapMax = 0;        // us
+    uint32_t overruns = 0;
+
+    uint32_t totalOverruns = 0; // Since boot
+
+  private:
+    bool started = false;
+    uint32_t lastEnd = 0;
+    uint32_t sampled = 0; // us in the window
+    uint32_t gaps = 0;
+    uint32_t wGapMax = 0;
+    uint32_t wOverruns = 0;
+};
+
+#endif
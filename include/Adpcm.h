@@ -0,0 +1,26 @@
+/*
+ F4LAA : CW Decoder, compression IMA-ADPCM (4 bits par échantillon) des échantillons de l'ADC
+
+   12 bits à ~11500 samp/s ne passent pas à 115200 bauds ; en ADPCM : ~46 kbit/s.
+   Chaque bloc commence par l'état du codeur (prédiction, index du pas) : un bloc perdu
+   n'empêche pas de décoder les suivants.
+   Deux codes par octet, le premier échantillon dans les 4 bits de poids faible.
+*/
+#ifndef Adpcm_h
+#define Adpcm_h
+
+#include <stdint.h>
+
+struct AdpcmState
+{
+  int16_t predictor = 0;
+  uint8_t index = 0; // In the step table : 0..88
+};
+
+// n samples (16 bits) ==> (n + 1) / 2 bytes, state updated
+void adpcmEncode(AdpcmState &state, const int16_t *in, int n, uint8_t *out);
+
+// (n + 1) / 2 bytes ==> n samples, state updated
+void adpcmDecode(AdpcmState &state, const uint8_t *in, int n, int16_t *out);
+
+#endif
@@ -0,0 +1,180 @@
+/*
+ F4LAA : CW Decoder, étage de décision
+
+   Extrait de main.cpp pour pouvoir aussi être compilé sur PC (voir tools/) :
+   magnitude Goertzel de chaque bloc ==> état HIGH / LOW (noise blanker) ==> . et - ==> caractères
+
+   Ce code ne dépend pas d'Arduino : l'heure (ms) est passée à process(),
+   et les caractères décodés sont rangés dans decoded[] au lieu d'être affichés.
+
+   Deux modèles de temps :
+     TIMING_G6EJD    : l'algo d'origine, tout est calculé à partir de hightimesavg (timing standard 1:3:7). Par défaut.
+     TIMING_ADAPTIVE : moyennes séparées des dots, dashes, silences entre éléments, entre caractères et entre mots.
+                       Le rapport dash/dot (pondération) et les espacements (Farnsworth) sont mesurés au lieu d'être supposés.
+                       Choisi par le paramètre model ('M') ou un préréglage : il démarre mal à vitesse lente (balise 8 WPM).
+
+   Confiance de chaque caractère (0..100) : produit de
+     - la plus petite marge de ses éléments et silences par rapport aux seuils . / - et lettre / mot
+       (0 sur le seuil, 100 à partir de la moyenne de la classe),
+     - le SNR du plus faible de ses éléments : magnitude moyenne du HIGH / magnitude moyenne des LOW.
+
+   Les échéances (noise blanker, fin de caractère) sont programmées sur une roue de temporisations
+   (timers, voir TimerWheel.h) avancée par process() : rien n'est recalculé à chaque bloc.
+   loop() y programme aussi les siennes.
+*/
+#ifndef CWDecoder_h
+#define CWDecoder_h
+
+#include <stdint.h>
+#include "TimerWheel.h"
+
+class EventTrace;
+
+#define MAXTIMES 11 // Stockage des temps : High & Silent pour chaque caractère décodé
+#define bufSize 8   // 6 . ou - + 1 en trop (avant sécurité) + \0
+#define MAXDECODED 4
+
+#define TIMING_G6EJD 0
+#define TIMING_ADAPTIVE 1
+
+struct DecodedChar
+{
+  char c;              // ' ' for a word space
+  int times[MAXTIMES]; // Dot / dash and silent durations (ms) of the character, for the DataSet
+  uint8_t confidence;  // 0..100 : timing margins (and SNR for a character)
+  // Elements, for a re-decoding (WordCorrector)
+  char code[bufSize];            // . and -
+  uint8_t elemMargins[bufSize];  // 0..100 : margin of each element to the dot / dash limit
+  uint8_t gapMargins[bufSize];   // 0..100 : margin of the space after each element to the letter space limit
+};
+
+// The whole decoder state, fixed layout (same on the ESP32 and on PC) : keyframe of a capture (MagCapture)
+struct CWDecoderState
+{
+  int32_t nbTime, spaceDetector, magReactivity, model;
+  int32_t magnitudelimit, magnitudelimit_low, realstate, realstatebefore, filteredstate, filteredstatebefore;
+  uint32_t laststarttime;
+  int32_t starttimehigh, highduration, starttimelow, lowduration;
+  float hightimesavg;
+  int32_t stop, wpm;
+  char CodeBuffer[bufSize];
+  uint8_t elemMargins[bufSize];
+  uint8_t gapMargins[bufSize];
+  int32_t bufLen, iTimes, dTimes[MAXTIMES];
+  float dotAvg, dashAvg, elemGapAvg, charGapAvg, wordGapAvg;
+  float noiseAvg, charMargin, charMarkMag;
+  int32_t nbMarks, nbShort, nbLong, gapStart;
+  float markMagSum;
+  int32_t markMagCnt;
+  uint8_t stable, endOfCharDue, blankerPending, endOfCharPending;
+  uint32_t now, blankerExpires, endOfCharExpires;
+};
+
+class CWDecoder
+{
+  public:
+    CWDecoder();
+
+    // One block : magnitude measured by Goertzel, now in ms.
+    // When decode is false (frequency scan), only the states are updated.
+    void process(float magnitude, unsigned long now, bool decode = true);
+
+    static char toChar(const char *code); // '{' when unknown
+
+    void clearCodeBuffer();
+    void resetTiming(); // Forget the current element (frequency changed)
+    void warmStart(int lastWpm, int limit); // Warm boot : speed and threshold of the last session
+
+    // Snapshot of the decision stage. restore() restarts timers : the timers of loop() are lost
+    void save(CWDecoderState &s) const;
+    void restore(const CWDecoderState &s);
+
+    // Adaptive timing model measurements
+    float dashDotRatio() const { return dashAvg / dotAvg; }         // 3 for standard timing
+    float charSpaceScale() const { return charGapAvg / dotAvg; }    // 3 for standard timing
+    float wordSpaceScale() const { return wordGapAvg / dotAvg; }    // 7 for standard timing
+    float snr() const;                                               // Weakest element of the current character
+
+    // Parameters
+    int nbTime = 6;  // ms noise blanker
+    int spaceDetector = 5;
+    int magReactivity = 6;
+    int model = TIMING_G6EJD;
+
+    // Deadlines, in ms, advanced by process(). A decoder is copied only when none is pending (a new one)
+    TimerWheel timers;
+
+    // Journal of the decision stage (command 'J'), none when null : each decoder its own (host tools in parallel)
+    EventTrace *events = 0;
+
+    // Characters decoded by the last process()
+    int nbDecoded = 0;
+    DecodedChar decoded[MAXDECODED];
+
+    // Variables G6EJD
+    int   magnitudelimit      = 100;
+    int   magnitudelimit_low  = 100;
+    int   realstate           = 0;
+    int   realstatebefore     = 0;
+    int   filteredstate       = 0;
+    int   filteredstatebefore = 0;
+    unsigned long laststarttime = 0;
+    long  starttimehigh       = 0;
+    long  highduration        = 0;
+    long  starttimelow        = 0;
+    long  lowduration         = 0;
+    float hightimesavg        = 0; // Séparation dot / dash et SP
+    int   stop                = 0;
+    int   wpm                 = 0;
+
+    char CodeBuffer[bufSize];
+    uint8_t elemMargins[bufSize];
+    uint8_t gapMargins[bufSize];
+    int bufLen = 0;
+    int iTimes = -1;
+    int dTimes[MAXTIMES];
+
+    // Adaptive timing model (ms)
+    float dotAvg = 0;
+    float dashAvg = 0;
+    float elemGapAvg = 0;
+    float charGapAvg = 0;
+    float wordGapAvg = 0;
+
+    // Confidence
+    float noiseAvg = 0;       // Magnitude while LOW
+    float charMargin = 1;     // Smallest timing margin of the current character [0..1]
+    float charMarkMag = 0;    // Weakest element of the current character
+
+  private:
+    void addTime(int t);
+    void addElement(char element, int duration, float margin);
+    void setGapMargin(float m);
+    void emit(char c, float margin);
+    void CodeToChar();
+    void addMargin(float m) { if (m < charMargin) charMargin = m; }
+
+    void classicMark();
+    void classicSpace();
+    void adaptiveMark();
+    void adaptiveSpace();
+    void rescale(float dot);
+    void reclassify();
+    void scheduleEndOfChar(unsigned long now);
+    static void onBlanker(void *ctx);
+    static void onEndOfChar(void *ctx);
+
+    Timer blanker;
+    Timer endOfChar;
+    bool stable = true;       // No state change for nbTime ms
+    bool endOfCharDue = false;
+
+    int nbMarks = 0;
+    int nbShort = 0;
+    int nbLong = 0;
+    long gapStart = 0;
+    float markMagSum = 0;
+    int markMagCnt = 0;
+};
+
+#endif
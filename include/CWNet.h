@@ -0,0 +1,84 @@
+/*
+ F4LAA : CW Decoder, décodeur neuronal de l'enveloppe (GRU + CTC)
+
+   Au lieu des 11 durées de dTimes (après le seuil et le noise blanker), le réseau lit directement
+   la magnitude Goertzel de chaque bloc :
+     features (magnitude / crête, log, durée du bloc) ==> GRU ==> classes (blank CTC, espace, caractères)
+   et émet un caractère quand la classe la plus probable change et n'est pas blank (décodage CTC glouton).
+
+   Les poids sont appris sur PC par tools/cwnet (audio synthétique) qui génère include/CWNetWeights.h.
+   Inférence en virgule fixe, sans allocation : entrées et état en Q7 pour les produits int8 x int8,
+   préactivations en Q10, sigmoïde et tanh par table, état en Q15.
+*/
+#ifndef CWNet_h
+#define CWNet_h
+
+#include <math.h>
+#include <stdint.h>
+
+#define CWNET_INPUTS 3
+#define CWNET_HIDDEN 32
+#define CWNET_GATES (3 * CWNET_HIDDEN) // z, r, n
+#define CWNET_ALPHABET "_ abcdefghijklmnopqrstuvwxyz0123456789?.,/" // '_' : CTC blank
+#define CWNET_CLASSES 42
+
+#define CWNET_PEAKDECAY 0.995 // Per block : the peak follows the signal level (QSB) in ~2s
+#define CWNET_LUTBITS 10      // Sigmoid / tanh tables : [-8..8[ by steps of 1/64
+
+// Features of a block : the trainer (float) and the engine use the same ones
+struct CWNetFeatures
+{
+  float peak = 0;
+
+  void compute(float magnitude, float dtMs, float x[CWNET_INPUTS])
+  {
+    peak *= CWNET_PEAKDECAY;
+    if (magnitude > peak)
+      peak = magnitude;
+    float m = (peak > 0) ? magnitude / peak : 0;
+    x[0] = m;
+    x[1] = (m > 0.02) ? 1 + log(m) / 4 : 0; // 0 at -34 dB of the peak
+    x[2] = dtMs / 20;
+    for (int i = 0; i < CWNET_INPUTS; i++)
+      x[i] = (x[i] < 0) ? 0 : ((x[i] > 1) ? 1 : x[i]);
+  }
+};
+
+// Quantized weights (include/CWNetWeights.h, or built by the trainer)
+// Rows : z, r, n. Row scale : pre (Q10) = (sum(w * input Q7) * mul) >> 16, + bias (Q10)
+struct CWNetModel
+{
+  const int8_t *wx;   // [CWNET_GATES][CWNET_INPUTS]
+  const int32_t *mx;
+  const int32_t *bx;
+  const int8_t *wh;   // [CWNET_GATES][CWNET_HIDDEN]
+  const int32_t *mh;
+  const int32_t *bh;
+  const int8_t *wo;   // [CWNET_CLASSES][CWNET_HIDDEN]
+  const int32_t *mo;
+  const int32_t *bo;
+};
+
+extern const CWNetModel cwnetModel;
+
+class CWNet
+{
+  public:
+    explicit CWNet(const CWNetModel &m = cwnetModel) : model(m) { reset(); }
+
+    void reset();
+
+    // One block : the decoded character (0 when none) and its confidence (0..100)
+    char process(float magnitude, float dtMs);
+    uint8_t confidence = 0;
+
+    static char classChar(int c) { return CWNET_ALPHABET[c]; }
+
+  private:
+    const CWNetModel &model;
+    CWNetFeatures features;
+    int16_t h[CWNET_HIDDEN];  // Q15
+    int lastClass;
+};
+
+#endif
@@ -0,0 +1,335 @@
+/*
+ F4LAA : Poids du décodeur neuronal (CWNet)
+
+   Généré par tools/cwnet : ne pas modifier.
+   4704 paramètres int8, 300000 séquences d'apprentissage, CER de validation 17.3% (float) / 18.2% (int8)
+*/
+#ifndef CWNetWeights_h
+#define CWNetWeights_h
+
+#include "CWNet.h"
+
+static const int8_t cwnetWx[288] = {
+  -127, 15, 124,
+  -127, -70, 42,
+  -16, -22, -127,
+  36, 33, -127,
+  67, 12, -127,
+  59, 48, -127,
+  127, 48, -35,
+  -127, 19, -124,
+  98, -25, -127,
+  51, 0, -127,
+  86, -23, -127,
+  -127, -113, -113,
+  19, 112, -127,
+  -127, -103, -127,
+  -81, 7, -127,
+  -127, 48, -85,
+  127, 5, 25,
+  -21, 28, -127,
+  -73, -39, -127,
+  14, 23, -127,
+  90, -55, -127,
+  62, 20, 127,
+  -74, 16, -127,
+  -127, 90, -116,
+  -50, 3, -127,
+  -127, 23, -121,
+  -127, -2, -88,
+  -127, 24, -48,
+  -127, 43, -124,
+  -85, -3, -127,
+  127, 10, -123,
+  29, -13, -127,
+  127, -28, 26,
+  -127, -43, -44,
+  20, 55, 127,
+  78, 124, -127,
+  -127, -1, 5,
+  -127, -44, 42,
+  29, 28, 127,
+  -93, 12, 127,
+  -127, -44, 55,
+  127, -12, -37,
+  -127, -88, -9,
+  -127, 11, -38,
+  127, 81, 69,
+  116, -20, 127,
+  -127, -31, 23,
+  75, -5, -127,
+  -127, 7, -25,
+  -127, 12, 62,
+  106, 127, 23,
+  20, -25, 127,
+  127, 9, -10,
+  127, 103, -8,
+  -127, -43, 49,
+  -127, -49, 27,
+  -15, -127, 14,
+  -127, 7, -9,
+  127, -47, -105,
+  -127, -86, 18,
+  109, -57, -127,
+  62, -62, -127,
+  127, -9, -60,
+  53, -97, -127,
+  127, -26, -32,
+  -127, 24, 72,
+  59, 52, 127,
+  -43, 52, 127,
+  127, -24, 17,
+  127, -59, -54,
+  -127, 0, -31,
+  -127, 38, 63,
+  127, 17, -16,
+  127, -39, 43,
+  127, 52, 6,
+  -76, 4, -127,
+  16, 98, 127,
+  -127, 18, -67,
+  127, -19, -35,
+  127, -30, -48,
+  -127, 23, -23,
+  -127, 12, 80,
+  127, 121, 36,
+  -43, 127, -63,
+  127, -12, -69,
+  -127, -5, -2,
+  61, -30, 127,
+  -18, 127, 82,
+  -74, -127, 95,
+  -60, -21, 127,
+  6, -20, 127,
+  -127, 37, -29,
+  127, -38, -6,
+  -127, 57, -12,
+  -127, -56, -115,
+  97, 0, -127
+};
+
+static const int32_t cwnetMx[96] = {
+  3021, 9336, 17536, 3379, 4480, 4270, 7397, 7763,
+  5294, 11659, 5645, 7786, 1362, 5942, 9325, 7783,
+  7356, 8850, 12820, 14141, 2935, 3920, 6284, 6747,
+  8681, 5668, 12025, 4657, 6036, 13498, 5061, 6580,
+  16275, 12837, 8001, 1999, 10407, 6037, 5471, 2384,
+  11535, 8514, 9208, 18224, 8299, 5161, 9227, 3414,
+  18794, 3875, 13594, 4802, 14465, 6752, 2993, 9804,
+  6101, 5501, 6383, 6582, 5204, 4870, 10588, 1009,
+  7091, 4370, 8880, 1480, 10919, 5704, 4343, 6567,
+  13455, 4102, 4352, 6880, 5015, 1321, 9687, 4103,
+  8814, 3296, 23538, 400, 7384, 2648, 1777, 921,
+  2616, 1269, 2485, 3107, 4950, 3465, 980, 3109
+};
+
+static const int32_t cwnetBx[96] = {
+  2014, -726, -3904, -288, 126, 20, 215, 311,
+  296, -940, 235, 90, 364, -1663, 148, 132,
+  734, -349, -3715, -1046, 324, 662, 180, 64,
+  106, 167, -1383, 335, -585, -1839, 458, 120,
+  -388, -255, 1619, 501, -22, 591, 669, 416,
+  478, -349, 151, -87, 834, 652, -550, -419,
+  -78, 250, 638, 1166, -342, 61, 112, 788,
+  589, -46, 303, -134, -820, -787, -361, 50,
+  33, 136, 2119, 602, 48, -685, 71, 89,
+  -39, -520, -49, 824, 707, 990, -241, -143,
+  -437, -180, 1390, 516, -402, -345, -286, 16,
+  163, -80, -475, 297, 9, 223, -423, -299
+};
+
+static const int8_t cwnetWh[3072] = {
+  75, -8, 66, 10, -4, -15, -28, 64, 110, 30, 69, 72, -13, -17, 48, 24, 44, -38, 69, 80, -60, 10, -24, -13, 40, -17, 33, -1, 12, -27, -127, 22,
+  -127, 23, -46, 33, 46, 20, 8, 18, 95, -84, 34, -101, 111, 19, -28, -17, -33, 29, -38, -28, -114, 10, 27, 13, 92, 46, -37, 3, -12, -4, 11, -23,
+  -28, 83, -78, 91, -31, -76, 125, 30, -26, -28, -23, 98, -46, 108, 14, -78, -55, -92, -127, -80, -37, 94, 64, 40, -51, 34, -69, 100, -108, 37, -48, -2,
+  48, -22, 31, 36, 1, 4, -27, -5, 9, 103, 32, 9, 32, 6, 28, 9, -41, 34, 19, 14, 70, -23, -46, 27, 27, -20, 12, 127, 1, 21, -19, 1,
+  127, 70, 2, -22, 68, -3, 41, -8, 49, 81, 70, 27, 32, 32, 117, 2, 18, -74, -3, 11, 32, 14, -112, 6, -61, 60, 79, 12, 4, -108, -112, 18,
+  127, -14, 26, 5, -48, 111, -20, -46, 48, -6, 53, 13, -65, 43, 3, 11, 15, -56, 26, -2, -19, 1, -28, -5, -22, -53, 6, 38, -1, 79, -55, -37,
+  92, 5, -6, -75, 45, 93, -127, -31, -12, -38, -11, -26, -20, 14, 31, -4, 103, -46, 5, -5, -25, 12, -41, 88, -119, -87, 6, 80, -69, 62, 60, -41,
+  127, 0, 31, 14, 15, 27, -4, -10, 64, -27, 57, 43, -62, -14, 14, -24, -21, 26, 19, 7, -32, 14, -3, -13, -45, -53, 17, 19, 6, 17, -71, 19,
+  127, -38, 13, 3, -6, 0, 2, -1, 12, -26, -20, 57, 16, -8, -1, -1, 18, 12, 3, 7, -13, 0, -4, -3, -4, -8, -1, 1, -1, -10, -8, -15,
+  127, 0, 7, 13, -1, 2, -5, -10, -47, 23, -25, 12, -18, -11, 20, 0, 1, 4, 0, -4, 30, 0, -24, -7, 16, -14, 20, 19, 0, -30, 54, -4,
+  127, 8, 30, -3, -8, -16, -20, 34, 25, -29, -25, 105, 34, -12, 5, 3, 26, 33, 38, 24, -6, 6, 9, -22, 2, -28, -12, 8, -8, 25, -66, -10,
+  33, -36, -20, -12, -62, 19, -1, 3, 8, 18, -16, 127, -32, 0, 1, -1, 53, 20, -21, -22, -25, 10, -7, -4, -21, 4, -29, 25, 9, 79, 62, 18,
+  127, 11, 8, -11, 29, 14, -26, -52, -21, 34, -6, 26, 93, -7, 10, 7, -11, 10, 18, 23, 59, -8, -45, -51, 67, -54, 24, -58, 8, 9, 2, 23,
+  20, 52, -10, 127, -60, 20, 3, -12, 18, 6, 30, 37, 108, -48, 56, -29, -24, -82, -2, -68, 69, -28, -26, 36, 7, 6, -42, 28, -80, -60, 39, -36,
+  127, -18, 1, -5, -18, -5, 5, 1, -11, 1, -11, 17, 6, 1, 5, 9, -25, -10, 5, 5, 6, 2, 11, 5, 13, -14, -43, -5, 4, -11, 11, -3,
+  102, -22, 29, -33, -19, -8, -29, -17, 57, -6, 2, -18, -127, 23, 66, -2, -96, 72, 18, 5, 72, 11, -9, 36, 39, -14, -7, 29, -20, 75, 20, -103,
+  86, 4, 6, 34, 14, -63, 43, -7, 54, -35, 120, -30, 127, 7, 51, -13, -31, 94, 14, -12, 74, 22, 29, -50, 9, 106, 25, -21, -3, -12, -90, -14,
+  126, -23, -10, -6, 7, 18, -14, -4, -42, -6, -13, -12, -73, -14, -24, -3, -26, -2, -6, 0, 35, 7, -8, 46, 46, 127, 28, 39, 3, -48, 38, 39,
+  -25, -9, -2, 40, -10, -35, -35, 55, 23, -95, -54, -6, -127, 23, 24, -46, 32, -73, -3, -8, -15, 7, -10, 29, -36, 95, -33, 15, -30, 42, -21, -46,
+  -1, 33, -14, -38, -127, 6, -18, -13, -4, 24, 37, -21, 68, 3, 20, 43, -80, 28, -15, 8, 76, -15, -2, -6, 42, -4, 21, 5, -34, 12, 59, -13,
+  27, -30, 27, 1, -60, 6, 2, 11, 20, 56, 39, -41, 39, -6, 28, 16, 5, 25, 29, 24, 127, -10, 13, -4, 56, -16, 3, 12, -8, -19, -38, -18,
+  43, 4, 22, -10, 6, 1, -6, -11, -13, -12, 8, 45, 127, -5, 9, -12, -45, -23, 16, 13, 43, 24, -43, 49, 26, -10, 28, 26, 4, -5, -10, 3,
+  127, 9, 9, 5, 4, -15, -11, 25, 6, -23, -17, 6, -42, -31, 11, -9, -31, -6, 7, 7, -2, 11, -29, 44, 18, -34, 16, 64, 3, 67, 16, -20,
+  94, 14, 8, -58, -24, -24, 25, -49, -64, -5, -58, 31, -86, 2, -65, -32, -30, 37, 28, 11, -45, 9, 12, 8, 26, 62, -10, -127, -41, 104, 25, -32,
+  127, 3, 27, -1, 1, 10, -1, -1, 13, 32, 7, 37, -21, 1, -8, 3, 11, 16, 21, 5, 33, 0, 16, 5, 11, 22, -7, -3, -6, 0, -55, 2,
+  111, 11, 14, -17, -12, 10, -7, -19, 8, -27, 1, 15, -32, 3, 4, 15, -3, -2, 18, 26, 55, -15, 6, 29, 0, -127, 1, -3, 5, 58, -16, -5,
+  96, 3, 3, 0, -37, -8, 6, 5, -8, 26, -17, -26, 74, 8, -97, -5, 18, 45, 8, 24, 33, -4, -36, -8, 21, -17, 30, -15, 14, 127, 67, -11,
+  86, 1, 41, -4, 5, 23, -10, -29, 13, -22, 10, 23, 44, -13, -13, 17, 18, -19, 23, 29, 13, -10, -11, 18, -10, -127, 2, -15, 19, -4, 12, 43,
+  34, 8, 1, 7, -10, -11, -3, -26, 0, 15, -8, 22, -127, 23, -21, -2, 2, 37, 3, -15, -29, -33, 13, 0, 21, -25, 0, 22, 66, 29, -31, -27,
+  127, -3, -7, 39, 9, -2, -6, -21, -27, -8, -16, 10, 46, -14, -3, 12, 6, 61, -5, 25, 27, -13, 0, 26, 6, 63, -1, 31, 15, 59, -6, 42,
+  127, 3, -30, 2, 23, -5, -26, 2, 28, 25, -15, 65, 3, 0, 7, -4, -55, -4, -38, -29, -41, -5, -13, 3, -20, 18, -16, -5, -5, 11, -10, 8,
+  127, 14, -3, 9, 0, 8, -1, -39, 10, -4, -6, 11, 31, -9, -8, 3, -24, -21, 7, -7, 10, -11, -19, 13, 1, -23, -2, -14, -9, -52, -4, 2,
+  108, 1, -20, -25, -26, -10, 4, 29, -30, -2, -1, -1, -64, 17, -43, -3, 26, 115, -17, -24, 127, -14, -90, 7, -18, 1, 5, -13, 0, -29, -48, -53,
+  25, 105, -8, 29, -60, 21, 15, 47, -127, -24, -95, 41, -113, -14, -75, 17, 90, -23, -21, -22, 5, 17, 6, 1, -90, 26, -6, 81, 7, -2, 13, -53,
+  114, 12, 127, -37, 27, -28, -10, 47, -44, 8, -3, 78, 29, -65, 18, 43, 10, 9, 120, 107, 30, -67, -79, -6, -19, 14, 32, 46, 29, 1, -55, 15,
+  -43, -18, 6, -37, -1, -15, 21, 25, -94, 41, -78, -11, -36, -66, -9, -2, 83, 17, 14, 12, -20, -3, -30, 23, 12, -21, 31, 5, -7, -58, -127, 12,
+  -83, 45, -1, -1, -127, -1, -17, -3, -64, 1, 34, 37, 20, -5, -79, 6, 68, 44, -3, -4, 26, 19, -18, -26, 94, -9, 48, -1, 21, -6, -55, 10,
+  34, 10, 25, -103, 76, -48, -7, 112, 50, -20, 9, -39, -80, -19, 95, 23, 71, 41, 37, 34, -17, -18, -116, 20, -127, -68, -14, 30, 22, 110, 53, 72,
+  85, 11, 46, 126, 50, 36, 28, -22, 107, 120, -81, 3, 42, -42, 12, 48, -68, -43, 44, 36, 117, -42, -13, 25, 122, -127, 44, -29, 25, -82, 61, -75,
+  16, 24, 11, -11, 49, -9, -3, 43, 16, -27, 2, 23, -127, 0, 1, 13, 11, 1, 17, 12, 55, 8, -12, 2, -25, 3, -2, 1, 1, 5, -3, -27,
+  -127, 11, 25, 1, -46, 9, -6, -9, -59, -50, 29, 96, -15, 1, -116, 14, 65, 1, 16, 26, 24, -5, -9, -2, -7, -20, 17, -2, 0, 41, -46, -27,
+  6, -14, -25, 7, -127, 13, 37, -79, -3, -12, 85, -26, -102, 28, -12, 6, -104, 16, -28, -30, 0, -6, 3, 12, 19, 118, -45, 12, -6, 110, 16, -12,
+  102, 15, 13, 1, -21, -4, -2, 15, -89, 33, -9, 91, 16, 7, -98, 11, 8, -44, 13, 2, 93, 11, 32, 2, -40, 45, 15, 28, 6, -127, 37, 24,
+  127, 24, -5, 10, 8, -36, 20, 38, 17, -21, -23, -72, 14, 8, -49, -13, 7, 25, -11, -10, -51, 8, 14, -5, -17, 7, -21, 0, -12, 36, 24, -1,
+  -96, -47, 14, -27, 39, -23, 41, 83, -44, 14, -69, -127, -82, -15, 107, 10, 43, -82, 15, 1, 33, -7, 20, 23, -114, 64, 39, 0, 2, -84, 78, 24,
+  -72, 18, 9, 14, -69, 0, 8, 8, -33, 29, 27, -11, 70, -13, -27, 4, -14, -29, 16, 8, 52, 6, 34, -54, 110, 64, 1, -127, 12, -30, -14, -39,
+  127, -32, -33, -2, -90, -41, 0, 48, -75, -5, -92, -34, 35, 31, -94, -28, 124, -61, -32, -22, -66, 22, 30, 32, -85, -3, -23, 17, -7, -44, 103, 14,
+  -2, 31, -7, -28, 24, 36, -8, 20, -17, -25, -39, -18, 20, 4, 7, -9, 24, -40, -2, 14, -39, -19, 18, 29, -34, -23, 21, 54, 127, 14, -1, -16,
+  -7, 56, -7, 48, -79, 42, 7, 46, -91, -3, -119, 127, 0, 38, -27, -21, 36, -20, 4, -10, -109, 6, -26, 4, -76, 69, -26, -26, -5, 78, 30, -84,
+  40, 13, 1, 18, 42, 3, -8, 6, 2, 16, -43, 48, -36, -2, -32, -8, -11, 25, 5, 2, -43, 15, 4, 0, 62, 127, -10, 30, 3, 30, -55, 42,
+  -9, 16, -2, 13, 5, -18, -5, -10, 46, 21, 113, -58, 40, -11, 106, 16, -88, 75, 6, -21, 47, 11, -127, 8, 83, 39, -3, -14, -62, -67, 12, -25,
+  24, -36, 60, -109, 56, -3, 74, 0, 2, -44, -17, -37, -77, 36, -17, 69, 54, -4, 66, 25, 21, 48, 92, -64, 127, -4, 51, -79, 31, -42, 103, -16,
+  87, 19, -19, 21, 17, -8, 10, 6, -9, 36, -10, -108, 127, 41, 35, -12, 1, -8, -24, -18, -9, 15, 20, 13, 10, -37, 11, -52, -5, -127, -38, 30,
+  127, 12, 14, 9, 39, -17, -18, 52, 17, 36, 17, 33, 1, -7, 68, 29, 14, -5, 14, 16, 88, -15, -25, -29, -54, -77, -4, -3, -27, 21, 91, 32,
+  127, 32, 3, -17, -47, -6, -45, 9, 35, 46, -21, 93, 93, -38, -87, 4, 23, -21, 13, 15, 57, -37, 40, -2, 92, -91, 20, -96, 6, -67, 56, -17,
+  -18, 7, 22, -18, 4, -18, -23, 4, -32, -16, -14, 8, -127, -6, -30, 9, 14, 44, 24, 29, -31, 8, 40, -24, 8, -79, 5, -6, 13, 26, -10, 107,
+  -24, 27, 13, 16, 59, 10, -32, 4, 37, 39, 18, 2, -53, -1, 58, 34, -12, 69, 27, 37, 69, -16, -45, 18, 9, -14, 35, -21, 22, -127, 52, -1,
+  4, -22, -11, 5, -13, 43, -5, -31, 5, 43, -42, -32, 127, -16, -65, -3, -21, 22, -14, -5, 90, -20, -15, -44, 41, -91, 31, -36, 18, 9, -52, -19,
+  -15, -34, 4, -4, -81, -38, -20, 28, -73, 88, -93, -11, 69, 1, -127, -47, -33, -26, -4, 12, 68, -18, -26, 60, 76, -12, 55, 9, -24, -8, 40, -72,
+  -6, -43, -7, -65, 58, 60, 11, 58, 7, 83, 38, -15, 39, -20, -21, 67, -125, 43, 0, 51, 8, -48, -91, -17, 127, -81, -23, 15, 18, 16, 31, 109,
+  35, -11, 16, -14, 68, -22, 14, 1, 2, 49, -17, -27, -119, -6, -12, -11, -47, -18, 12, 47, -53, -62, -11, 22, -21, -50, 18, 127, 29, 10, 29, 72,
+  -96, 13, -25, 20, -9, -11, -8, 43, -59, 12, -127, 60, -44, -24, -32, -17, 23, -60, -37, -31, -100, 16, 16, 14, -14, 44, 23, 42, -18, -16, -13, 19,
+  23, -16, -32, 23, 44, 8, 10, -102, 81, 121, 99, 32, -14, -4, 83, 63, -10, 127, -15, -21, 118, -46, -20, -42, 34, -99, 1, -47, 13, 31, 15, 48,
+  -13, -16, 3, -7, -60, -40, 9, 30, 6, 16, -17, -3, 8, -12, -33, -18, 18, -17, 1, 3, -39, 0, 41, 25, -29, 127, 2, -14, -10, 8, 42, -36,
+  32, -27, -13, -33, 18, -5, 6, -18, 12, 49, -16, -79, -87, -21, 27, -21, -67, 61, -9, -13, 127, -15, -5, 2, 60, -33, 10, -42, 3, -29, 34, -2,
+  30, 1, 4, -9, 47, 29, -5, 50, -16, -86, -11, 33, 127, -18, 91, -10, -22, 11, -3, -7, 15, -6, 5, -46, -54, 92, -10, 55, -3, -38, 9, 0,
+  127, 19, 112, -32, 12, 5, -37, 17, -46, -12, -3, 84, -23, -16, 5, 26, -23, -48, 106, 104, 30, -38, -47, -3, -45, 31, 29, 45, -13, -18, -44, 7,
+  31, 46, -12, 123, -7, -14, -25, -6, 13, -26, 31, 79, 127, 32, -44, 6, -48, 38, -1, -8, 61, -6, 22, 36, 26, 61, -1, -81, -52, 41, 37, -22,
+  -89, 6, -20, 35, -16, -21, 30, 37, -31, 54, 0, -7, -127, 8, 60, -5, 22, 37, -12, -13, -93, 19, -24, -5, -80, 29, -23, 68, -12, -85, 11, -27,
+  0, -70, 35, -19, 36, 38, -24, -7, 36, -4, 43, -25, -75, 2, -16, 18, -40, -58, 51, 55, -31, 2, 23, 24, -34, -127, 24, 1, 7, -31, -11, -34,
+  -12, 30, -39, 17, 55, -41, 54, 17, -61, 25, -46, 36, 6, 30, -74, -14, -27, 33, -51, -41, -17, -12, 32, 30, -127, 59, -39, 56, -11, 18, -18, 78,
+  50, 9, -12, -8, -53, -34, 20, 38, -42, -31, -44, 102, 127, 38, -49, 14, 33, -53, -19, -23, 25, -8, 5, 45, -69, -8, 0, 93, -9, -91, 18, -5,
+  -39, -28, -40, 37, 63, -43, 31, 87, 21, 127, -60, -95, -20, 56, 98, -30, 11, 59, -35, -43, -5, -11, -67, 22, -42, -48, -35, -12, -13, 13, 124, -57,
+  11, -33, -9, 16, -44, 11, 10, -3, 44, 29, -21, -11, 32, -20, -127, 3, -37, 49, -3, -15, -6, -1, -10, -6, 94, -23, 38, -13, 6, -2, -8, -13,
+  -38, 13, -3, -12, 22, -32, 18, 9, 81, -28, 27, -78, 26, -6, 127, 0, -26, -16, -8, -13, 11, 4, 30, 4, -44, 31, -20, -10, 1, 42, -21, -4,
+  127, 1, 28, -13, 35, 24, -31, 14, 19, -15, -37, -24, 8, -22, 31, 30, -9, -8, 35, 19, -7, -32, -1, -6, -38, 11, 20, 0, 33, 25, 36, 26,
+  56, -13, -47, 8, -1, 14, 5, -65, 126, 72, 116, -33, 127, 35, 48, -19, -55, 34, -36, -32, 24, 16, 41, -13, 1, 3, 7, 25, 0, 51, 101, 2,
+  -22, -48, -62, -20, 41, 4, 23, -46, 34, 27, -35, -15, -53, -12, 14, 3, 24, -28, -69, -52, -127, 22, -28, 21, -90, -97, -36, 84, -10, 5, 66, 30,
+  40, 17, 12, 8, 7, -36, -5, 5, -34, -1, 17, 19, -5, -1, 55, 10, -32, 14, 9, 0, 2, -2, 17, 19, 44, 83, -10, 127, 5, -67, -27, 16,
+  1, -18, 14, -12, 42, 7, -19, -42, 0, 18, -1, -29, -127, -11, 4, 57, 10, -1, 19, 19, -33, 5, 15, -42, 30, -7, 6, -32, -3, 28, -12, -2,
+  -39, 12, 4, 23, 9, -26, -5, 14, -54, -13, -48, 19, 39, 14, -7, -2, 8, -49, 7, 8, -43, 14, 42, -2, -127, 19, -11, 78, -2, -6, 46, 26,
+  -65, -11, -23, 22, -61, 40, -16, -117, 72, -59, 101, 14, -18, 20, -65, -3, -82, 118, -9, -20, 45, 11, 16, -1, 127, 59, 26, -47, 22, 83, -92, 79,
+  61, 6, 41, -48, -37, 39, -79, 48, 46, 50, 61, -13, -5, -41, 58, 92, 9, 47, 35, 30, 127, -40, -78, -66, 48, 29, 37, -1, -68, -60, 57, 33,
+  127, 2, 102, -50, 43, 67, -6, 13, 43, -65, 1, 25, -87, 17, 26, 46, 42, -37, 105, 52, 30, -30, 3, -47, 92, -21, 49, 17, 62, -46, 46, 32,
+  100, -92, -7, -8, -21, 40, 8, -53, 89, 75, 63, -95, 127, 16, -30, -13, -72, 126, -22, -4, -74, -11, -29, -12, 14, -67, 41, -57, 7, 35, 89, -16,
+  -14, -15, -28, 99, -71, -12, 7, -33, 47, 41, 9, 13, 77, 10, -33, -7, 9, -71, -23, -21, 24, 61, 61, -14, -78, 106, -15, -97, -13, -19, -21, -127,
+  -127, 13, 13, -50, -18, -7, -1, -85, -43, 65, -63, -83, 64, 22, -12, 0, 20, -66, 0, 2, 22, -6, 31, -26, -67, 74, 8, -52, -10, 43, 104, 17,
+  8, 11, -26, 17, -39, -6, 11, 25, -29, 1, -26, -7, 77, -2, -25, -17, 24, -19, -20, -21, 33, 1, -36, -15, -31, 21, -3, 127, 3, 9, 10, -26,
+  -7, 5, -3, 3, 39, -18, -12, 14, 127, -99, 5, 102, -55, 13, 45, 11, -81, -87, -14, -10, -91, 13, -19, 5, -15, 17, -15, 28, -2, -107, -5, 29,
+  -30, -35, 11, -14, -74, 34, -10, -19, -127, 17, -39, -45, 26, -6, -34, 22, 33, -54, 13, 20, 23, -15, 21, -6, -2, -2, 30, -54, 5, 4, 93, -67,
+  -28, -74, 35, -24, -80, -3, 8, -57, -103, 39, 5, -31, -120, 20, -55, -1, 34, 36, 34, 13, 19, -15, 49, -30, 127, -41, -8, -26, -37, 4, 35, -87,
+  -8, -11, 1, 22, -44, -24, 8, -5, -26, 79, -18, 17, 4, -21, -29, -7, 12, 106, -5, 3, -17, 12, 21, 16, -13, 127, -13, 46, -1, 53, 20, 54,
+  -4, -15, 16, 1, 2, 12, -17, -11, 7, -1, 3, -19, -127, -22, 5, 11, 3, 7, 24, 25, -45, -30, 27, -53, 13, -3, 11, -75, 60, 10, 0, 7,
+  72, 1, -1, -26, 13, -4, 11, 11, 3, 68, 25, -23, 127, 10, 20, 8, 3, 11, -9, 31, 58, -12, -3, 9, -78, -3, 36, 6, -3, -32, 42, 0,
+  -37, -31, -4, 6, -46, 13, -2, 5, -54, 34, -11, -35, 14, -5, -127, 6, -17, -10, -15, -14, -9, -5, -36, 4, 18, -45, 36, -3, 0, -29, 64, -27,
+  15, -6, 21, -84, -3, -16, -40, 16, 34, -19, 13, -51, -127, 7, 19, 56, -34, 56, 14, 17, -74, -36, -92, -2, 63, 56, 7, 110, 18, -41, 14, 14
+};
+
+static const int32_t cwnetMh[96] = {
+  7315, 13389, 2460, 14398, 3894, 10299, 13304, 10831,
+  11370, 13602, 8299, 18260, 5999, 18045, 12038, 9127,
+  7892, 10355, 16053, 18012, 8975, 26814, 11406, 9746,
+  11437, 7957, 13822, 9313, 21609, 13776, 6980, 10843,
+  9874, 10168, 2983, 17330, 11126, 11206, 8469, 16676,
+  12647, 8467, 8928, 9787, 11423, 14532, 8534, 25213,
+  8919, 15391, 13872, 8815, 9690, 14607, 12011, 16853,
+  12644, 11914, 10541, 9435, 17824, 15693, 9985, 17565,
+  13141, 11579, 6956, 14406, 9058, 12717, 11882, 11891,
+  7430, 14326, 16716, 11999, 11761, 11963, 16991, 18763,
+  13605, 8251, 8791, 10769, 7681, 11528, 9279, 13428,
+  8655, 10281, 8627, 13657, 17222, 11823, 12930, 10742
+};
+
+static const int32_t cwnetBh[96] = {
+  2014, -726, -3904, -288, 126, 20, 215, 311,
+  296, -940, 235, 90, 364, -1663, 148, 132,
+  734, -349, -3715, -1046, 324, 662, 180, 64,
+  106, 167, -1383, 335, -585, -1839, 458, 120,
+  -388, -255, 1619, 501, -22, 591, 669, 416,
+  478, -349, 151, -87, 834, 652, -550, -419,
+  -78, 250, 638, 1166, -342, 61, 112, 788,
+  589, -46, 303, -134, -820, -787, -361, 50,
+  -999, -232, 2347, -949, -88, 1112, -1119, -346,
+  -243, 292, -268, 792, -1874, -642, 234, 566,
+  -84, 180, 1546, 1897, 492, -440, 95, -422,
+  221, 424, 1114, -87, 917, -456, -324, 473
+};
+
+static const int8_t cwnetWo[1344] = {
+  58, -12, 127, -1, 11, -13, -13, 13, 0, 46, 60, 13, 35, -16, 18, 1, -10, 26, 125, 95, 43, -1, -49, -7, 18, -42, 63, -14, -16, -89, 19, -7,
+  -26, -18, -19, 13, -127, -28, 8, -103, -65, 75, -28, 31, -78, 21, -48, -1, -62, -89, -24, -25, -61, 33, 83, -32, 122, 78, 22, -53, -36, -30, -50, -12,
+  -17, -24, -24, -12, -33, 31, 11, 53, 3, -13, -17, -28, 42, -22, -28, -7, 6, -28, -33, -26, -24, -13, 49, -127, -36, -46, -7, 90, -3, 49, 2, 39,
+  -31, 22, -7, 127, 44, -110, -104, -49, 98, 7, -2, 39, -49, 82, 18, -37, 3, 41, -14, -75, -71, -25, -56, -8, -36, 122, -34, -37, 38, -5, 33, 36,
+  -34, -12, -12, 88, 29, -4, 127, 20, 72, 14, 5, 55, -89, 29, 30, -56, -68, 48, -15, 43, -37, -20, -30, 53, -12, -25, -49, -40, 119, -7, 64, 38,
+  -24, 47, -41, 127, -22, 31, -21, 29, 51, 17, -29, -4, -36, 15, 41, 100, 43, 27, -51, -23, -37, 4, -27, -41, -20, 40, -51, 30, 77, 56, 11, 7,
+  -107, -17, -52, -9, 41, 92, -33, -127, 5, 81, -116, 18, -123, 9, 46, -30, 102, 120, -39, -34, -105, 22, 55, -15, -10, -33, -86, 55, -28, 30, 4, -29,
+  0, 2, -36, -127, 45, -48, 57, -3, -58, -58, 24, 43, 13, -11, -2, -56, -75, -9, -40, -18, -29, 5, 50, 33, -21, 16, -24, 22, 40, 48, 37, 85,
+  80, 21, -46, 64, 80, 16, 49, -15, -29, 33, -105, 72, 26, -3, -39, 84, -108, -23, -38, -18, -33, 127, 26, 42, -34, -52, 5, 61, 115, 51, -44, -70,
+  -42, 19, -41, -127, 16, -45, -58, 17, 21, -30, 5, -71, -18, 19, 17, -81, 23, 41, -49, 19, -38, 42, -22, 37, 3, 67, -33, 5, 81, 37, 9, 6,
+  -68, 77, -53, -71, 9, -89, -57, -85, -11, 2, -19, 24, 127, -3, 54, 32, 22, -31, -57, -54, -46, 12, 96, -80, -55, 61, -51, 102, -13, 66, 37, 46,
+  -38, 55, -27, 123, -46, -17, 29, 105, -32, -88, -24, -1, 40, 18, 10, 127, 104, 4, -24, -26, 11, 22, 41, -29, -27, -5, -26, -107, -28, 50, 34, -33,
+  -23, -61, -48, 127, 67, 21, -2, 48, 61, 14, -25, 15, -95, 15, -76, 83, -8, -28, -51, -30, -80, -17, -15, 3, -72, -79, 43, -40, 74, 78, -32, 27,
+  12, 53, -25, 20, 34, 127, -14, -12, 50, 7, -14, -50, -7, 40, 17, -72, -4, -12, -28, -35, -16, -38, -46, 42, -20, 41, -32, 10, 22, 15, -11, 40,
+  -65, -28, -30, -67, -18, -6, 26, -80, 22, 69, -66, 2, 7, -13, -14, 3, 55, 8, -43, -30, -89, 70, 54, -28, -56, 58, -15, -59, 41, 21, -11, -127,
+  -33, -25, -45, 111, 6, -63, 100, -105, 13, 1, -42, 26, -13, 15, -3, 5, 33, 8, -31, -40, -127, -77, 47, -122, -97, -79, -29, 46, -10, -27, -22, 10,
+  15, -49, -3, 66, 37, -45, -13, -17, -28, 7, -56, -32, -27, 21, 0, 7, 62, 10, -16, -9, 39, 52, 28, -127, 36, 95, -19, 5, -119, 23, -2, -90,
+  73, 21, -36, 52, 68, -2, 43, -5, -65, 27, -52, 28, 46, -34, -32, -76, -111, -5, -42, 3, 46, -57, 82, 31, -2, -49, -17, 51, 65, -9, -127, -96,
+  28, -63, -5, 40, 71, 39, -5, -37, 72, -23, -33, 15, -75, 49, -127, 21, 15, -13, -7, 28, 6, 107, -72, -2, -30, -1, 23, 58, -46, 66, -12, -59,
+  -5, 16, -48, 39, 26, -31, 61, 82, -23, -47, 55, 47, 46, -12, -35, 127, -46, -12, -46, -29, -62, -58, 86, 24, -19, -19, -29, 12, 30, 27, -31, 42,
+  -8, 25, -42, -50, 14, -30, -41, 127, 0, -34, 40, -55, 8, 29, 32, 98, 3, 35, -45, -23, -14, 19, 32, 6, -17, 64, -39, 53, 31, 80, 14, 22,
+  -56, -2, -25, 20, -11, 27, 21, -48, -1, 14, -1, 15, -85, 14, -27, -16, 38, -55, -24, -24, -88, 7, 16, -7, -40, -25, -2, -127, -14, 24, 33, 102,
+  -1, -12, -42, -74, -65, 31, 6, 38, -19, -51, 3, -6, -3, 23, -24, 127, -35, -13, -38, -38, -36, 24, 23, 92, -29, -79, 3, 29, 12, 71, -27, 69,
+  -59, -26, -30, -59, -80, 40, 10, -43, -34, -52, -16, -85, -27, 60, -44, -127, -10, -17, -30, -14, -72, 25, -39, 36, 4, -74, -5, -15, 96, 72, -29, 56,
+  -33, -14, -21, -85, -31, 53, 17, 120, 11, -26, -14, -35, 46, -3, -7, 37, 17, 36, -24, -17, -33, 34, 48, -67, -2, 45, -23, 48, 13, 47, 27, -127,
+  -16, -49, -27, 75, 28, 33, 2, -52, 25, -17, -29, -31, 0, 87, -77, -89, 0, -13, -21, -10, -17, -65, -127, -6, -53, 83, 31, 22, 84, 37, -35, -85,
+  -3, -49, -51, 41, -23, 1, 33, 24, 4, 19, -68, -20, -100, -100, 0, 2, 27, 0, -50, -34, 18, -27, 23, 104, -26, 96, -30, -36, 127, 53, -32, -63,
+  17, 66, 3, 58, -20, 90, -4, -20, 94, 28, -50, 2, -83, 127, 88, 25, -25, 34, 1, -8, -38, 100, -35, 9, -90, 42, -25, 30, -111, 12, 54, -29,
+  -22, 28, -17, -11, -53, -30, -17, 46, -37, -69, -71, 52, 29, 30, 4, -49, -82, -9, -15, -8, 81, 127, 23, -6, 21, 57, 10, -47, 83, 31, -7, -49,
+  -80, 8, -25, 46, -15, -114, 6, 45, -29, -100, -70, 62, 38, 31, -3, -30, 36, -14, -23, -13, 66, -127, 51, -93, 9, 88, 11, -110, -31, 26, 11, -105,
+  -1, 26, -27, 55, -13, 62, 28, -31, -35, -52, 9, 41, 66, 12, -13, -12, 85, 0, -35, -14, 3, -92, 127, 66, -1, 9, 14, -91, -49, 6, -44, -67,
+  -23, 10, -42, -127, -70, 5, 8, -19, 5, -51, -13, 13, 36, -77, -47, -37, 35, -31, -39, -29, -66, -17, 14, 101, 35, -6, 4, -30, 40, 54, -27, -65,
+  -19, -16, -29, -91, -62, 46, 17, -17, -48, -43, -14, -40, 22, 62, -54, -36, 12, -39, -23, 9, -99, -7, -35, 24, 11, -29, 14, -53, -127, 55, -55, -16,
+  -9, 13, -8, -121, 9, -40, -27, -18, -4, -32, 0, -41, 14, 43, 22, -19, -23, 10, -5, -41, -58, -6, -24, 64, -1, 127, -37, 18, -127, 33, -3, 71,
+  9, 31, -36, 119, 68, -40, -104, -63, 105, 44, -41, 5, -19, -114, 27, -35, 68, 16, -37, -64, -88, -127, -13, -2, -67, 101, -77, -33, -108, -4, -2, 16,
+  -59, 32, -1, 16, 60, -99, -127, -5, 9, -2, 7, 49, -37, -24, -7, 50, -59, -14, 2, -72, -18, 102, -60, 27, -7, 28, -88, 51, -51, -5, 48, 67,
+  -52, 75, -28, 48, 100, 87, -62, 0, -13, 6, -31, 51, -19, -102, 77, 7, 3, 3, -42, -90, 127, 85, -52, 26, -32, 86, -73, 122, 14, -7, 8, -110,
+  -8, 25, 4, -25, 82, -38, 67, 19, -69, 1, 1, 28, 30, -21, -25, 24, -127, -47, 12, -15, 127, 50, 12, 79, 1, 45, -1, 26, -109, -11, -99, -88,
+  -60, 49, -29, -35, -35, 77, -9, 0, -76, -77, -28, -13, 40, -66, 115, -16, -14, -46, -34, -127, 46, -97, -9, 47, 14, 99, -18, 87, -83, 26, -22, -60,
+  -20, -4, -23, 49, -7, 34, -2, -50, 36, -4, -54, -9, -42, -88, -118, 2, 59, -48, -32, -61, 52, -99, -75, -27, 21, -88, 38, 127, -96, 53, -52, -70,
+  -124, 32, -5, 16, -62, 5, -3, -33, -64, -31, -74, -22, 47, -62, -42, -89, 45, -20, -8, 4, 84, 117, -127, 111, 58, 96, 25, -127, 32, 37, -36, -38,
+  -29, 2, 7, 15, -2, -20, 80, -29, 36, -6, -25, 52, -29, -39, -3, 0, -109, -20, -8, -38, -34, -127, -30, 38, -22, 19, -48, 13, -118, -2, 63, 44
+};
+
+static const int32_t cwnetMo[42] = {
+  13084, 7511, 22478, 13564, 12464, 16920, 10853, 15942,
+  10828, 18407, 12487, 13402, 13314, 17658, 13298, 11991,
+  15052, 12864, 12672, 15422, 17910, 18555, 15345, 14773,
+  17286, 13138, 17254, 11191, 15930, 12024, 16710, 16459,
+  14696, 14423, 11216, 12296, 11942, 11509, 12960, 13167,
+  12318, 12674
+};
+
+static const int32_t cwnetBo[42] = {
+  3119, -283, -1294, -350, -388, -1564, -1028, -1305,
+  -871, -1651, -1318, -712, -1187, -756, -963, -954,
+  -318, -958, -157, -1327, -1498, -918, -1199, -840,
+  -747, -645, -1597, -82, -429, -624, -1117, -1355,
+  -806, -387, -987, 14, -896, 94, -947, -537,
+  -101, -44
+};
+
+const CWNetModel cwnetModel = { cwnetWx, cwnetMx, cwnetBx, cwnetWh, cwnetMh, cwnetBh, cwnetWo, cwnetMo, cwnetBo };
+
+#endif
@@ -0,0 +1,46 @@
+/*
+ F4LAA : CW Decoder, classification des caractères par un ensemble d'arbres de décision
+
+   Les 11 durées d'un caractère (times de DecodedChar : son, silence, son, ...) sont exprimées en 1/16 de
+   l'unité de temps courante (silence entre éléments des caractères précédents, CWTreeUnit), bornées à 255 :
+   l'ensemble d'arbres appris sur PC par tools/cwtree n'est que des comparaisons d'entiers sur ces valeurs
+   (code généré dans include/CWTreeCode.h, pas de flottants ni de tables en RAM).
+*/
+#ifndef CWTree_h
+#define CWTree_h
+
+#include <stdint.h>
+#include "CWDecoder.h"
+
+#define CWTREE_SCALE 16 // Features in 1/16 of the unit
+
+inline void cwTreeFeatures(const int times[MAXTIMES], int unit, uint8_t x[MAXTIMES])
+{
+  if (unit < 1)
+    unit = 1;
+  for (int i = 0; i < MAXTIMES; i++)
+  {
+    int v = times[i] * CWTREE_SCALE / unit;
+    x[i] = (v > 255) ? 255 : ((v < 0) ? 0 : v);
+  }
+}
+
+// Unit : rolling average of the spaces inside the previous characters, as in tools/cwtree. The same for both
+// timing models (hightimesavg of G6EJD is a mark average, not the unit the trees were trained on)
+#define CWTREE_UNITSPEED 4 // As ADAPT_SPEED
+
+struct CWTreeUnit
+{
+  float unit = 0; // 0 : no character seen yet
+
+  int value() const { return (int) (unit + 0.5f); }
+
+  void add(const int times[MAXTIMES])
+  {
+    for (int i = 1; i < MAXTIMES; i += 2)
+      if (times[i] > 0)
+        unit = (unit == 0) ? times[i] : unit + (times[i] - unit) / CWTREE_UNITSPEED;
+  }
+};
+
+#endif
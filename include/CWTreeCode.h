@@ -0,0 +1,2022 @@
+/*
+ F4LAA : Classification des caractères (voir CWTree.h)
+
+   Généré par tools/cwtree : ne pas modifier.
+   1 arbre(s), 801 nœuds, 30760 lignes d'apprentissage : 79.2% de bons caractères (CodeToChar 74.5%)
+*/
+#ifndef CWTreeCode_h
+#define CWTreeCode_h
+
+#include "CWTree.h"
+
+static inline char cwTree0(const uint8_t *x)
+{
+  if (x[2] <= 0)
+  {
+    if (x[0] <= 37)
+    {
+      if (x[1] <= 21)
+      {
+        if (x[0] <= 29)
+        {
+          if (x[1] <= 17)
+          {
+            if (x[0] <= 20)
+            {
+              if (x[0] <= 3)
+              {
+                if (x[1] <= 8)
+                  return 'e';
+                else
+                {
+                  if (x[0] <= 2)
+                    return 'e';
+                  else
+                    return 't';
+                }
+              }
+              else
+              {
+                if (x[1] <= 13)
+                  return 'e';
+                else
+                {
+                  if (x[0] <= 5)
+                  {
+                    if (x[1] <= 15)
+                      return 't';
+                    else
+                      return 'e';
+                  }
+                  else
+                    return 'e';
+                }
+              }
+            }
+            else
+              return 'e';
+          }
+          else
+          {
+            if (x[0] <= 5)
+              return 't';
+            else
+            {
+              if (x[0] <= 8)
+              {
+                if (x[1] <= 20)
+                {
+                  if (x[0] <= 6)
+                    return 'e';
+                  else
+                    return 't';
+                }
+                else
+                  return 'e';
+              }
+              else
+                return 'e';
+            }
+          }
+        }
+        else
+        {
+          if (x[0] <= 31)
+            return 't';
+          else
+          {
+            if (x[0] <= 33)
+              return 'e';
+            else
+            {
+              if (x[0] <= 34)
+                return 't';
+              else
+                return 'e';
+            }
+          }
+        }
+      }
+      else
+      {
+        if (x[1] <= 27)
+        {
+          if (x[0] <= 10)
+          {
+            if (x[0] <= 4)
+              return 't';
+            else
+            {
+              if (x[0] <= 8)
+              {
+                if (x[0] <= 6)
+                {
+                  if (x[1] <= 24)
+                    return 'e';
+                  else
+                    return 't';
+                }
+                else
+                {
+                  if (x[1] <= 25)
+                  {
+                    if (x[1] <= 24)
+                      return 'e';
+                    else
+                      return 't';
+                  }
+                  else
+                    return 'e';
+                }
+              }
+              else
+                return 't';
+            }
+          }
+          else
+            return 'e';
+        }
+        else
+        {
+          if (x[0] <= 23)
+          {
+            if (x[0] <= 7)
+            {
+              if (x[0] <= 6)
+              {
+                if (x[0] <= 5)
+                {
+                  if (x[1] <= 90)
+                    return 't';
+                  else
+                    return 'e';
+                }
+                else
+                {
+                  if (x[1] <= 31)
+                    return 't';
+                  else
+                  {
+                    if (x[1] <= 33)
+                      return 'e';
+                    else
+                      return 't';
+                  }
+                }
+              }
+              else
+                return 't';
+            }
+            else
+            {
+              if (x[0] <= 9)
+              {
+                if (x[1] <= 39)
+                  return 't';
+                else
+                {
+                  if (x[1] <= 91)
+                    return 'e';
+                  else
+                    return 't';
+                }
+              }
+              else
+              {
+                if (x[1] <= 41)
+                {
+                  if (x[0] <= 17)
+                  {
+                    if (x[1] <= 39)
+                      return 't';
+                    else
+                      return 'e';
+                  }
+                  else
+                    return 'e';
+                }
+                else
+                {
+                  if (x[1] <= 225)
+                    return 't';
+                  else
+                    return 'e';
+                }
+              }
+            }
+          }
+          else
+          {
+            if (x[1] <= 56)
+              return 'e';
+            else
+            {
+              if (x[1] <= 129)
+                return 't';
+              else
+              {
+                if (x[0] <= 26)
+                  return 'e';
+                else
+                  return 't';
+              }
+            }
+          }
+        }
+      }
+    }
+    else
+    {
+      if (x[0] <= 41)
+      {
+        if (x[0] <= 38)
+          return 't';
+        else
+        {
+          if (x[0] <= 39)
+            return 'e';
+          else
+            return 't';
+        }
+      }
+      else
+      {
+        if (x[0] <= 73)
+        {
+          if (x[0] <= 47)
+          {
+            if (x[0] <= 46)
+            {
+              if (x[0] <= 44)
+              {
+                if (x[1] <= 0)
+                  return 't';
+                else
+                  return 'e';
+              }
+              else
+                return 't';
+            }
+            else
+              return 't';
+          }
+          else
+          {
+            if (x[1] <= 0)
+              return 't';
+            else
+              return 'e';
+          }
+        }
+        else
+        {
+          if (x[0] <= 128)
+          {
+            if (x[0] <= 81)
+              return 't';
+            else
+            {
+              if (x[0] <= 105)
+              {
+                if (x[0] <= 102)
+                  return 't';
+                else
+                {
+                  if (x[0] <= 103)
+                    return 'e';
+                  else
+                    return 't';
+                }
+              }
+              else
+              {
+                if (x[0] <= 121)
+                  return 't';
+                else
+                {
+                  if (x[0] <= 126)
+                  {
+                    if (x[0] <= 125)
+                      return 't';
+                    else
+                      return 'e';
+                  }
+                  else
+                    return 't';
+                }
+              }
+            }
+          }
+          else
+          {
+            if (x[0] <= 187)
+              return 't';
+            else
+            {
+              if (x[0] <= 250)
+              {
+                if (x[0] <= 235)
+                {
+                  if (x[0] <= 220)
+                  {
+                    if (x[0] <= 190)
+                      return 'e';
+                    else
+                      return 't';
+                  }
+                  else
+                    return 't';
+                }
+                else
+                  return 'e';
+              }
+              else
+                return 't';
+            }
+          }
+        }
+      }
+    }
+  }
+  else
+  {
+    if (x[4] <= 0)
+    {
+      if (x[2] <= 27)
+      {
+        if (x[0] <= 36)
+        {
+          if (x[3] <= 21)
+          {
+            if (x[1] <= 7)
+            {
+              if (x[0] <= 15)
+              {
+                if (x[3] <= 6)
+                {
+                  if (x[2] <= 13)
+                    return 'i';
+                  else
+                  {
+                    if (x[0] <= 8)
+                      return 'a';
+                    else
+                      return 'i';
+                  }
+                }
+                else
+                {
+                  if (x[0] <= 2)
+                    return 'n';
+                  else
+                    return 'a';
+                }
+              }
+              else
+              {
+                if (x[2] <= 14)
+                  return 'n';
+                else
+                {
+                  if (x[0] <= 19)
+                  {
+                    if (x[2] <= 22)
+                      return 'i';
+                    else
+                      return 'a';
+                  }
+                  else
+                  {
+                    if (x[1] <= 5)
+                      return 'm';
+                    else
+                      return 'i';
+                  }
+                }
+              }
+            }
+            else
+            {
+              if (x[1] <= 24)
+              {
+                if (x[2] <= 7)
+                {
+                  if (x[3] <= 15)
+                  {
+                    if (x[1] <= 16)
+                      return 'i';
+                    else
+                      return 'n';
+                  }
+                  else
+                  {
+                    if (x[0] <= 6)
+                      return 'm';
+                    else
+                      return 'i';
+                  }
+                }
+                else
+                {
+                  if (x[1] <= 11)
+                  {
+                    if (x[2] <= 25)
+                      return 'i';
+                    else
+                      return 'a';
+                  }
+                  else
+                    return 'i';
+                }
+              }
+              else
+              {
+                if (x[1] <= 40)
+                {
+                  if (x[2] <= 13)
+                  {
+                    if (x[0] <= 12)
+                      return 'n';
+                    else
+                      return 'i';
+                  }
+                  else
+                  {
+                    if (x[0] <= 9)
+                      return 'n';
+                    else
+                      return 'i';
+                  }
+                }
+                else
+                  return 'n';
+              }
+            }
+          }
+          else
+          {
+            if (x[1] <= 20)
+            {
+              if (x[3] <= 24)
+              {
+                if (x[2] <= 4)
+                  return 'm';
+                else
+                {
+                  if (x[1] <= 8)
+                    return 'a';
+                  else
+                    return 'i';
+                }
+              }
+              else
+              {
+                if (x[2] <= 2)
+                  return 'm';
+                else
+                  return 'a';
+              }
+            }
+            else
+            {
+              if (x[1] <= 33)
+              {
+                if (x[3] <= 47)
+                {
+                  if (x[2] <= 11)
+                  {
+                    if (x[2] <= 5)
+                      return 'n';
+                    else
+                      return 'm';
+                  }
+                  else
+                  {
+                    if (x[1] <= 22)
+                      return 'n';
+                    else
+                      return 'i';
+                  }
+                }
+                else
+                {
+                  if (x[3] <= 67)
+                  {
+                    if (x[3] <= 62)
+                      return 'a';
+                    else
+                      return 'i';
+                  }
+                  else
+                    return 'a';
+                }
+              }
+              else
+              {
+                if (x[3] <= 30)
+                {
+                  if (x[1] <= 49)
+                  {
+                    if (x[1] <= 43)
+                      return 'i';
+                    else
+                      return 'm';
+                  }
+                  else
+                    return 'n';
+                }
+                else
+                {
+                  if (x[0] <= 23)
+                    return 'm';
+                  else
+                  {
+                    if (x[1] <= 76)
+                      return 'i';
+                    else
+                      return 'm';
+                  }
+                }
+              }
+            }
+          }
+        }
+        else
+        {
+          if (x[2] <= 21)
+          {
+            if (x[0] <= 115)
+            {
+              if (x[0] <= 74)
+              {
+                if (x[0] <= 40)
+                {
+                  if (x[2] <= 15)
+                    return 'n';
+                  else
+                  {
+                    if (x[1] <= 9)
+                      return 'n';
+                    else
+                      return 'i';
+                  }
+                }
+                else
+                  return 'n';
+              }
+              else
+              {
+                if (x[0] <= 104)
+                {
+                  if (x[1] <= 9)
+                    return 'n';
+                  else
+                  {
+                    if (x[1] <= 10)
+                      return 'i';
+                    else
+                      return 'n';
+                  }
+                }
+                else
+                {
+                  if (x[2] <= 18)
+                    return 'n';
+                  else
+                  {
+                    if (x[0] <= 112)
+                      return 'n';
+                    else
+                      return 'i';
+                  }
+                }
+              }
+            }
+            else
+            {
+              if (x[0] <= 186)
+                return 'n';
+              else
+              {
+                if (x[1] <= 15)
+                  return 'i';
+                else
+                  return 'n';
+              }
+            }
+          }
+          else
+          {
+            if (x[0] <= 60)
+            {
+              if (x[1] <= 9)
+              {
+                if (x[1] <= 6)
+                  return 'm';
+                else
+                {
+                  if (x[0] <= 42)
+                    return 'm';
+                  else
+                    return 'i';
+                }
+              }
+              else
+              {
+                if (x[1] <= 14)
+                {
+                  if (x[1] <= 10)
+                    return 'n';
+                  else
+                    return 'i';
+                }
+                else
+                {
+                  if (x[2] <= 22)
+                    return 'i';
+                  else
+                  {
+                    if (x[1] <= 19)
+                      return 'n';
+                    else
+                      return 'i';
+                  }
+                }
+              }
+            }
+            else
+            {
+              if (x[1] <= 11)
+              {
+                if (x[0] <= 102)
+                {
+                  if (x[2] <= 23)
+                    return 'n';
+                  else
+                  {
+                    if (x[0] <= 71)
+                      return 'i';
+                    else
+                      return 'm';
+                  }
+                }
+                else
+                {
+                  if (x[2] <= 23)
+                    return 'i';
+                  else
+                    return 'n';
+                }
+              }
+              else
+              {
+                if (x[1] <= 17)
+                {
+                  if (x[1] <= 15)
+                    return 'n';
+                  else
+                  {
+                    if (x[0] <= 91)
+                      return 'i';
+                    else
+                      return 'n';
+                  }
+                }
+                else
+                  return 'n';
+              }
+            }
+          }
+        }
+      }
+      else
+      {
+        if (x[0] <= 35)
+        {
+          if (x[2] <= 34)
+          {
+            if (x[0] <= 24)
+            {
+              if (x[1] <= 39)
+              {
+                if (x[0] <= 11)
+                  return 'a';
+                else
+                {
+                  if (x[0] <= 21)
+                  {
+                    if (x[1] <= 2)
+                      return 'i';
+                    else
+                      return 'a';
+                  }
+                  else
+                    return 'a';
+                }
+              }
+              else
+                return 'n';
+            }
+            else
+            {
+              if (x[1] <= 9)
+                return 'm';
+              else
+              {
+                if (x[0] <= 28)
+                {
+                  if (x[2] <= 29)
+                    return 'a';
+                  else
+                    return 'i';
+                }
+                else
+                {
+                  if (x[2] <= 30)
+                    return 'm';
+                  else
+                    return 'i';
+                }
+              }
+            }
+          }
+          else
+          {
+            if (x[1] <= 10)
+            {
+              if (x[0] <= 26)
+              {
+                if (x[1] <= 4)
+                {
+                  if (x[0] <= 10)
+                    return 'a';
+                  else
+                  {
+                    if (x[0] <= 19)
+                      return 'i';
+                    else
+                      return 'a';
+                  }
+                }
+                else
+                {
+                  if (x[0] <= 8)
+                    return 'n';
+                  else
+                    return 'a';
+                }
+              }
+              else
+              {
+                if (x[2] <= 105)
+                {
+                  if (x[2] <= 67)
+                  {
+                    if (x[2] <= 37)
+                      return 'm';
+                    else
+                      return 'a';
+                  }
+                  else
+                  {
+                    if (x[0] <= 28)
+                      return 'm';
+                    else
+                      return 'a';
+                  }
+                }
+                else
+                  return 'n';
+              }
+            }
+            else
+            {
+              if (x[1] <= 23)
+              {
+                if (x[0] <= 25)
+                  return 'a';
+                else
+                {
+                  if (x[2] <= 66)
+                    return 'a';
+                  else
+                  {
+                    if (x[2] <= 68)
+                      return 'm';
+                    else
+                      return 'a';
+                  }
+                }
+              }
+              else
+              {
+                if (x[3] <= 124)
+                {
+                  if (x[2] <= 37)
+                    return 'n';
+                  else
+                    return 'i';
+                }
+                else
+                  return 'a';
+              }
+            }
+          }
+        }
+        else
+        {
+          if (x[2] <= 37)
+          {
+            if (x[0] <= 80)
+            {
+              if (x[1] <= 16)
+              {
+                if (x[2] <= 28)
+                {
+                  if (x[1] <= 7)
+                    return 'i';
+                  else
+                  {
+                    if (x[0] <= 60)
+                      return 'n';
+                    else
+                      return 'm';
+                  }
+                }
+                else
+                  return 'm';
+              }
+              else
+              {
+                if (x[2] <= 34)
+                {
+                  if (x[2] <= 32)
+                  {
+                    if (x[1] <= 19)
+                      return 'a';
+                    else
+                      return 'm';
+                  }
+                  else
+                    return 'n';
+                }
+                else
+                {
+                  if (x[0] <= 44)
+                  {
+                    if (x[1] <= 18)
+                      return 'm';
+                    else
+                      return 'i';
+                  }
+                  else
+                    return 'i';
+                }
+              }
+            }
+            else
+            {
+              if (x[2] <= 35)
+              {
+                if (x[2] <= 28)
+                  return 'i';
+                else
+                {
+                  if (x[1] <= 10)
+                  {
+                    if (x[1] <= 9)
+                      return 'n';
+                    else
+                      return 'a';
+                  }
+                  else
+                    return 'n';
+                }
+              }
+              else
+              {
+                if (x[2] <= 36)
+                {
+                  if (x[0] <= 92)
+                    return 'm';
+                  else
+                    return 'n';
+                }
+                else
+                {
+                  if (x[0] <= 110)
+                    return 'n';
+                  else
+                    return 'm';
+                }
+              }
+            }
+          }
+          else
+          {
+            if (x[0] <= 44)
+            {
+              if (x[2] <= 48)
+              {
+                if (x[0] <= 41)
+                  return 'm';
+                else
+                {
+                  if (x[1] <= 13)
+                    return 'i';
+                  else
+                    return 'm';
+                }
+              }
+              else
+              {
+                if (x[1] <= 9)
+                {
+                  if (x[2] <= 57)
+                  {
+                    if (x[1] <= 5)
+                      return 'm';
+                    else
+                      return 'a';
+                  }
+                  else
+                  {
+                    if (x[2] <= 70)
+                      return 'm';
+                    else
+                      return 'a';
+                  }
+                }
+                else
+                {
+                  if (x[2] <= 55)
+                  {
+                    if (x[0] <= 42)
+                      return 'a';
+                    else
+                      return 'm';
+                  }
+                  else
+                    return 'a';
+                }
+              }
+            }
+            else
+            {
+              if (x[1] <= 10)
+              {
+                if (x[2] <= 80)
+                {
+                  if (x[0] <= 94)
+                  {
+                    if (x[2] <= 74)
+                      return 'm';
+                    else
+                      return 'i';
+                  }
+                  else
+                    return 'a';
+                }
+                else
+                {
+                  if (x[0] <= 57)
+                    return 'a';
+                  else
+                  {
+                    if (x[0] <= 178)
+                      return 'm';
+                    else
+                      return 'n';
+                  }
+                }
+              }
+              else
+              {
+                if (x[0] <= 192)
+                {
+                  if (x[0] <= 81)
+                  {
+                    if (x[2] <= 126)
+                      return 'm';
+                    else
+                      return 'a';
+                  }
+                  else
+                    return 'm';
+                }
+                else
+                {
+                  if (x[0] <= 253)
+                  {
+                    if (x[1] <= 16)
+                      return 'n';
+                    else
+                      return 'm';
+                  }
+                  else
+                    return 'n';
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+    else
+    {
+      if (x[6] <= 0)
+      {
+        if (x[2] <= 29)
+        {
+          if (x[4] <= 29)
+          {
+            if (x[0] <= 40)
+            {
+              if (x[5] <= 0)
+              {
+                if (x[3] <= 10)
+                {
+                  if (x[4] <= 13)
+                  {
+                    if (x[2] <= 15)
+                      return 'd';
+                    else
+                      return 'g';
+                  }
+                  else
+                  {
+                    if (x[2] <= 11)
+                      return 'k';
+                    else
+                      return 'o';
+                  }
+                }
+                else
+                {
+                  if (x[0] <= 33)
+                    return 's';
+                  else
+                  {
+                    if (x[4] <= 15)
+                      return 'd';
+                    else
+                      return 's';
+                  }
+                }
+              }
+              else
+              {
+                if (x[1] <= 32)
+                {
+                  if (x[3] <= 29)
+                  {
+                    if (x[5] <= 25)
+                      return 's';
+                    else
+                      return 'u';
+                  }
+                  else
+                  {
+                    if (x[5] <= 34)
+                      return 'r';
+                    else
+                      return 'w';
+                  }
+                }
+                else
+                {
+                  if (x[5] <= 26)
+                  {
+                    if (x[3] <= 27)
+                      return 'd';
+                    else
+                      return 'g';
+                  }
+                  else
+                  {
+                    if (x[3] <= 25)
+                      return 'k';
+                    else
+                      return 'o';
+                  }
+                }
+              }
+            }
+            else
+            {
+              if (x[1] <= 10)
+              {
+                if (x[4] <= 10)
+                {
+                  if (x[2] <= 14)
+                  {
+                    if (x[4] <= 7)
+                      return 's';
+                    else
+                      return 'd';
+                  }
+                  else
+                    return 'g';
+                }
+                else
+                {
+                  if (x[2] <= 9)
+                  {
+                    if (x[4] <= 16)
+                      return 's';
+                    else
+                      return 'k';
+                  }
+                  else
+                    return 'd';
+                }
+              }
+              else
+              {
+                if (x[0] <= 83)
+                {
+                  if (x[4] <= 23)
+                    return 'd';
+                  else
+                  {
+                    if (x[2] <= 23)
+                      return 'd';
+                    else
+                      return 'r';
+                  }
+                }
+                else
+                {
+                  if (x[0] <= 113)
+                  {
+                    if (x[4] <= 14)
+                      return 'd';
+                    else
+                      return 's';
+                  }
+                  else
+                  {
+                    if (x[2] <= 24)
+                      return 'd';
+                    else
+                      return 's';
+                  }
+                }
+              }
+            }
+          }
+          else
+          {
+            if (x[0] <= 38)
+            {
+              if (x[3] <= 8)
+              {
+                if (x[0] <= 22)
+                {
+                  if (x[4] <= 51)
+                  {
+                    if (x[2] <= 18)
+                      return 'u';
+                    else
+                      return 'o';
+                  }
+                  else
+                  {
+                    if (x[0] <= 10)
+                      return 'r';
+                    else
+                      return 'k';
+                  }
+                }
+                else
+                {
+                  if (x[1] <= 9)
+                  {
+                    if (x[1] <= 4)
+                      return 'o';
+                    else
+                      return 'k';
+                  }
+                  else
+                  {
+                    if (x[2] <= 12)
+                      return 'k';
+                    else
+                      return 'u';
+                  }
+                }
+              }
+              else
+              {
+                if (x[4] <= 39)
+                {
+                  if (x[0] <= 35)
+                  {
+                    if (x[2] <= 18)
+                      return 'u';
+                    else
+                      return 's';
+                  }
+                  else
+                    return 'k';
+                }
+                else
+                {
+                  if (x[4] <= 82)
+                    return 'u';
+                  else
+                  {
+                    if (x[4] <= 94)
+                      return 'k';
+                    else
+                      return 's';
+                  }
+                }
+              }
+            }
+            else
+            {
+              if (x[0] <= 43)
+              {
+                if (x[4] <= 55)
+                {
+                  if (x[2] <= 13)
+                    return 'k';
+                  else
+                  {
+                    if (x[4] <= 31)
+                      return 's';
+                    else
+                      return 'k';
+                  }
+                }
+                else
+                {
+                  if (x[2] <= 19)
+                  {
+                    if (x[2] <= 17)
+                      return 'u';
+                    else
+                      return 's';
+                  }
+                  else
+                    return 'u';
+                }
+              }
+              else
+              {
+                if (x[0] <= 71)
+                {
+                  if (x[4] <= 77)
+                    return 'k';
+                  else
+                  {
+                    if (x[1] <= 7)
+                      return 'o';
+                    else
+                      return 'g';
+                  }
+                }
+                else
+                {
+                  if (x[0] <= 120)
+                    return 'k';
+                  else
+                  {
+                    if (x[4] <= 35)
+                      return 'd';
+                    else
+                      return 'k';
+                  }
+                }
+              }
+            }
+          }
+        }
+        else
+        {
+          if (x[4] <= 27)
+          {
+            if (x[0] <= 37)
+            {
+              if (x[2] <= 37)
+              {
+                if (x[0] <= 25)
+                {
+                  if (x[4] <= 16)
+                  {
+                    if (x[5] <= 0)
+                      return 'r';
+                    else
+                      return 'g';
+                  }
+                  else
+                  {
+                    if (x[4] <= 20)
+                      return 's';
+                    else
+                      return 'w';
+                  }
+                }
+                else
+                {
+                  if (x[1] <= 15)
+                    return 'g';
+                  else
+                    return 's';
+                }
+              }
+              else
+              {
+                if (x[1] <= 5)
+                {
+                  if (x[4] <= 18)
+                  {
+                    if (x[0] <= 11)
+                      return 'r';
+                    else
+                      return 's';
+                  }
+                  else
+                  {
+                    if (x[1] <= 2)
+                      return 'w';
+                    else
+                      return 's';
+                  }
+                }
+                else
+                {
+                  if (x[3] <= 22)
+                  {
+                    if (x[4] <= 25)
+                      return 'r';
+                    else
+                      return 's';
+                  }
+                  else
+                  {
+                    if (x[0] <= 25)
+                      return 'k';
+                    else
+                      return 'w';
+                  }
+                }
+              }
+            }
+            else
+            {
+              if (x[0] <= 79)
+              {
+                if (x[0] <= 46)
+                {
+                  if (x[2] <= 47)
+                  {
+                    if (x[4] <= 19)
+                      return 'g';
+                    else
+                      return 'r';
+                  }
+                  else
+                  {
+                    if (x[3] <= 21)
+                      return 'r';
+                    else
+                      return 's';
+                  }
+                }
+                else
+                {
+                  if (x[3] <= 8)
+                  {
+                    if (x[2] <= 38)
+                      return 'r';
+                    else
+                      return 'g';
+                  }
+                  else
+                  {
+                    if (x[4] <= 24)
+                      return 'g';
+                    else
+                      return 's';
+                  }
+                }
+              }
+              else
+              {
+                if (x[0] <= 119)
+                {
+                  if (x[1] <= 15)
+                  {
+                    if (x[2] <= 43)
+                      return 'g';
+                    else
+                      return 'r';
+                  }
+                  else
+                  {
+                    if (x[4] <= 13)
+                      return 'r';
+                    else
+                      return 'g';
+                  }
+                }
+                else
+                {
+                  if (x[1] <= 8)
+                  {
+                    if (x[2] <= 46)
+                      return 'd';
+                    else
+                      return 'r';
+                  }
+                  else
+                  {
+                    if (x[0] <= 232)
+                      return 'g';
+                    else
+                      return 'd';
+                  }
+                }
+              }
+            }
+          }
+          else
+          {
+            if (x[0] <= 40)
+            {
+              if (x[2] <= 39)
+              {
+                if (x[0] <= 28)
+                {
+                  if (x[4] <= 30)
+                  {
+                    if (x[1] <= 10)
+                      return 's';
+                    else
+                      return 'k';
+                  }
+                  else
+                  {
+                    if (x[4] <= 45)
+                      return 'w';
+                    else
+                      return 'd';
+                  }
+                }
+                else
+                {
+                  if (x[3] <= 18)
+                    return 'o';
+                  else
+                  {
+                    if (x[0] <= 33)
+                      return 's';
+                    else
+                      return 'k';
+                  }
+                }
+              }
+              else
+              {
+                if (x[2] <= 112)
+                {
+                  if (x[4] <= 94)
+                  {
+                    if (x[1] <= 29)
+                      return 'w';
+                    else
+                      return 's';
+                  }
+                  else
+                    return 'u';
+                }
+                else
+                {
+                  if (x[0] <= 38)
+                  {
+                    if (x[4] <= 85)
+                      return 'r';
+                    else
+                      return 'g';
+                  }
+                  else
+                    return 'u';
+                }
+              }
+            }
+            else
+            {
+              if (x[1] <= 22)
+              {
+                if (x[1] <= 11)
+                {
+                  if (x[2] <= 63)
+                    return 'o';
+                  else
+                  {
+                    if (x[4] <= 47)
+                      return 'g';
+                    else
+                      return 'o';
+                  }
+                }
+                else
+                {
+                  if (x[0] <= 71)
+                    return 'o';
+                  else
+                  {
+                    if (x[4] <= 42)
+                      return 'w';
+                    else
+                      return 'o';
+                  }
+                }
+              }
+              else
+              {
+                if (x[4] <= 39)
+                {
+                  if (x[2] <= 46)
+                  {
+                    if (x[4] <= 32)
+                      return 'd';
+                    else
+                      return 's';
+                  }
+                  else
+                    return 'g';
+                }
+                else
+                {
+                  if (x[2] <= 48)
+                  {
+                    if (x[4] <= 48)
+                      return 's';
+                    else
+                      return 'k';
+                  }
+                  else
+                  {
+                    if (x[3] <= 13)
+                      return 's';
+                    else
+                      return 'o';
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+      else
+      {
+        if (x[8] <= 0)
+        {
+          if (x[6] <= 26)
+          {
+            if (x[2] <= 30)
+            {
+              if (x[4] <= 29)
+              {
+                if (x[0] <= 41)
+                {
+                  if (x[2] <= 11)
+                  {
+                    if (x[6] <= 14)
+                      return 'b';
+                    else
+                      return 'y';
+                  }
+                  else
+                  {
+                    if (x[7] <= 10)
+                      return 'h';
+                    else
+                      return 'b';
+                  }
+                }
+                else
+                {
+                  if (x[1] <= 7)
+                  {
+                    if (x[4] <= 13)
+                      return 'q';
+                    else
+                      return 'c';
+                  }
+                  else
+                    return 'b';
+                }
+              }
+              else
+              {
+                if (x[0] <= 38)
+                {
+                  if (x[4] <= 36)
+                  {
+                    if (x[0] <= 26)
+                      return 'f';
+                    else
+                      return 'c';
+                  }
+                  else
+                  {
+                    if (x[5] <= 24)
+                      return 'f';
+                    else
+                      return 'x';
+                  }
+                }
+                else
+                {
+                  if (x[2] <= 17)
+                  {
+                    if (x[6] <= 21)
+                      return 'c';
+                    else
+                      return 'f';
+                  }
+                  else
+                    return 'c';
+                }
+              }
+            }
+            else
+            {
+              if (x[4] <= 31)
+              {
+                if (x[0] <= 38)
+                {
+                  if (x[2] <= 36)
+                  {
+                    if (x[0] <= 25)
+                      return 'l';
+                    else
+                      return 'z';
+                  }
+                  else
+                  {
+                    if (x[3] <= 6)
+                      return 'j';
+                    else
+                      return 'l';
+                  }
+                }
+                else
+                  return 'z';
+              }
+              else
+              {
+                if (x[0] <= 35)
+                {
+                  if (x[1] <= 8)
+                  {
+                    if (x[5] <= 8)
+                      return 'q';
+                    else
+                      return 'p';
+                  }
+                  else
+                    return 'p';
+                }
+                else
+                {
+                  if (x[6] <= 19)
+                  {
+                    if (x[2] <= 88)
+                      return 'p';
+                    else
+                      return 'z';
+                  }
+                  else
+                  {
+                    if (x[2] <= 53)
+                      return 'b';
+                    else
+                      return 'p';
+                  }
+                }
+              }
+            }
+          }
+          else
+          {
+            if (x[4] <= 29)
+            {
+              if (x[2] <= 30)
+              {
+                if (x[0] <= 40)
+                {
+                  if (x[6] <= 32)
+                  {
+                    if (x[2] <= 16)
+                      return 'v';
+                    else
+                      return 'q';
+                  }
+                  else
+                    return 'v';
+                }
+                else
+                  return 'x';
+              }
+              else
+              {
+                if (x[0] <= 24)
+                {
+                  if (x[2] <= 34)
+                  {
+                    if (x[1] <= 11)
+                      return 'b';
+                    else
+                      return 'v';
+                  }
+                  else
+                  {
+                    if (x[4] <= 28)
+                      return 'p';
+                    else
+                      return 'j';
+                  }
+                }
+                else
+                {
+                  if (x[4] <= 24)
+                  {
+                    if (x[2] <= 102)
+                      return 'q';
+                    else
+                      return 'f';
+                  }
+                  else
+                  {
+                    if (x[6] <= 38)
+                      return 'l';
+                    else
+                      return 'q';
+                  }
+                }
+              }
+            }
+            else
+            {
+              if (x[2] <= 29)
+              {
+                if (x[2] <= 23)
+                {
+                  if (x[0] <= 28)
+                  {
+                    if (x[1] <= 4)
+                      return 'y';
+                    else
+                      return 'f';
+                  }
+                  else
+                    return 'y';
+                }
+                else
+                {
+                  if (x[0] <= 58)
+                  {
+                    if (x[1] <= 21)
+                      return 'c';
+                    else
+                      return 'f';
+                  }
+                  else
+                  {
+                    if (x[4] <= 39)
+                      return 'x';
+                    else
+                      return 'y';
+                  }
+                }
+              }
+              else
+              {
+                if (x[0] <= 40)
+                {
+                  if (x[4] <= 87)
+                  {
+                    if (x[5] <= 22)
+                      return 'j';
+                    else
+                      return 'h';
+                  }
+                  else
+                  {
+                    if (x[2] <= 85)
+                      return 'f';
+                    else
+                      return 'z';
+                  }
+                }
+                else
+                {
+                  if (x[6] <= 59)
+                  {
+                    if (x[2] <= 72)
+                      return 'b';
+                    else
+                      return 'z';
+                  }
+                  else
+                  {
+                    if (x[0] <= 69)
+                      return 'j';
+                    else
+                      return 'q';
+                  }
+                }
+              }
+            }
+          }
+        }
+        else
+        {
+          if (x[10] <= 23)
+          {
+            if (x[2] <= 27)
+            {
+              if (x[6] <= 28)
+              {
+                if (x[8] <= 33)
+                {
+                  if (x[0] <= 41)
+                  {
+                    if (x[9] <= 0)
+                      return '5';
+                    else
+                      return '0';
+                  }
+                  else
+                    return '6';
+                }
+                else
+                {
+                  if (x[4] <= 33)
+                    return '4';
+                  else
+                    return '1';
+                }
+              }
+              else
+              {
+                if (x[0] <= 38)
+                {
+                  if (x[4] <= 26)
+                  {
+                    if (x[8] <= 19)
+                      return '/';
+                    else
+                      return '3';
+                  }
+                  else
+                  {
+                    if (x[10] <= 0)
+                      return '2';
+                    else
+                      return '?';
+                  }
+                }
+                else
+                {
+                  if (x[8] <= 29)
+                  {
+                    if (x[4] <= 35)
+                      return '/';
+                    else
+                      return '3';
+                  }
+                  else
+                  {
+                    if (x[8] <= 33)
+                      return '0';
+                    else
+                      return '3';
+                  }
+                }
+              }
+            }
+            else
+            {
+              if (x[6] <= 27)
+              {
+                if (x[4] <= 24)
+                {
+                  if (x[0] <= 34)
+                  {
+                    if (x[7] <= 6)
+                      return '8';
+                    else
+                      return '7';
+                  }
+                  else
+                    return '7';
+                }
+                else
+                {
+                  if (x[8] <= 26)
+                  {
+                    if (x[9] <= 0)
+                      return '8';
+                    else
+                      return '7';
+                  }
+                  else
+                  {
+                    if (x[5] <= 16)
+                      return '7';
+                    else
+                      return '8';
+                  }
+                }
+              }
+              else
+              {
+                if (x[8] <= 27)
+                {
+                  if (x[4] <= 25)
+                  {
+                    if (x[1] <= 15)
+                      return '0';
+                    else
+                      return '7';
+                  }
+                  else
+                  {
+                    if (x[0] <= 30)
+                      return '7';
+                    else
+                      return '9';
+                  }
+                }
+                else
+                {
+                  if (x[0] <= 36)
+                    return '1';
+                  else
+                  {
+                    if (x[5] <= 25)
+                      return '0';
+                    else
+                      return '9';
+                  }
+                }
+              }
+            }
+          }
+          else
+          {
+            if (x[8] <= 23)
+            {
+              if (x[4] <= 33)
+              {
+                if (x[6] <= 11)
+                  return ',';
+                else
+                  return '.';
+              }
+              else
+              {
+                if (x[3] <= 7)
+                  return ',';
+                else
+                  return '?';
+              }
+            }
+            else
+            {
+              if (x[4] <= 38)
+              {
+                if (x[6] <= 39)
+                  return ',';
+                else
+                  return '.';
+              }
+              else
+              {
+                if (x[0] <= 34)
+                  return '?';
+                else
+                  return '.';
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+inline char cwTreeClassify(const int times[MAXTIMES], int unit)
+{
+  uint8_t x[MAXTIMES];
+  cwTreeFeatures(times, unit, x);
+  return cwTree0(x);
+}
+
+#endif
@@ -0,0 +1,31 @@
+/*
+ F4LAA : Préréglages du décodeur par conditions de réception (commande 'O')
+
+   Généré par tools/cwopt : ne pas modifier.
+   clean  : CER 1.4% (défauts 36.2%, nbSamples wpm 1.4%)
+   noisy  : CER 21.5% (défauts 86.5%, nbSamples wpm 36.4%)
+   fast   : CER 1.1% (défauts 44.9%, nbSamples wpm 3.3%)
+*/
+#ifndef DecoderPresets_h
+#define DecoderPresets_h
+
+#include <stdint.h>
+
+struct DecoderPreset
+{
+  const char *name;
+  uint8_t nbTime;
+  uint8_t magReactivity;
+  uint8_t spaceDetector;
+  uint8_t model;
+  int16_t nbSamples; // 0 : follows WPM
+};
+
+#define NBPRESETS 3
+static const DecoderPreset decoderPresets[NBPRESETS] = {
+  { "clean", 25, 120, 5, 1, 0 },
+  { "noisy", 10, 120, 5, 1, 180 },
+  { "fast", 10, 50, 5, 1, 120 },
+};
+
+#endif
@@ -0,0 +1,535 @@
+/*
+ F4LAA : Trie du WordCorrector
+
+   Généré par tools/mkdict/mkdict.py à partir de tools/mkdict/words.txt : ne pas modifier.
+   241 mots, 517 noeuds, 2068 octets (flash)
+*/
+#ifndef DictTrie_h
+#define DictTrie_h
+
+#include "WordCorrector.h"
+
+#define DICT_NBWORDS 241
+#define DICT_NBNODES 517
+
+static const DictNode dictTrie[DICT_NBNODES] = {
+  {   0, 0,    1 },
+  { '2', 0,   32 },
+  { '5', 0,   33 },
+  { '7', 0,   38 },
+  { '8', 0,   39 },
+  { '9', 0,   40 },
+  { 'a', 0,   41 },
+  { 'b', 0,   49 },
+  { 'c', 0,   53 },
+  { 'd', 0,   63 },
+  { 'e', 0,   78 },
+  { 'f', 0,   83 },
+  { 'g', 0,   89 },
+  { 'h', 0,   99 },
+  { 'i', 0,  107 },
+  { 'j', 0,  115 },
+  { 'k', 1,  118 },
+  { 'l', 0,  120 },
+  { 'm', 0,  126 },
+  { 'n', 0,  131 },
+  { 'o', 0,  136 },
+  { 'p', 0,  146 },
+  { 'q', 0,  153 },
+  { 'r', 1,  156 },
+  { 's', 0,  164 },
+  { 't', 0,  176 },
+  { 'u', 0,  184 },
+  { 'v', 0,  189 },
+  { 'w', 1,  194 },
+  { 'x', 0,  200 },
+  { 'y', 0,  202 },
+  { 'z', 2,  205 },
+  { 'e', 2,  207 },
+  { '5', 0,  208 },
+  { '7', 0,  209 },
+  { '8', 0,  210 },
+  { '9', 0,  211 },
+  { 'n', 2,  212 },
+  { '3', 3,    0 },
+  { '8', 3,    0 },
+  { 'a', 2,  213 },
+  { '@', 0,  214 },
+  { 'b', 0,  215 },
+  { 'g', 0,  216 },
+  { 'l', 0,  217 },
+  { 'n', 0,  218 },
+  { 'r', 1,  220 },
+  { 's', 1,    0 },
+  { 't', 3,    0 },
+  { 'c', 0,  221 },
+  { 'e', 0,  222 },
+  { 'k', 1,    0 },
+  { 't', 3,    0 },
+  { 'a', 0,  224 },
+  { 'e', 0,  225 },
+  { 'f', 0,  226 },
+  { 'l', 1,  227 },
+  { 'o', 0,  228 },
+  { 'p', 0,  229 },
+  { 'q', 1,    0 },
+  { 's', 0,  230 },
+  { 't', 0,  231 },
+  { 'u', 2,  232 },
+  { 'a', 0,  233 },
+  { 'b', 0,  234 },
+  { 'c', 0,  235 },
+  { 'd', 0,  236 },
+  { 'e', 1,  237 },
+  { 'f', 0,  238 },
+  { 'g', 0,  239 },
+  { 'h', 0,  240 },
+  { 'i', 0,  241 },
+  { 'j', 0,  242 },
+  { 'k', 0,  243 },
+  { 'l', 0,  244 },
+  { 'o', 0,  245 },
+  { 'r', 1,    0 },
+  { 'x', 3,    0 },
+  { 'a', 0,  247 },
+  { 'b', 0,  248 },
+  { 'c', 0,  249 },
+  { 'i', 0,  250 },
+  { 's', 3,  251 },
+  { '#', 0,  252 },
+  { 'b', 1,    0 },
+  { 'e', 0,  253 },
+  { 'i', 0,  254 },
+  { 'o', 0,  255 },
+  { 'r', 2,  256 },
+  { '#', 0,  257 },
+  { 'a', 1,    0 },
+  { 'e', 1,    0 },
+  { 'i', 0,  258 },
+  { 'l', 1,    0 },
+  { 'm', 1,  259 },
+  { 'n', 1,    0 },
+  { 'o', 0,  260 },
+  { 'u', 0,  261 },
+  { 'w', 2,  262 },
+  { 'a', 0,  263 },
+  { 'b', 0,  265 },
+  { 'e', 0,  267 },
+  { 'g', 0,  269 },
+  { 'i', 1,    0 },
+  { 'p', 0,  270 },
+  { 'r', 1,    0 },
+  { 'w', 3,  271 },
+  { '#', 0,  272 },
+  { 'k', 0,  273 },
+  { 'n', 1,    0 },
+  { 's', 1,    0 },
+  { 't', 1,    0 },
+  { 'u', 0,  274 },
+  { 'w', 0,  275 },
+  { 'z', 2,  276 },
+  { 'a', 0,  277 },
+  { 'h', 0,  278 },
+  { 'r', 2,  279 },
+  { '#', 0,  280 },
+  { 'n', 3,    0 },
+  { 'a', 0,  281 },
+  { 'b', 0,  282 },
+  { 'u', 0,  283 },
+  { 'x', 0,  285 },
+  { 'y', 0,  286 },
+  { 'z', 2,  287 },
+  { '#', 0,  288 },
+  { 'a', 0,  289 },
+  { 'e', 1,    0 },
+  { 'n', 0,  290 },
+  { 'y', 3,    0 },
+  { '#', 0,  291 },
+  { 'a', 0,  292 },
+  { 'o', 0,  293 },
+  { 'r', 1,    0 },
+  { 'w', 3,    0 },
+  { 'e', 0,  294 },
+  { 'h', 0,  295 },
+  { 'k', 1,  296 },
+  { 'l', 0,  297 },
+  { 'm', 1,  298 },
+  { 'n', 1,  299 },
+  { 'o', 0,  300 },
+  { 'p', 1,    0 },
+  { 'v', 0,  301 },
+  { 'z', 2,  302 },
+  { 'a', 1,  303 },
+  { 'd', 0,  304 },
+  { 'e', 0,  305 },
+  { 'p', 0,  306 },
+  { 's', 0,  307 },
+  { 'w', 0,  308 },
+  { 'y', 2,  309 },
+  { 'r', 0,  310 },
+  { 's', 0,  328 },
+  { 't', 2,  338 },
+  { '#', 0,  341 },
+  { 'a', 0,  342 },
+  { 'e', 0,  344 },
+  { 'i', 0,  345 },
+  { 'p', 0,  346 },
+  { 'r', 1,    0 },
+  { 's', 0,  347 },
+  { 'x', 3,    0 },
+  { '5', 0,  348 },
+  { 'a', 0,  349 },
+  { 'e', 0,  350 },
+  { 'i', 0,  351 },
+  { 'k', 1,    0 },
+  { 'm', 0,  352 },
+  { 'o', 0,  353 },
+  { 'p', 0,  354 },
+  { 'q', 0,  355 },
+  { 'r', 0,  356 },
+  { 't', 0,  357 },
+  { 'u', 2,  358 },
+  { 'e', 0,  359 },
+  { 'h', 0,  361 },
+  { 'k', 0,  364 },
+  { 'm', 0,  365 },
+  { 'n', 0,  366 },
+  { 'o', 1,    0 },
+  { 'u', 1,    0 },
+  { 'x', 3,    0 },
+  { 'a', 0,  367 },
+  { 'p', 1,    0 },
+  { 'r', 1,  368 },
+  { 't', 0,  369 },
+  { 'y', 2,  370 },
+  { 'a', 0,  371 },
+  { 'e', 0,  372 },
+  { 'k', 0,  374 },
+  { 'v', 0,  375 },
+  { 'y', 3,    0 },
+  { '#', 0,  376 },
+  { 'a', 0,  377 },
+  { 'e', 0,  378 },
+  { 'i', 0,  379 },
+  { 'p', 0,  380 },
+  { 'x', 3,    0 },
+  { 'e', 0,  381 },
+  { 'y', 2,  382 },
+  { 'a', 0,  383 },
+  { 'l', 1,  384 },
+  { 'o', 2,  385 },
+  { 'l', 0,  387 },
+  { 's', 2,  388 },
+  { '#', 2,  389 },
+  { '9', 3,    0 },
+  { '9', 3,    0 },
+  { '9', 3,    0 },
+  { '9', 3,    0 },
+  { 'n', 3,    0 },
+  { '#', 2,  390 },
+  { '#', 2,  391 },
+  { 't', 3,    0 },
+  { 'n', 3,  392 },
+  { 'l', 3,    0 },
+  { 'd', 1,    0 },
+  { 't', 3,    0 },
+  { 'e', 3,    0 },
+  { 'n', 2,  393 },
+  { 'a', 0,  394 },
+  { 's', 2,  395 },
+  { 'l', 2,  396 },
+  { '#', 2,  397 },
+  { 'm', 3,    0 },
+  { 'o', 2,  398 },
+  { 'n', 2,  399 },
+  { 'y', 3,    0 },
+  { '#', 2,  400 },
+  { '#', 2,  401 },
+  { 'l', 3,    0 },
+  { '#', 2,  402 },
+  { '#', 2,  403 },
+  { '#', 2,  404 },
+  { '#', 2,  405 },
+  { 'a', 2,  406 },
+  { '#', 2,  408 },
+  { '#', 2,  409 },
+  { '#', 2,  410 },
+  { 'p', 2,  411 },
+  { '#', 2,  412 },
+  { '#', 2,  413 },
+  { '#', 2,  414 },
+  { '#', 0,  415 },
+  { 'w', 2,  416 },
+  { '#', 2,  417 },
+  { '#', 2,  418 },
+  { '#', 2,  419 },
+  { '#', 2,  420 },
+  { '#', 2,  421 },
+  { '*', 3,    0 },
+  { 'r', 3,    0 },
+  { 'n', 2,  422 },
+  { 'r', 3,    0 },
+  { 'o', 2,  423 },
+  { '*', 3,    0 },
+  { '#', 2,  424 },
+  { '#', 2,  425 },
+  { 'o', 2,  426 },
+  { 'd', 3,    0 },
+  { '#', 2,  427 },
+  { '#', 0,  428 },
+  { 'v', 2,  429 },
+  { '#', 0,  430 },
+  { '9', 2,  431 },
+  { 'l', 0,  432 },
+  { 'r', 2,  433 },
+  { '#', 2,  434 },
+  { 'e', 3,    0 },
+  { '?', 3,    0 },
+  { '*', 3,    0 },
+  { '#', 2,  435 },
+  { '#', 2,  436 },
+  { '#', 2,  437 },
+  { '#', 2,  438 },
+  { '#', 2,  439 },
+  { '#', 2,  440 },
+  { '#', 2,  441 },
+  { '*', 3,    0 },
+  { '#', 2,  442 },
+  { '#', 2,  443 },
+  { '#', 0,  444 },
+  { 'c', 2,  445 },
+  { '#', 2,  446 },
+  { '#', 2,  447 },
+  { '#', 2,  448 },
+  { '*', 3,    0 },
+  { 'n', 3,    0 },
+  { 'i', 3,    0 },
+  { '*', 3,    0 },
+  { 'm', 2,  449 },
+  { 't', 3,    0 },
+  { '#', 2,  450 },
+  { '#', 2,  451 },
+  { '#', 2,  452 },
+  { 'd', 3,    0 },
+  { '#', 2,  453 },
+  { '#', 2,  454 },
+  { '#', 2,  455 },
+  { 'e', 2,  456 },
+  { '#', 2,  457 },
+  { '#', 2,  458 },
+  { '#', 2,  459 },
+  { '#', 2,  460 },
+  { '#', 2,  461 },
+  { 'e', 3,  462 },
+  { 'r', 3,    0 },
+  { '#', 2,  463 },
+  { 'a', 1,    0 },
+  { 'b', 1,    0 },
+  { 'g', 1,    0 },
+  { 'h', 1,    0 },
+  { 'i', 1,    0 },
+  { 'k', 1,    0 },
+  { 'l', 1,    0 },
+  { 'm', 1,    0 },
+  { 'n', 1,    0 },
+  { 'o', 1,    0 },
+  { 'p', 1,    0 },
+  { 'q', 1,    0 },
+  { 's', 1,    0 },
+  { 't', 1,    0 },
+  { 'u', 1,    0 },
+  { 'v', 1,  464 },
+  { 'x', 1,    0 },
+  { 'z', 3,  465 },
+  { 'a', 1,    0 },
+  { 'b', 1,    0 },
+  { 'd', 1,    0 },
+  { 'k', 1,    0 },
+  { 'l', 1,  466 },
+  { 'n', 1,    0 },
+  { 'o', 1,    0 },
+  { 'p', 1,    0 },
+  { 'y', 1,    0 },
+  { 'z', 3,    0 },
+  { 'c', 1,    0 },
+  { 'h', 1,  467 },
+  { 'r', 3,    0 },
+  { '*', 3,    0 },
+  { '#', 0,  468 },
+  { 'i', 2,  469 },
+  { 'f', 3,    0 },
+  { 'g', 3,    0 },
+  { 'r', 2,  470 },
+  { 't', 3,    0 },
+  { '#', 2,  471 },
+  { '#', 2,  472 },
+  { 'e', 3,    0 },
+  { 'g', 3,    0 },
+  { '#', 2,  473 },
+  { 'o', 2,  474 },
+  { '#', 2,  475 },
+  { '#', 2,  476 },
+  { 'i', 3,    0 },
+  { 'n', 3,    0 },
+  { 'n', 2,  477 },
+  { 'm', 0,  478 },
+  { 's', 2,  479 },
+  { 'a', 0,  480 },
+  { 'e', 1,  482 },
+  { 'i', 2,  483 },
+  { 's', 3,    0 },
+  { '#', 2,  484 },
+  { 'x', 3,    0 },
+  { '#', 2,  485 },
+  { '#', 2,  486 },
+  { '#', 2,  487 },
+  { '#', 2,  488 },
+  { '#', 2,  489 },
+  { '#', 0,  490 },
+  { 'r', 2,  491 },
+  { '#', 2,  492 },
+  { 'v', 3,    0 },
+  { '*', 3,    0 },
+  { 't', 2,  493 },
+  { 'l', 2,  494 },
+  { 't', 2,  495 },
+  { 'm', 3,    0 },
+  { '#', 2,  496 },
+  { 'l', 3,    0 },
+  { 'g', 2,  497 },
+  { '#', 2,  498 },
+  { '#', 0,  499 },
+  { 'u', 3,  500 },
+  { '#', 2,  501 },
+  { '#', 2,  502 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '?', 3,    0 },
+  { 'u', 3,    0 },
+  { 'c', 2,  503 },
+  { 't', 3,    0 },
+  { 'l', 3,    0 },
+  { '*', 3,    0 },
+  { 'u', 2,  504 },
+  { 't', 2,  505 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { 'd', 1,    0 },
+  { 'r', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { 'o', 2,  506 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { 'n', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { 'e', 3,    0 },
+  { 'm', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { 'd', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { 'e', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { 'l', 2,  507 },
+  { 'e', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { 'k', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { 'e', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { 'r', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '?', 3,    0 },
+  { '*', 3,    0 },
+  { '?', 3,    0 },
+  { '?', 3,    0 },
+  { '?', 3,    0 },
+  { '?', 3,    0 },
+  { '*', 3,    0 },
+  { 'n', 3,    0 },
+  { 't', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { 'n', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { 'n', 2,  508 },
+  { 'p', 3,    0 },
+  { 't', 3,    0 },
+  { 'n', 0,  509 },
+  { 't', 3,    0 },
+  { 'r', 2,  510 },
+  { 's', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { 'y', 3,    0 },
+  { '*', 3,    0 },
+  { 't', 3,    0 },
+  { 'l', 3,    0 },
+  { 'h', 3,    0 },
+  { '*', 3,    0 },
+  { 'i', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { 'r', 3,    0 },
+  { '*', 3,    0 },
+  { '*', 3,    0 },
+  { 'o', 2,  511 },
+  { 'd', 2,  512 },
+  { 'e', 2,  513 },
+  { 'l', 2,  514 },
+  { 'o', 3,    0 },
+  { 'y', 3,    0 },
+  { 'k', 2,  515 },
+  { 'e', 3,    0 },
+  { 'n', 3,    0 },
+  { 'y', 3,    0 },
+  { 's', 2,  516 },
+  { 'e', 3,    0 },
+  { 's', 3,    0 },
+  { 't', 3,    0 },
+};
+
+#endif
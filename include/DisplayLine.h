@@ -0,0 +1,50 @@
+/*
+ F4LAA : CW Decoder, lignes de texte décodé de l'écran TFT
+
+   La ligne en cours garde les nbChars derniers caractères avec leur confiance : elle est redessinée en
+   CONFLEVELS intensités de la couleur (les caractères de même intensité d'un coup), suivie de CodeBuffer.
+   Quand elle est pleine, elle est figée en blanc et la suivante commence en dessous (MAXLINES + 1 lignes,
+   puis retour en haut). Utilisé par le firmware et par tools/tftfb (écran simulé sur PC).
+*/
+#ifndef DisplayLine_h
+#define DisplayLine_h
+
+#include <stdint.h>
+
+class TFT_eSPI;
+
+#define nbChars 33     // Caractères par ligne
+#define CONFLEVELS 4   // Intensités de couleur affichées
+#define MAXLINES 9     // Dernière ligne
+#define LINE_TOP 60    // y de la première ligne
+#define LINE_HEIGHT 20
+#define CODE_X 394     // x de CodeBuffer, après la ligne
+
+// Color intensity according to confidence : CONFLEVELS levels, from 1/CONFLEVELS to full color
+int confLevel(uint8_t confidence);
+uint16_t confColor(uint16_t color, int level);
+
+class DisplayLine
+{
+  public:
+    explicit DisplayLine(TFT_eSPI &tft) : tft(tft) { clear(); }
+
+    void clear();                                        // Empty line, full confidence
+    void clearScreen();                                  // All the lines, back to the first one
+    void clearCode();                                    // CodeBuffer after the line
+    void draw(uint16_t color, const char *codeBuffer);   // The line then codeBuffer, at posRow()
+    void add(char c, uint8_t confidence, const char *codeBuffer); // Full : drawn in white, next row
+
+    int posRow() const { return LINE_TOP + row * LINE_HEIGHT; }
+
+    bool enabled = true; // false : nothing drawn (the line is still kept)
+    int row = 0;
+
+  private:
+    TFT_eSPI &tft;
+    char text[nbChars + 1];
+    uint8_t conf[nbChars];
+    int nbAdded = 0; // In this line
+};
+
+#endif
@@ -0,0 +1,116 @@
+/*
+ F4LAA : CW Decoder, journal d'événements de l'étage de décision
+
+   Buffer circulaire de taille fixe d'événements datés (ms) : fronts, hightimesavg, seuil (magnitudelimit),
+   éléments . / -, caractères de CodeToChar(), pas de l'autotune / AFC. Toujours actif : un événement
+   est une addition atomique (réservation de la case, donc sans verrou, même depuis une interruption)
+   et 12 octets écrits. Les plus anciens sont écrasés.
+   Le dump (commande 'J' : "EVENTS;<size>", puis entête et événements du plus ancien au plus récent)
+   est affiché en ligne de temps par tools/cwevents.
+   Chaque CWDecoder écrit dans le journal pointé par events (le firmware : eventTrace, partagé avec loop()),
+   aucun quand il est nul (outils PC, plusieurs décodeurs en parallèle).
+   -DEVTRACE_OFF : plus rien n'est enregistré.
+*/
+#ifndef EventTrace_h
+#define EventTrace_h
+
+#include <stdint.h>
+#include <atomic>
+
+#ifndef EVT_SIZE
+#define EVT_SIZE 1024 // Power of 2, 12 Ko
+#endif
+#define EVT_VERSION 1
+
+enum EventType
+{
+  EV_EDGE = 1,   // a : filteredstate, value : duration of the previous state (ms)
+  EV_REAL,       // a : realstate (before the noise blanker)
+  EV_HIGHAVG,    // value : hightimesavg, b : dotAvg (ms)
+  EV_THRESHOLD,  // value : magnitudelimit, when it moved by more than 1/8
+  EV_ELEMENT,    // a : '.' or '-', value : duration (ms), b : margin (%)
+  EV_CHAR,       // a : character ('{' : unknown code), b : nb of elements, value : code (1 then 0 = . 1 = -)
+  EV_TUNE,       // a : EV_TUNE_xxx, value : frequency (0.1 Hz)
+  EV_RESET       // resetTiming()
+};
+
+#define EV_TUNE_SCAN 0 // Autotune : next frequency of the scan
+#define EV_TUNE_AFC 1  // AFC : the measured frequency moved
+
+struct TraceEvent
+{
+  uint32_t t; // ms
+  uint8_t type;
+  uint8_t a;
+  int16_t b;
+  int32_t value;
+};
+
+struct EventTraceHeader
+{
+  char magic[4];      // "CWEV"
+  uint16_t version;
+  uint16_t eventSize; // sizeof(TraceEvent)
+  uint32_t nbEvents;  // In the dump
+  uint32_t nbTotal;   // Since boot : nbTotal - nbEvents were overwritten
+};
+
+typedef void (*EventWriter)(const void *data, int len);
+
+class EventTrace
+{
+  public:
+    inline void add(uint32_t t, uint8_t type, uint8_t a = 0, int16_t b = 0, int32_t value = 0)
+    {
+#ifndef EVTRACE_OFF
+      TraceEvent &e = events[head.fetch_add(1, std::memory_order_relaxed) & (EVT_SIZE - 1)];
+      e.t = t;
+      e.type = type;
+      e.a = a;
+      e.b = b;
+      e.value = value;
+#endif
+    }
+
+    // Only when it moved by more than 1/8 since the last one recorded
+    inline void threshold(uint32_t t, int32_t limit)
+    {
+      int32_t d = limit - lastThreshold;
+      if ((d > lastThreshold / 8) || (-d > lastThreshold / 8))
+      {
+        lastThreshold = limit;
+        add(t, EV_THRESHOLD, 0, 0, limit);
+      }
+    }
+
+    void dump(EventWriter write) const;
+    void clear() { head = 0; lastThreshold = 0; }
+    uint32_t nbTotal() const { return head; }
+
+  private:
+    std::atomic<uint32_t> head { 0 };
+    int32_t lastThreshold = 0;
+    TraceEvent events[EVT_SIZE];
+};
+
+// Oldest first, in 2 parts when the ring wraps around
+inline void EventTrace::dump(EventWriter write) const
+{
+  uint32_t total = head;
+  EventTraceHeader h;
+  h.magic[0] = 'C'; h.magic[1] = 'W'; h.magic[2] = 'E'; h.magic[3] = 'V';
+  h.version = EVT_VERSION;
+  h.eventSize = sizeof(TraceEvent);
+  h.nbEvents = (total < EVT_SIZE) ? total : EVT_SIZE;
+  h.nbTotal = total;
+  write(&h, sizeof(h));
+  int first = (total - h.nbEvents) & (EVT_SIZE - 1);
+  int n1 = EVT_SIZE - first;
+  if (n1 > (int) h.nbEvents)
+    n1 = h.nbEvents;
+  write(&events[first], n1 * sizeof(TraceEvent));
+  if (n1 < (int) h.nbEvents)
+    write(&events[0], (h.nbEvents - n1) * sizeof(TraceEvent));
+}
+
+#endif
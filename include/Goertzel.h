@@ -0,0 +1,50 @@
+/*
+ F4LAA : Goertzel filter used by the CW Decoder
+
+   Le coefficient est calculé directement à partir de la fréquence (omega = 2.PI.f/fs)
+   et non plus en arrondissant au bin k le plus proche : on peut donc accorder le filtre
+   au Hz près, ce qui est nécessaire pour l'AFC.
+*/
+#ifndef Goertzel_h
+#define Goertzel_h
+
+#include <math.h>
+
+class Goertzel
+{
+  public:
+    void setFreq(float freq, float samplingFreq)
+    {
+      coeff = 2.0 * cos((2.0 * M_PI * freq) / samplingFreq);
+    }
+
+    // Magnitude of the tone in data[0..n-1], centered on midpoint (ADC mid value)
+    float magnitude(const int *data, int n, int midpoint) const
+    {
+      float Q1 = 0;
+      float Q2 = 0;
+      for (int index = 0; index < n; index++)
+      {
+        float Q0 = (float)(data[index] - midpoint) + (coeff * Q1) - Q2;
+        Q2 = Q1;
+        Q1 = Q0;
+      }
+      return sqrt((Q1 * Q1) + (Q2 * Q2) - Q1 * Q2 * coeff);
+    }
+
+    float coeff = 2.0;
+};
+
+// Sub-bin peak estimation : parabolic interpolation of 3 magnitudes measured
+// at f - d, f and f + d. Returns the peak offset in units of d, in [-1..1].
+inline float goertzelPeakOffset(float left, float center, float right)
+{
+  if ((center < left) || (center < right))
+    return (left > right) ? -1.0 : 1.0; // Peak is outside [f - d, f + d]
+  float denom = left - (2 * center) + right;
+  if (denom == 0)
+    return 0;
+  return 0.5 * (left - right) / denom;
+}
+
+#endif
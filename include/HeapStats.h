@@ -0,0 +1,15 @@
+/*
+ F4LAA : CW Decoder, comptage des allocations sur le tas
+
+   Avec HEAP_STATS (platformio.ini : -DHEAP_STATS -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc),
+   chaque appel de malloc / calloc / realloc du firmware (String, new, bibliothèques) incrémente heapAllocs.
+   Sans HEAP_STATS, heapAllocs reste à 0 et rien n'est ajouté aux allocations.
+*/
+#ifndef HeapStats_h
+#define HeapStats_h
+
+#include <stdint.h>
+
+extern volatile uint32_t heapAllocs; // Since boot (approximate if both cores allocate at the same time)
+
+#endif
@@ -0,0 +1,82 @@
+/*
+ F4LAA : Capture binaire des blocs de l'étage de décision
+
+   Chaque bloc passé à CWDecoder::process() est rangé dans un buffer circulaire en RAM (16 octets) :
+   magnitude, seuil (magnitudelimit), états, paramètres du décodeur, temps depuis le bloc précédent,
+   et les appels resetTiming() / clearCodeBuffer() de loop() qui suivent le bloc.
+   Tous les CAP_SEGBLOCKS blocs, l'état complet du décodeur (CWDecoderState) est copié (keyframe) :
+   le dump commence au plus ancien keyframe encore complet.
+
+   Le dump (entête + blocs, little endian, même format sur l'ESP32 et sur PC) est rejoué par
+   tools/magreplay : mêmes seuils, mêmes états et mêmes caractères, sans l'étage DSP.
+*/
+#ifndef MagCapture_h
+#define MagCapture_h
+
+#include <stdint.h>
+#include "CWDecoder.h"
+
+#ifndef CAP_BLOCKS
+#define CAP_BLOCKS 2048    // 32 Ko, ~20s
+#endif
+#define CAP_SEGBLOCKS 256  // Blocks between 2 keyframes
+#define CAP_SEGMENTS (CAP_BLOCKS / CAP_SEGBLOCKS)
+#define CAP_VERSION 1
+
+// Flags of a block
+#define CAP_HIGH 1     // filteredstate after the block
+#define CAP_REAL 2     // realstate after the block
+#define CAP_DECODE 4   // process(..., decode)
+#define CAP_ADAPTIVE 8 // model
+#define CAP_RESET 16   // resetTiming() after the block
+#define CAP_CLEAR 32   // clearCodeBuffer() after the block
+
+struct CaptureBlock
+{
+  float magnitude;
+  int32_t threshold; // magnitudelimit after the block
+  uint16_t dt;       // ms since the previous block
+  uint8_t flags;
+  uint8_t nbTime;
+  uint8_t magReactivity;
+  uint8_t spaceDetector;
+  uint8_t nbSamples; // Goertzel block (information)
+  uint8_t reserved;
+};
+
+struct CaptureHeader
+{
+  char magic[4];        // "CWCP"
+  uint16_t version;
+  uint16_t blockSize;   // sizeof(CaptureBlock)
+  uint32_t stateSize;   // sizeof(CWDecoderState)
+  uint32_t nbBlocks;
+  float sampleRate;     // ADC (measured)
+  float processingRate; // Goertzel
+  float freq;           // At dump time
+  CWDecoderState state; // Before the first block
+};
+
+typedef void (*CaptureWriter)(const void *data, int len);
+
+class MagCapture
+{
+  public:
+    MagCapture() { clear(); }
+
+    // decoder.process(), with the keyframe before and the block after
+    void process(CWDecoder &decoder, float magnitude, unsigned long now, bool decode, int nbSamples);
+    void event(uint8_t flag) { if (nbTotal) blocks[(nbTotal - 1) % CAP_BLOCKS].flags |= flag; }
+    void clear() { nbTotal = 0; }
+
+    int nbBlocks() const; // In the dump
+    int dumpSize() const { return sizeof(CaptureHeader) + nbBlocks() * sizeof(CaptureBlock); }
+    void dump(CaptureWriter write, float sampleRate, float processingRate, float freq) const;
+
+  private:
+    CaptureBlock blocks[CAP_BLOCKS];
+    CWDecoderState keys[CAP_SEGMENTS];
+    uint32_t nbTotal;
+};
+
+#endif
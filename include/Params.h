@@ -0,0 +1,117 @@
+/*
+ F4LAA : CW Decoder, registre des paramètres réglables
+
+   Une table de ParamDef (lettre de la commande, nom, bornes, pas, unité, variable, effet d'un changement,
+   texte affiché) décrit chaque paramètre une seule fois ; le menu du bouton rotatif, les commandes
+   série et la sauvegarde (NVS) passent tous par le registre.
+   Commandes série (une par ligne) : "?" liste, "nom" valeur, "nom=v", "nom+" / "nom-" un pas,
+   "save" sauvegarde immédiate. La lettre de la commande peut remplacer le nom.
+
+   ParamSnapshot : les paramètres de l'étage DSP sont modifiés dans une copie, publiée d'un coup ;
+   loop() la relit au début d'un bloc seulement (seqlock : jamais un bloc avec la moitié d'un changement).
+*/
+#ifndef Params_h
+#define Params_h
+
+#include <stdint.h>
+#include <atomic>
+#include "TextBuf.h"
+
+#define PARAM_TEXTSIZE 24
+typedef TextBuf<PARAM_TEXTSIZE> ParamText;
+
+enum ParamType
+{
+  PARAM_INT,    // int, clamped to [min..max]
+  PARAM_ENUM,   // int, wraps around [min..max] (choices)
+  PARAM_BOOL,   // bool, toggled by one step
+  PARAM_ACTION  // no value : apply() on each step (dumps)
+};
+
+#define PARAM_PERSIST 1 // Saved, loaded at boot
+#define PARAM_ACCEL 2   // Rotary acceleration
+#define PARAM_NOMENU 4  // Serial only
+
+struct ParamDef
+{
+  char cde;            // Letter of the rotary menu and the serial commands
+  const char *name;    // Serial commands and storage key (15 chars max)
+  const char *label;   // Menu text
+  uint8_t type;        // PARAM_xxx
+  int16_t min;
+  int16_t max;
+  int16_t step;
+  const char *unit;
+  void *value;                    // int * (PARAM_INT, PARAM_ENUM) or bool * (PARAM_BOOL)
+  void (*apply)();                // After a change (0 : none), the action of PARAM_ACTION
+  void (*format)(ParamText &text); // Menu text (0 : label and value)
+  uint8_t flags;
+};
+
+typedef void (*ParamReply)(const char *text);
+typedef void (*ParamWriter)(const char *key, int32_t value);
+typedef int32_t (*ParamReader)(const char *key, int32_t defaultValue);
+
+class ParamRegistry
+{
+  public:
+    ParamRegistry(const ParamDef *defs, int nb) : defs(defs), nbParams(nb) {}
+
+    const ParamDef *find(char cde) const;
+    const ParamDef *find(const char *name) const;
+    int index(char cde) const; // -1 : unknown
+
+    int32_t get(const ParamDef &p) const;
+    void set(const ParamDef &p, int32_t v); // Clamped (or wrapped), then apply()
+    void step(const ParamDef &p, int n);    // n steps (< 0 : down)
+    void text(const ParamDef &p, ParamText &text) const;
+    int nextMenu(int i) const;              // Next index shown in the menu
+
+    void command(const char *line, ParamReply reply);
+    void save(ParamWriter write) const;     // PARAM_PERSIST only
+    void load(ParamReader read);
+
+    const ParamDef *defs;
+    int nbParams;
+    uint32_t changes = 0;   // Incremented by each change
+    bool saveRequested = false; // Serial "save"
+
+  private:
+    void reply(const ParamDef &p, ParamReply out) const;
+};
+
+// Single writer (UI) / single reader (DSP loop)
+template <class T> class ParamSnapshot
+{
+  public:
+    void publish(const T &v)
+    {
+      uint32_t s = seq.load(std::memory_order_relaxed);
+      seq.store(s + 1, std::memory_order_relaxed); // Odd : being written
+      std::atomic_thread_fence(std::memory_order_release);
+      data = v;
+      seq.store(s + 2, std::memory_order_release);
+    }
+
+    // The last published copy, if complete and not read yet
+    bool read(T &v)
+    {
+      uint32_t s = seq.load(std::memory_order_acquire);
+      if ((s & 1) || (s == lastRead))
+        return false;
+      T copy = data;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (seq.load(std::memory_order_relaxed) != s)
+        return false; // Published meanwhile : next block
+      v = copy;
+      lastRead = s;
+      return true;
+    }
+
+  private:
+    std::atomic<uint32_t> seq { 0 };
+    uint32_t lastRead = 0;
+    T data;
+};
+
+#endif
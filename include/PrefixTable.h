@@ -0,0 +1,2261 @@
+/*
+ F4LAA : Table des préfixes d'indicatifs ==> pays (SpotExtractor)
+
+   Généré par tools/mkprefix/mkprefix.py à partir de tools/mkprefix/prefixes.txt : ne pas modifier.
+   568 préfixes, 183 pays, 2048 cases, 2 sondages max
+*/
+#ifndef PrefixTable_h
+#define PrefixTable_h
+
+#include <stdint.h>
+
+#define PREFIX_MAXLEN 4
+#define PREFIX_HASHSIZE 2048
+#define PREFIX_HASHSEED 33
+#define PREFIX_MAXPROBE 2
+#define PREFIX_NBCOUNTRIES 183
+
+struct PrefixSlot
+{
+  char prefix[PREFIX_MAXLEN]; // Not \0 terminated when 4 chars, empty slot : ""
+  uint8_t country;
+};
+
+static const char *const prefixCountries[PREFIX_NBCOUNTRIES] = {
+  "France",
+  "Corsica",
+  "Guadeloupe",
+  "Martinique",
+  "Reunion",
+  "French Guiana",
+  "New Caledonia",
+  "French Polynesia",
+  "St Pierre & Miquelon",
+  "England",
+  "Wales",
+  "Scotland",
+  "Northern Ireland",
+  "Isle of Man",
+  "Jersey",
+  "Guernsey",
+  "Ireland",
+  "Belgium",
+  "Netherlands",
+  "Germany",
+  "Switzerland",
+  "Liechtenstein",
+  "Austria",
+  "Italy",
+  "Sardinia",
+  "Sicily",
+  "Spain",
+  "Balearic Is",
+  "Canary Is",
+  "Ceuta & Melilla",
+  "Portugal",
+  "Madeira",
+  "Azores",
+  "Andorra",
+  "Monaco",
+  "Luxembourg",
+  "Gibraltar",
+  "Malta",
+  "San Marino",
+  "Vatican",
+  "Poland",
+  "Czech Republic",
+  "Slovakia",
+  "Hungary",
+  "Romania",
+  "Bulgaria",
+  "Greece",
+  "Dodecanese",
+  "Crete",
+  "Croatia",
+  "Slovenia",
+  "Bosnia-Herzegovina",
+  "Serbia",
+  "North Macedonia",
+  "Montenegro",
+  "Albania",
+  "Lithuania",
+  "Latvia",
+  "Estonia",
+  "Finland",
+  "Aland Is",
+  "Sweden",
+  "Norway",
+  "Denmark",
+  "Faroe Is",
+  "Iceland",
+  "Greenland",
+  "Svalbard",
+  "European Russia",
+  "Kaliningrad",
+  "Asiatic Russia",
+  "Ukraine",
+  "Belarus",
+  "Moldova",
+  "Georgia",
+  "Armenia",
+  "Azerbaijan",
+  "Uzbekistan",
+  "Turkey",
+  "Israel",
+  "Lebanon",
+  "Cyprus",
+  "Syria",
+  "Jordan",
+  "Saudi Arabia",
+  "United Arab Emirates",
+  "Qatar",
+  "Bahrain",
+  "Oman",
+  "Kuwait",
+  "Iran",
+  "Iraq",
+  "Egypt",
+  "Morocco",
+  "Algeria",
+  "Tunisia",
+  "Libya",
+  "Senegal",
+  "Ivory Coast",
+  "Nigeria",
+  "Ghana",
+  "Tanzania",
+  "Kenya",
+  "Uganda",
+  "Zambia",
+  "Zimbabwe",
+  "Botswana",
+  "Namibia",
+  "South Africa",
+  "Madagascar",
+  "Mauritius",
+  "Cape Verde",
+  "United States",
+  "Hawaii",
+  "Alaska",
+  "Puerto Rico",
+  "US Virgin Is",
+  "Guam",
+  "Canada",
+  "Mexico",
+  "Costa Rica",
+  "Panama",
+  "Honduras",
+  "Guatemala",
+  "Nicaragua",
+  "El Salvador",
+  "Cuba",
+  "Dominican Republic",
+  "Haiti",
+  "Jamaica",
+  "Barbados",
+  "Grenada",
+  "St Lucia",
+  "Dominica",
+  "Antigua",
+  "Curacao & Bonaire",
+  "Aruba",
+  "Argentina",
+  "Brazil",
+  "Chile",
+  "Easter Is",
+  "Uruguay",
+  "Paraguay",
+  "Bolivia",
+  "Peru",
+  "Ecuador",
+  "Colombia",
+  "Venezuela",
+  "Guyana",
+  "Suriname",
+  "Japan",
+  "Korea",
+  "Taiwan",
+  "China",
+  "Hong Kong",
+  "Macao",
+  "India",
+  "Sri Lanka",
+  "Pakistan",
+  "Bangladesh",
+  "Nepal",
+  "Thailand",
+  "Vietnam",
+  "Laos",
+  "Cambodia",
+  "Myanmar",
+  "Singapore",
+  "West Malaysia",
+  "East Malaysia",
+  "Philippines",
+  "Indonesia",
+  "Australia",
+  "New Zealand",
+  "Papua New Guinea",
+  "Fiji",
+  "Samoa",
+  "Tonga",
+  "Mongolia",
+  "Kazakhstan",
+  "Kyrgyzstan",
+  "Tajikistan",
+  "Turkmenistan",
+  "Afghanistan",
+};
+
+static const PrefixSlot prefixTable[PREFIX_HASHSIZE] = {
+  { "", 0 },
+  { { 'i', 'l' }, 23 },
+  { { '8', 'b' }, 170 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'a', 'b' }, 112 },
+  { { 's', 'm' }, 61 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'f', 'y' }, 5 },
+  { "", 0 },
+  { "", 0 },
+  { { 'o', 'a' }, 144 },
+  { { 'y', 'l' }, 57 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', '7' }, 151 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'k' }, 112 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'e', '9' }, 29 },
+  { { 'i', 'a' }, 23 },
+  { { '8', 'e' }, 170 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'a', 'g' }, 112 },
+  { { 's', 'f' }, 61 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'o', 'z' }, 63 },
+  { { 'y', 'a' }, 182 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'w', 'l', '7' }, 114 },
+  { "", 0 },
+  { { 'h', 'z' }, 84 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', 'o' }, 19 },
+  { { 'n' }, 112 },
+  { "", 0 },
+  { { 's', 'v', '9' }, 48 },
+  { "", 0 },
+  { "", 0 },
+  { { 'i', 'f' }, 23 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'q' }, 90 },
+  { { 'j', 'w' }, 67 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'w', 'p', '2' }, 116 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'o', 'w' }, 63 },
+  { { 'y', 'f' }, 170 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', 'j' }, 19 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'r', 't' }, 68 },
+  { "", 0 },
+  { "", 0 },
+  { { '8', 's' }, 61 },
+  { "", 0 },
+  { "", 0 },
+  { { 'j', 'r' }, 150 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '5', 'h' }, 101 },
+  { { 'a', '4' }, 88 },
+  { { 'o', 'p' }, 17 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'h', 'p' }, 121 },
+  { { 'r', '6' }, 68 },
+  { "", 0 },
+  { { 'd', 'e' }, 19 },
+  { "", 0 },
+  { "", 0 },
+  { { 'u', 'a', '0' }, 70 },
+  { { '7', 'x' }, 94 },
+  { "", 0 },
+  { { 'i', 'p' }, 23 },
+  { { 's', '2' }, 159 },
+  { "", 0 },
+  { "", 0 },
+  { { 'j', 'y' }, 83 },
+  { "", 0 },
+  { "", 0 },
+  { { 's', 'q' }, 40 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'f', 'm' }, 3 },
+  { { 'a', '9' }, 87 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 't', 'i' }, 120 },
+  { "", 0 },
+  { { 'h', 'k' }, 146 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'l', 'c' }, 62 },
+  { "", 0 },
+  { "", 0 },
+  { { '7', 'e' }, 170 },
+  { { 'r', 'n' }, 68 },
+  { { 'i', 'u' }, 23 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'j', 'd' }, 150 },
+  { "", 0 },
+  { "", 0 },
+  { { 'v', 'i' }, 171 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '5', 'b' }, 81 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'k', 'l', '7' }, 114 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'l', 'n' }, 62 },
+  { "", 0 },
+  { "", 0 },
+  { { '7', 'n' }, 150 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'j', 'c' }, 150 },
+  { "", 0 },
+  { "", 0 },
+  { { 'v', 'l' }, 171 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'f', 'g' }, 2 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'h', 'a' }, 43 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'l', 'i' }, 62 },
+  { "", 0 },
+  { "", 0 },
+  { { '7', 'k' }, 150 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'r', 'a', '0' }, 70 },
+  { { 'j', 'n' }, 150 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '9', 'a' }, 49 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'x', 'f' }, 119 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'h', 'd' }, 145 },
+  { { 'p', 'g' }, 18 },
+  { "", 0 },
+  { "", 0 },
+  { { 'l', 't' }, 137 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'z', 'b' }, 36 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'u', '9' }, 70 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'c', 'r', '3' }, 31 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'b', 'z' }, 153 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 't', 'u' }, 98 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'u', '6' }, 68 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'o' }, 71 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'v', 'r', '2' }, 154 },
+  { "", 0 },
+  { { 'n', 'h', '6' }, 113 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 't', 'p' }, 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'l', 'z' }, 45 },
+  { { '6', 'k' }, 151 },
+  { "", 0 },
+  { { 'u', 'p' }, 178 },
+  { { 'p', '2' }, 173 },
+  { { 'z', 't' }, 108 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'u', '3' }, 68 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'd' }, 26 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'v', '5' }, 107 },
+  { { 'x', 'w' }, 163 },
+  { { '4', 'i' }, 169 },
+  { { 'e', 'f', '6' }, 27 },
+  { "", 0 },
+  { { 'c', 'o' }, 126 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'y', 'q' }, 44 },
+  { "", 0 },
+  { { 'p', 'p' }, 138 },
+  { "", 0 },
+  { "", 0 },
+  { { 'g', 'd' }, 13 },
+  { { '6', 'n' }, 151 },
+  { "", 0 },
+  { "", 0 },
+  { { 'z', 's' }, 108 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '8', 'h' }, 170 },
+  { "", 0 },
+  { { 'e', 'a' }, 26 },
+  { { '3', 'b', '8' }, 110 },
+  { "", 0 },
+  { "", 0 },
+  { { 's', 'k' }, 61 },
+  { "", 0 },
+  { { '4', 'd' }, 169 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'y', 'v' }, 147 },
+  { "", 0 },
+  { { '2', 'e' }, 9 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', 'z' }, 169 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'i', 'k' }, 23 },
+  { { '8', 'c' }, 170 },
+  { "", 0 },
+  { "", 0 },
+  { { '9', 'm', '6' }, 168 },
+  { { 'k', 'p', '4' }, 115 },
+  { { 'a', 'a' }, 112 },
+  { { 's', 'l' }, 61 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'c', 'e' }, 139 },
+  { { '5', 'x' }, 103 },
+  { "", 0 },
+  { "", 0 },
+  { { 'y', 'k' }, 82 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', '8' }, 151 },
+  { { 'g', 'j' }, 14 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', 'u' }, 169 },
+  { "", 0 },
+  { "", 0 },
+  { { 'm', 'm' }, 11 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '8', 'f' }, 170 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'a', 'f' }, 112 },
+  { { 's', 'a' }, 61 },
+  { { 'w', 'p', '4' }, 115 },
+  { { '4', 'z' }, 79 },
+  { "", 0 },
+  { "", 0 },
+  { { 'r', 'k', '0' }, 70 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'g', 'w' }, 10 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', 'p' }, 19 },
+  { "", 0 },
+  { "", 0 },
+  { { 'm', 'j' }, 14 },
+  { "", 0 },
+  { "", 0 },
+  { { 'i', 'e' }, 23 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'p' }, 90 },
+  { { 'j', 't' }, 177 },
+  { "", 0 },
+  { { 'a', 'k' }, 112 },
+  { { 's', 'z' }, 46 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'f', 'p' }, 8 },
+  { { '5', 'r' }, 109 },
+  { "", 0 },
+  { { 'o', 'v' }, 63 },
+  { { 'y', 'e' }, 170 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'r', '8' }, 68 },
+  { "", 0 },
+  { { 'c', 't', '3' }, 31 },
+  { { 'd', 'k' }, 19 },
+  { "", 0 },
+  { { 'e', '2' }, 161 },
+  { { 'j', '6' }, 132 },
+  { { 'r', 'u' }, 68 },
+  { "", 0 },
+  { { 'i', 'z' }, 23 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'j', 's' }, 150 },
+  { "", 0 },
+  { { 'a', 'p' }, 158 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'a', '3' }, 176 },
+  { "", 0 },
+  { { 'o', 's' }, 17 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'r', '7' }, 68 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', 'f' }, 19 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 's', 'p' }, 40 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'r', '2' }, 68 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', 'a' }, 19 },
+  { { 'l', 'd' }, 62 },
+  { "", 0 },
+  { "", 0 },
+  { { '7', 'd' }, 170 },
+  { { 'r', 'o' }, 68 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'j', 'e' }, 150 },
+  { "", 0 },
+  { { 'a', 'z' }, 137 },
+  { { 's', 'u' }, 92 },
+  { "", 0 },
+  { "", 0 },
+  { { '9', 'v' }, 166 },
+  { "", 0 },
+  { "", 0 },
+  { { '5', 'a' }, 96 },
+  { "", 0 },
+  { { 'b', 'j' }, 153 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'l', 'o' }, 137 },
+  { "", 0 },
+  { "", 0 },
+  { { '7', 'a' }, 170 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'v', 'm' }, 171 },
+  { "", 0 },
+  { { '3', 'd', '2' }, 174 },
+  { { '9', 'k' }, 89 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'x', 'l' }, 118 },
+  { { 'b', 'a' }, 153 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'c', 'z' }, 118 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'h', 'b' }, 20 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'l', 'j' }, 62 },
+  { "", 0 },
+  { "", 0 },
+  { { '7', 'j' }, 150 },
+  { { 'r', 'a' }, 68 },
+  { "", 0 },
+  { { '3', 'a' }, 34 },
+  { "", 0 },
+  { "", 0 },
+  { { 'j', 'o' }, 150 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'c', '6' }, 27 },
+  { { 'h', 'e' }, 20 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'l', 'u' }, 137 },
+  { "", 0 },
+  { { 'a', 'h', '6' }, 113 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '3', 'z' }, 40 },
+  { "", 0 },
+  { "", 0 },
+  { { 'j', 'j' }, 150 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'x', 'z' }, 165 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'c', 'p' }, 143 },
+  { "", 0 },
+  { "", 0 },
+  { { 't', 'v' }, 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'h', '6' }, 27 },
+  { "", 0 },
+  { "", 0 },
+  { { 'l', 'p' }, 137 },
+  { "", 0 },
+  { "", 0 },
+  { { 'u', 'z' }, 71 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'r', 'a', '9' }, 70 },
+  { "", 0 },
+  { { 'u', '5' }, 68 },
+  { "", 0 },
+  { { 'v', 'z' }, 171 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'n' }, 71 },
+  { "", 0 },
+  { { 'i', 'y', '9' }, 25 },
+  { "", 0 },
+  { "", 0 },
+  { { 'b', 'v' }, 152 },
+  { { '4', 'o' }, 54 },
+  { "", 0 },
+  { "", 0 },
+  { { 'c', 'u' }, 32 },
+  { "", 0 },
+  { "", 0 },
+  { { 't', 'q' }, 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'u', 'w' }, 71 },
+  { { 'p', '3' }, 81 },
+  { { 'z', 'u' }, 108 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'u', '2' }, 69 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'k' }, 75 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'v', '2' }, 134 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'c', 'n' }, 93 },
+  { "", 0 },
+  { "", 0 },
+  { { 'o', 'm' }, 42 },
+  { { 'y', 'p' }, 44 },
+  { "", 0 },
+  { { 'p', 'q' }, 138 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'z', 'p' }, 142 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '8', 'i' }, 170 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 's', 'j' }, 61 },
+  { "", 0 },
+  { { '4', 'e' }, 169 },
+  { "", 0 },
+  { "", 0 },
+  { { 'c', 'c' }, 139 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'y', 'u' }, 52 },
+  { "", 0 },
+  { { 'p', 't' }, 138 },
+  { { 'z', '2' }, 105 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 's', 'v', '5' }, 47 },
+  { "", 0 },
+  { "", 0 },
+  { { 'i', 'j' }, 23 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 's', 'o' }, 40 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'c', 'd' }, 139 },
+  { "", 0 },
+  { "", 0 },
+  { { 'o', 'c' }, 144 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', '9' }, 151 },
+  { { 'g', 'm' }, 11 },
+  { { '6', 'y' }, 129 },
+  { "", 0 },
+  { "", 0 },
+  { { 'z', 'z' }, 138 },
+  { { 'c', 't', '8' }, 32 },
+  { { 'd', 'v' }, 169 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'i', 'o' }, 23 },
+  { { '8', 'g' }, 170 },
+  { "", 0 },
+  { { 'e', 'z' }, 181 },
+  { "", 0 },
+  { "", 0 },
+  { { 'a', 'e' }, 112 },
+  { "", 0 },
+  { "", 0 },
+  { { 'o', 'h', '0' }, 60 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'y', 'o' }, 44 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', '4' }, 111 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', 'q' }, 19 },
+  { "", 0 },
+  { "", 0 },
+  { { 'm', 'i' }, 12 },
+  { "", 0 },
+  { "", 0 },
+  { { 'i', 'd' }, 23 },
+  { "", 0 },
+  { { 'c', 'e', '0', 'y' }, 140 },
+  { { 'e', 'w' }, 72 },
+  { "", 0 },
+  { "", 0 },
+  { { 'a', 'j' }, 112 },
+  { { 's', 'e' }, 61 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '5', 'q' }, 63 },
+  { "", 0 },
+  { { 'o', 'y' }, 64 },
+  { { 'y', 'd' }, 170 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'r', '9' }, 70 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', 'l' }, 19 },
+  { "", 0 },
+  { "", 0 },
+  { { 'j', '7' }, 133 },
+  { { 'r', 'z' }, 68 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'j', 'p' }, 150 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'r', 'k', '9' }, 70 },
+  { { '5', 'n' }, 99 },
+  { { 'a', '2' }, 106 },
+  { { 'o', 'r' }, 17 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'h', 'r' }, 122 },
+  { { 'r', '4' }, 68 },
+  { "", 0 },
+  { { 'd', 'g' }, 19 },
+  { { 'f' }, 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '7', 'z' }, 84 },
+  { { 'r', 'q' }, 68 },
+  { "", 0 },
+  { { '8', 'p' }, 130 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'a', 't' }, 156 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'f', 'k' }, 6 },
+  { { '5', 'k' }, 146 },
+  { { 'a', '7' }, 86 },
+  { { 'b', 'l' }, 153 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 't', 'k' }, 1 },
+  { "", 0 },
+  { { 'r', '3' }, 68 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', 'b' }, 19 },
+  { { 'l', 'e' }, 62 },
+  { "", 0 },
+  { "", 0 },
+  { { '7', 'g' }, 170 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'a', 'y' }, 137 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 't', 'f' }, 65 },
+  { "", 0 },
+  { { 'h', 'h' }, 128 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'j', 'a' }, 150 },
+  { "", 0 },
+  { "", 0 },
+  { { 'v', 'j' }, 171 },
+  { "", 0 },
+  { "", 0 },
+  { { '9', 'j' }, 104 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'x', 'm' }, 118 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 't', 'a' }, 78 },
+  { "", 0 },
+  { { 'h', 'c' }, 145 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'l', 'k' }, 62 },
+  { "", 0 },
+  { "", 0 },
+  { { '7', 'm' }, 150 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'r', 'a', '2' }, 69 },
+  { { 'j', 'l' }, 150 },
+  { "", 0 },
+  { "", 0 },
+  { { 'v', 'a' }, 118 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'h', 'f' }, 40 },
+  { { 'p', 'a' }, 18 },
+  { "", 0 },
+  { "", 0 },
+  { { 'l', 'v' }, 137 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'b', '9' }, 29 },
+  { "", 0 },
+  { { 'p', 'j', '2' }, 135 },
+  { "", 0 },
+  { "", 0 },
+  { { 'j', 'k' }, 150 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'b', 'x' }, 152 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'c', 's' }, 30 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'h', '9' }, 29 },
+  { { 'p', 'd' }, 18 },
+  { "", 0 },
+  { { 'l', 'q' }, 137 },
+  { "", 0 },
+  { "", 0 },
+  { { 'u', 'y' }, 71 },
+  { { 'e', 'b', '6' }, 27 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'm', 'w' }, 10 },
+  { { 'u', '4' }, 68 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'm' }, 71 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'c', 't' }, 30 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'n', 'p', '2' }, 116 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'u', 'v' }, 71 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'u', '1' }, 68 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'j' }, 16 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'x', 'q' }, 139 },
+  { "", 0 },
+  { { '4', 'k' }, 76 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'o', 'l' }, 41 },
+  { "", 0 },
+  { "", 0 },
+  { { 'p', 'r' }, 138 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '6', 'l' }, 151 },
+  { "", 0 },
+  { { 'u', 's' }, 71 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'v', 'u' }, 156 },
+  { { '8', 'j' }, 150 },
+  { "", 0 },
+  { { 'e', 'g' }, 26 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '4', 'f' }, 169 },
+  { { 'e', 'f', '9' }, 29 },
+  { "", 0 },
+  { { 'c', 'b' }, 139 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'y', 't' }, 52 },
+  { "", 0 },
+  { { 'p', 'u' }, 138 },
+  { { 'z', '3' }, 53 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'i', 'i' }, 23 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '9', 'm', '4' }, 167 },
+  { { 'k', 'p', '2' }, 116 },
+  { { 'w', 'h', '6' }, 113 },
+  { { 's', 'n' }, 40 },
+  { "", 0 },
+  { { '4', 'a' }, 119 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'o', 'b' }, 144 },
+  { { 'y', 'i' }, 91 },
+  { "", 0 },
+  { { 'p', 'x' }, 138 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', 'w' }, 169 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'y' }, 180 },
+  { "", 0 },
+  { "", 0 },
+  { { 'a', 'd' }, 112 },
+  { { 's', 'c' }, 61 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'y', 'n' }, 124 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'g', 'i' }, 12 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', 'r' }, 19 },
+  { { 'i' }, 23 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'i', 'c' }, 23 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'v' }, 72 },
+  { "", 0 },
+  { "", 0 },
+  { { 'a', 'i' }, 112 },
+  { { 's', 'd' }, 61 },
+  { { 'e', 'd', '9' }, 29 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '5', 'p' }, 63 },
+  { "", 0 },
+  { { 'o', 'x' }, 66 },
+  { { 'y', 'c' }, 170 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', 'm' }, 19 },
+  { "", 0 },
+  { "", 0 },
+  { { 'j', '4' }, 46 },
+  { "", 0 },
+  { { 'e', 'e', '6' }, 27 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 's' }, 58 },
+  { { 'j', 'q' }, 150 },
+  { "", 0 },
+  { "", 0 },
+  { { 's', 'y' }, 46 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'o', 'u' }, 63 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '6', 'w' }, 97 },
+  { "", 0 },
+  { { 'h', 's' }, 161 },
+  { { 'r', '5' }, 68 },
+  { "", 0 },
+  { { 'd', 'h' }, 19 },
+  { { 'g' }, 9 },
+  { "", 0 },
+  { { 'j', '3' }, 131 },
+  { { 'r', 'v' }, 68 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 's', 'r' }, 40 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '5', 'j' }, 146 },
+  { { 'a', '6' }, 85 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'h', 'v' }, 39 },
+  { { 'r', '0' }, 70 },
+  { "", 0 },
+  { { 'd', 'c' }, 19 },
+  { { 'l', 'f' }, 62 },
+  { "", 0 },
+  { { 'u', 'a', '2' }, 69 },
+  { { '7', 'f' }, 170 },
+  { "", 0 },
+  { { 'i', 'r' }, 23 },
+  { "", 0 },
+  { "", 0 },
+  { { 'r', '2', 'f' }, 69 },
+  { "", 0 },
+  { "", 0 },
+  { { 'a', 'x' }, 171 },
+  { { 's', 'w' }, 46 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'f', 'o' }, 7 },
+  { "", 0 },
+  { "", 0 },
+  { { 'b', 'h' }, 153 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 't', 'g' }, 123 },
+  { "", 0 },
+  { { 'h', 'i' }, 127 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'l', 'a' }, 62 },
+  { "", 0 },
+  { "", 0 },
+  { { '7', 'c' }, 170 },
+  { "", 0 },
+  { { 'i', 'w' }, 23 },
+  { { 's', '5' }, 50 },
+  { "", 0 },
+  { "", 0 },
+  { { 'j', 'f' }, 150 },
+  { "", 0 },
+  { "", 0 },
+  { { 'v', 'k' }, 171 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'b', 'g' }, 153 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 't', 'b' }, 78 },
+  { "", 0 },
+  { { 'h', 'l' }, 151 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'l', 'l' }, 62 },
+  { "", 0 },
+  { "", 0 },
+  { { '7', 'l' }, 150 },
+  { "", 0 },
+  { "", 0 },
+  { { 'p', 'j', '4' }, 135 },
+  { "", 0 },
+  { "", 0 },
+  { { 'j', 'm' }, 150 },
+  { "", 0 },
+  { { 'k', 'h', '2' }, 117 },
+  { { 'v', 'n' }, 171 },
+  { "", 0 },
+  { "", 0 },
+  { { '9', 'n' }, 160 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'c', 'y' }, 118 },
+  { { 'i', 's', '0' }, 24 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'c', '8' }, 28 },
+  { { 'h', 'g' }, 43 },
+  { { 'p', 'b' }, 18 },
+  { "", 0 },
+  { "", 0 },
+  { { 'l', 'w' }, 137 },
+  { "", 0 },
+  { "", 0 },
+  { { '7', 'i' }, 170 },
+  { { 'e', 'b', '8' }, 28 },
+  { { 'z', 'a' }, 55 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'j', 'h' }, 150 },
+  { "", 0 },
+  { "", 0 },
+  { { 'v', 'e' }, 118 },
+  { { 'e', 'a', '8' }, 28 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'b', 'y' }, 153 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'c', 'r' }, 30 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'n', 'p', '4' }, 115 },
+  { { 'e', 'h', '8' }, 28 },
+  { { 'p', 'e' }, 18 },
+  { "", 0 },
+  { { 'l', 'r' }, 137 },
+  { "", 0 },
+  { "", 0 },
+  { { 'u', 'x' }, 71 },
+  { { 'z', 'l' }, 172 },
+  { { 'c', 's', '3' }, 31 },
+  { "", 0 },
+  { "", 0 },
+  { { 'h', 'b', '0' }, 21 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'b', 't' }, 153 },
+  { { 't', '6' }, 182 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'i', 'm', '0' }, 24 },
+  { { 'y', 'y' }, 147 },
+  { { 'p', 'h' }, 18 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'i', 't', '9' }, 25 },
+  { "", 0 },
+  { { 'u', 'u' }, 71 },
+  { { 'z', 'k' }, 172 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'u', '0' }, 70 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'i' }, 16 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'x', 'r' }, 139 },
+  { "", 0 },
+  { { '4', 'l' }, 74 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'o', 'o' }, 17 },
+  { "", 0 },
+  { "", 0 },
+  { { '2', 'm' }, 11 },
+  { { 'p', 's' }, 138 },
+  { "", 0 },
+  { { 'l', 'x' }, 35 },
+  { { '6', 'm' }, 151 },
+  { "", 0 },
+  { { 'u', 'r' }, 71 },
+  { { 'z', 'v' }, 138 },
+  { "", 0 },
+  { { '3', 'w' }, 162 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'g', '8' }, 28 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'f' }, 26 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'x', 'u' }, 164 },
+  { "", 0 },
+  { { '4', 'g' }, 169 },
+  { { 'e', 'f', '8' }, 28 },
+  { "", 0 },
+  { { 'c', 'm' }, 126 },
+  { "", 0 },
+  { "", 0 },
+  { { 'o', 'h' }, 59 },
+  { { 'y', 's' }, 125 },
+  { "", 0 },
+  { { 'p', 'v' }, 138 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'u', 'o' }, 178 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '8', 'n' }, 150 },
+  { "", 0 },
+  { { 'e', 'c' }, 26 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 's', 'i' }, 61 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'a', 'l', '7' }, 114 },
+  { "", 0 },
+  { { 'o', 'e' }, 22 },
+  { { 'y', 'h' }, 170 },
+  { "", 0 },
+  { { 'p', 'y' }, 138 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'z', 'x' }, 138 },
+  { "", 0 },
+  { { 'd', 'x' }, 169 },
+  { { 'w' }, 112 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '8', 'a' }, 170 },
+  { "", 0 },
+  { { 'e', 'x' }, 179 },
+  { { '9', 'm', '8' }, 168 },
+  { "", 0 },
+  { { 'a', 'c' }, 112 },
+  { { 's', 'b' }, 61 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '5', 'z' }, 102 },
+  { "", 0 },
+  { "", 0 },
+  { { 'y', 'm' }, 78 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'u', 'a' }, 68 },
+  { { 'x', 'x', '9' }, 155 },
+  { "", 0 },
+  { { 'd', 's' }, 151 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'e', '8' }, 28 },
+  { { 'i', 'b' }, 23 },
+  { { '8', 'd' }, 170 },
+  { "", 0 },
+  { { 'e', 'u' }, 72 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 's', 'g' }, 61 },
+  { { 'e', 'd', '8' }, 28 },
+  { { '4', 'x' }, 79 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '5', 'w' }, 175 },
+  { "", 0 },
+  { "", 0 },
+  { { 'y', 'b' }, 170 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'g', 'u' }, 15 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', 'n' }, 19 },
+  { { 'm' }, 9 },
+  { { 'e', '7' }, 51 },
+  { { 'u', 'a', '9' }, 70 },
+  { { '7', 's' }, 61 },
+  { { 'r', 'x' }, 68 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'r' }, 73 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 's', 'x' }, 46 },
+  { "", 0 },
+  { { '4', 's' }, 157 },
+  { "", 0 },
+  { "", 0 },
+  { { 'f', 'r' }, 4 },
+  { "", 0 },
+  { "", 0 },
+  { { 'o', 't' }, 17 },
+  { { 'y', 'g' }, 170 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', 'i' }, 19 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'r', 'w' }, 68 },
+  { "", 0 },
+  { "", 0 },
+  { { '8', 'r' }, 148 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'd', '6' }, 27 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'o', 'q' }, 17 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 't', 'm' }, 0 },
+  { "", 0 },
+  { { 'r', '1' }, 68 },
+  { "", 0 },
+  { "", 0 },
+  { { 'd', 'd' }, 19 },
+  { { 'l', 'g' }, 62 },
+  { "", 0 },
+  { "", 0 },
+  { { 'r', 'r' }, 68 },
+  { "", 0 },
+  { { 'i', 'q' }, 23 },
+  { { 'n', 'l', '7' }, 114 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 's', 'v' }, 46 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'b', 'i' }, 153 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 't', 'h' }, 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'l', 'b' }, 62 },
+  { "", 0 },
+  { "", 0 },
+  { { '7', 'b' }, 170 },
+  { "", 0 },
+  { { 'i', 'v' }, 23 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'j', 'g' }, 150 },
+  { "", 0 },
+  { "", 0 },
+  { { 'v', 'h' }, 171 },
+  { "", 0 },
+  { "", 0 },
+  { { '9', 'h' }, 37 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'b', 'd' }, 153 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 't', 'c' }, 78 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'l', 'm' }, 62 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'j', 'b' }, 150 },
+  { "", 0 },
+  { "", 0 },
+  { { 'v', 'o' }, 118 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'c', 'x' }, 141 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'c', '9' }, 29 },
+  { "", 0 },
+  { { 'p', 'c' }, 18 },
+  { "", 0 },
+  { "", 0 },
+  { { 'l', 'h' }, 62 },
+  { "", 0 },
+  { "", 0 },
+  { { '7', 'h' }, 170 },
+  { "", 0 },
+  { "", 0 },
+  { { '3', 'g' }, 139 },
+  { "", 0 },
+  { "", 0 },
+  { { 'j', 'i' }, 150 },
+  { "", 0 },
+  { { 'k', 'h', '6' }, 113 },
+  { "", 0 },
+  { { 'e', 'a', '9' }, 29 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'x', 'e' }, 119 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'p', 'f' }, 18 },
+  { "", 0 },
+  { "", 0 },
+  { { 'l', 's' }, 137 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'z', 'm' }, 172 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'm', 'u' }, 15 },
+  { "", 0 },
+  { "", 0 },
+  { { 'v', 'y' }, 118 },
+  { "", 0 },
+  { "", 0 },
+  { { '9', 'g' }, 100 },
+  { "", 0 },
+  { { 'c', '3' }, 33 },
+  { "", 0 },
+  { "", 0 },
+  { { 'b', 'u' }, 152 },
+  { { 't', '7' }, 38 },
+  { "", 0 },
+  { "", 0 },
+  { { 'c', 'v' }, 141 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'y', 'x' }, 147 },
+  { "", 0 },
+  { { '2', 'w' }, 10 },
+  { { 'p', 'i' }, 18 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'u', 't' }, 71 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'g', '6' }, 27 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'h' }, 26 },
+  { "", 0 },
+  { { 'c', '4' }, 81 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '4', 'm' }, 147 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'o', 'n' }, 17 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'l', 'y' }, 56 },
+  { "", 0 },
+  { "", 0 },
+  { { 'u', 'q' }, 178 },
+  { { 'z', 'w' }, 138 },
+  { "", 0 },
+  { { '3', 'v' }, 95 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'g', '9' }, 29 },
+  { { 'e', 'a', '6' }, 27 },
+  { "", 0 },
+  { { 'e', 'e' }, 26 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'x', 'v' }, 162 },
+  { "", 0 },
+  { { '4', 'h' }, 169 },
+  { "", 0 },
+  { "", 0 },
+  { { 'c', 'l' }, 126 },
+  { "", 0 },
+  { "", 0 },
+  { { 'o', 'k' }, 41 },
+  { { 'y', 'r' }, 44 },
+  { "", 0 },
+  { { '2', 'i' }, 12 },
+  { { 'p', 'w' }, 138 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'u', 'n' }, 178 },
+  { { 'p', '4' }, 136 },
+  { { 'z', 'r' }, 108 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'm', 'd' }, 13 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'e', 'b' }, 26 },
+  { { '9', 'm', '2' }, 167 },
+  { "", 0 },
+  { "", 0 },
+  { { 's', 'h' }, 61 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { 'c', 'a' }, 139 },
+  { "", 0 },
+  { "", 0 },
+  { { 'o', 'd' }, 80 },
+  { { 'y', 'w' }, 147 },
+  { "", 0 },
+  { { 'p', 'z' }, 149 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { { '6', 'd' }, 119 },
+  { "", 0 },
+  { { 'u', 'k' }, 77 },
+  { { 'z', 'y' }, 138 },
+  { "", 0 },
+  { { 'd', 'y' }, 169 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+  { "", 0 },
+};
+
+#endif
@@ -0,0 +1,65 @@
+/*
+ F4LAA : Fractional resampler used by the CW Decoder
+
+   La vitesse de l'ADC (sampling_freq) est mesurée au boot et varie de 9000 à 11496 samp/s
+   selon les options de compilation. Le resampler convertit chaque bloc acquis à la fréquence
+   nominale PROCESSING_FREQ : les coefficients Goertzel, la bande passante (PROCESSING_FREQ / nbSamples)
+   et les temps ne dépendent plus de la vitesse de l'ADC.
+
+   Interpolation linéaire, pas en virgule fixe 16.16.
+   Si l'entrée est plus de 2 fois plus rapide (fichiers WAV 22050 ou 48000 Hz), on moyenne
+   les échantillons d'entrée (filtre anti-repliement simple) au lieu d'interpoler.
+*/
+#ifndef Resampler_h
+#define Resampler_h
+
+#include <stdint.h>
+
+#define PROCESSING_FREQ 11025 // Nominal processing rate (samp/s)
+
+class Resampler
+{
+  public:
+    void setRates(float inFreq, float outFreq)
+    {
+      step = (uint32_t) ((65536.0 * inFreq / outFreq) + 0.5);
+    }
+
+    // Number of input samples needed to produce nbOut output samples
+    int inputCount(int nbOut) const
+    {
+      if (nbOut <= 0)
+        return 0;
+      return (int) ((((uint32_t) (nbOut - 1) * step) >> 16) + decimation() + 1);
+    }
+
+    // in[] must hold inputCount(nbOut) samples
+    void process(const int *in, int *out, int nbOut) const
+    {
+      uint32_t pos = 0;
+      int decim = decimation();
+      for (int j = 0; j < nbOut; j++)
+      {
+        int i = pos >> 16;
+        if (decim > 1)
+        {
+          int32_t sum = 0;
+          for (int d = 0; d < decim; d++)
+            sum += in[i + d];
+          out[j] = sum / decim;
+        }
+        else
+        {
+          int32_t frac = pos & 0xFFFF;
+          out[j] = in[i] + (int) (((int32_t) (in[i + 1] - in[i]) * frac) >> 16);
+        }
+        pos += step;
+      }
+    }
+
+    int decimation() const { return step >> 16 >= 2 ? step >> 16 : 1; }
+
+    uint32_t step = 65536; // inFreq / outFreq, in 16.16 fixed point
+};
+
+#endif
@@ -0,0 +1,140 @@
+/*
+ F4LAA : CW Decoder, protocole série binaire (trames) vers CWDecoder-UI
+
+   Trame : 0xA5 0x5A | type | len | payload (len octets) | CRC-16 CCITT de type, len et payload (poids faible d'abord)
+   Les payloads sont des structures packed, little endian (ESP32 et PC).
+
+   Côté firmware, les trames sont rangées entières dans un anneau (FrameTx) vidé à chaque passage de loop()
+   par morceaux qui tiennent dans le buffer TX de Serial : la boucle DSP n'attend jamais la liaison.
+   Les lignes de texte du mode graph et DataSet passent aussi par cet anneau (write).
+   Une trame qui ne tient pas dans l'anneau est perdue entière (comptée dans dropped, envoyée dans FRAME_STATUS).
+   Côté PC, FrameRx retrouve les trames dans le flux (resynchronisation sur 0xA5 0x5A après une erreur de CRC).
+*/
+#ifndef SerialFrame_h
+#define SerialFrame_h
+
+#include <stdint.h>
+#include "CWDecoder.h"
+
+#define FRAME_SYNC1 0xA5
+#define FRAME_SYNC2 0x5A
+#define FRAME_MAXPAYLOAD 255
+#define FRAME_OVERHEAD 6 // Sync, type, len, CRC
+#ifndef FRAME_RINGSIZE
+#define FRAME_RINGSIZE 2048
+#endif
+
+#define FRAME_CHAR 1   // FrameChar
+#define FRAME_TIMES 2  // FrameTimes
+#define FRAME_MAG 3    // FrameMag
+#define FRAME_STATUS 4 // FrameStatus
+#define FRAME_SPOT 5   // Text : type;call;to;rst;country
+#define FRAME_TEXT 6   // Text : messages of the firmware
+#define FRAME_AUDIO 7  // FrameAudio, then the ADPCM codes (Adpcm.h)
+
+#define FRAME_HIGH 1 // FrameMag.state
+#define FRAME_REAL 2
+
+#define STATUS_ADAPTIVE 1 // FrameStatus.flags
+#define STATUS_AFC 2
+#define STATUS_SCAN 4
+#define STATUS_NET 8
+#define STATUS_TREE 16
+#define STATUS_DICT 32
+
+struct __attribute__((packed)) FrameChar
+{
+  uint32_t ms;
+  char c;             // ' ' : word space
+  uint8_t confidence; // 0..100
+};
+
+struct __attribute__((packed)) FrameTimes
+{
+  char c;
+  int16_t times[MAXTIMES]; // ms : mark, space, mark, ...
+};
+
+struct __attribute__((packed)) FrameMag
+{
+  uint32_t ms;
+  int32_t magnitude;
+  int32_t threshold;
+  uint8_t state; // FRAME_HIGH, FRAME_REAL
+};
+
+struct __attribute__((packed)) FrameStatus
+{
+  uint32_t ms;
+  float freq;         // Hz, measured
+  float samplingFreq; // Hz, ADC
+  uint16_t nbSamples;
+  uint8_t wpm;
+  uint8_t flags;      // STATUS_xxx
+  uint32_t dropped;   // Frames lost since boot (ring full)
+  uint16_t allocs;    // Heap allocations during the last second (HEAP_STATS)
+  uint16_t dutyPermil; // Sampled time / elapsed time during the last second (AcqMonitor)
+  uint32_t gapMax;    // us, longest time between 2 blocks during the last second
+  uint32_t overruns;  // Gaps longer than a quarter of a dot, since boot
+};
+
+// Samples of the ADC, as acquired for one block (the time between 2 blocks is not sampled)
+#define AUDIO_MAXSAMPLES 254 // Per frame : longer blocks are sent in several frames
+struct __attribute__((packed)) FrameAudio
+{
+  uint32_t ms;        // First sample
+  uint16_t seq;       // +1 per frame : a gap is a lost frame
+  uint16_t rate;      // Hz, ADC (sampling_freq)
+  uint16_t midpoint;  // ADC units : sample = (adc - midpoint) * 16
+  int16_t predictor;  // ADPCM state before the first sample
+  uint8_t index;
+  uint8_t nbSamples;  // Then (nbSamples + 1) / 2 bytes
+};
+
+uint16_t frameCrc(const uint8_t *data, int len, uint16_t crc = 0xFFFF);
+
+class FrameTx
+{
+  public:
+    // The whole frame, or nothing when the ring is full
+    bool send(uint8_t type, const void *payload, int len);
+    // Raw bytes (text lines when not in binary mode), all of them or nothing
+    bool write(const void *data, int len);
+
+    // Bytes waiting, the first ones in a single block : write them, then consume()
+    int pending() const { return (head - tail) & (FRAME_RINGSIZE - 1); }
+    int contiguous(const uint8_t **data) const;
+    void consume(int n) { tail = (tail + n) & (FRAME_RINGSIZE - 1); }
+
+    uint32_t sent = 0;
+    uint32_t dropped = 0;
+
+  private:
+    void put(uint8_t b);
+
+    uint8_t ring[FRAME_RINGSIZE];
+    uint16_t head = 0; // Next byte written
+    uint16_t tail = 0; // Next byte sent
+};
+
+class FrameRx
+{
+  public:
+    // One byte of the stream : true when it completes a valid frame (type, len, payload)
+    bool push(uint8_t b);
+
+    uint8_t type = 0;
+    uint8_t len = 0;
+    uint8_t payload[FRAME_MAXPAYLOAD + 1]; // + 1 : text payloads are 0 terminated
+
+    uint32_t frames = 0;
+    uint32_t crcErrors = 0;
+    uint32_t skipped = 0; // Bytes outside frames
+
+  private:
+    enum { SYNC1, SYNC2, TYPE, LEN, PAYLOAD, CRC1, CRC2 } state = SYNC1;
+    int pos = 0;
+    uint16_t crc = 0;
+};
+
+#endif
@@ -0,0 +1,78 @@
+/*
+ F4LAA : CW Decoder, extraction des indicatifs et des échanges (spots)
+
+   Les caractères décodés sont découpés en mots (tokens), et une petite machine à états reconnaît :
+     - CQ ... DE <indicatif>        ==> SPOT_CQ
+     - <indicatif> DE <indicatif>   ==> SPOT_QSO (to / call)
+     - VVV / BCN / BEACON / xx/B ... DE <indicatif> ==> SPOT_BEACON
+     - DE <indicatif> seul          ==> SPOT_DE
+     - RST / UR 599, 5NN, 579 ...   ==> SPOT_REPORT (envoyé par call à to)
+   et la fin de passage (K, KN, BK, SK, AR).
+
+   Le pays de chaque indicatif est trouvé dans une table de hachage des préfixes (include/PrefixTable.h,
+   générée à la compilation par tools/mkprefix/mkprefix.py) : plus long préfixe, 4 caractères max,
+   chacun en PREFIX_MAXPROBE sondages au plus.
+*/
+#ifndef SpotExtractor_h
+#define SpotExtractor_h
+
+#include <stdint.h>
+
+#define SPOT_MAXCALL 13 // f4laa/qrp, ea8/f4laa/p + \0
+#define SPOT_MAXTOKEN 16
+#define MAXSPOTS 2
+
+#define SPOT_CQ 0
+#define SPOT_QSO 1
+#define SPOT_BEACON 2
+#define SPOT_DE 3
+#define SPOT_REPORT 4
+
+struct Spot
+{
+  uint8_t type;
+  char call[SPOT_MAXCALL]; // Sender
+  char to[SPOT_MAXCALL];   // "" when unknown
+  char rst[4];             // SPOT_REPORT : 599 (5nn is converted)
+  const char *country;     // Of call, "?" when unknown
+};
+
+class SpotExtractor
+{
+  public:
+    SpotExtractor() { clear(); }
+
+    // One decoded char, ' ' ends a word. Spots found are in spots[0..nbSpots-1] until the next call
+    void add(char c);
+    void endOfWord() { add(' '); } // Silence after the last word
+    bool pending() const { return tokLen > 0; }
+    void clear();
+
+    static bool isCallsign(const char *token);
+    static const char *country(const char *call); // "?" when unknown
+    static const char *typeName(uint8_t type);
+
+    bool tokenIs(const char *s) const; // The word just ended
+    bool endOfOver;                    // The word just ended is K, KN, BK, SK or AR
+
+    int nbSpots;
+    Spot spots[MAXSPOTS];
+
+  private:
+    void token();
+    void emit(uint8_t type, const char *call, const char *to, const char *rst);
+
+    char tok[SPOT_MAXTOKEN];
+    char lastTok[SPOT_MAXTOKEN];
+    int tokLen;
+
+    // Exchange in progress
+    bool cq;
+    bool de;
+    bool beacon;
+    bool report;            // RST or UR seen, waiting for the report
+    char to[SPOT_MAXCALL];  // Callsign before DE
+    char call[SPOT_MAXCALL];// Last sender
+};
+
+#endif
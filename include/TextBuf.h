@@ -0,0 +1,101 @@
+/*
+ F4LAA : CW Decoder, texte formaté dans un buffer de taille fixe (sur la pile), sans allocation
+
+   Remplace les String construites à chaque bloc (graph, trace) : chaque concaténation de String
+   alloue sur le tas, qui se fragmente au fil des heures. Les nombres sont écrits à la main
+   (pas de snprintf("%f") : le dtoa de newlib alloue). Ce qui dépasse N - 1 caractères est ignoré.
+*/
+#ifndef TextBuf_h
+#define TextBuf_h
+
+#include <stdint.h>
+
+template <int N> class TextBuf
+{
+  public:
+    TextBuf() { buf[0] = 0; }
+
+    TextBuf &add(const char *s)
+    {
+      while (*s && (len < N - 1))
+        buf[len++] = *s++;
+      buf[len] = 0;
+      return *this;
+    }
+
+    TextBuf &add(char c)
+    {
+      if (len < N - 1)
+        buf[len++] = c;
+      buf[len] = 0;
+      return *this;
+    }
+
+    TextBuf &add(long v)
+    {
+      unsigned long u = v;
+      if (v < 0)
+      {
+        add('-');
+        u = -u;
+      }
+      char digits[12];
+      int n = 0;
+      do
+      {
+        digits[n++] = '0' + (u % 10);
+        u /= 10;
+      } while (u);
+      while (n)
+        add(digits[--n]);
+      return *this;
+    }
+
+    TextBuf &add(int v) { return add((long) v); }
+
+    // Fixed point, rounded : add(3.14159f, 2) -> "3.14"
+    TextBuf &add(float v, int decimals)
+    {
+      if (v != v)
+        return add("nan");
+      if (v < 0)
+      {
+        add('-');
+        v = -v;
+      }
+      long scale = 1;
+      for (int i = 0; i < decimals; i++)
+        scale *= 10;
+      if (v > 2e9f)
+        return add("ovf");
+      // Integer part first : the fraction keeps the float precision
+      long whole = (long) v;
+      long frac = (long) ((v - whole) * scale + 0.5f);
+      if (frac >= scale)
+      {
+        whole++;
+        frac -= scale;
+      }
+      add(whole);
+      if (decimals > 0)
+      {
+        add('.');
+        for (long s = scale / 10; s > 0; s /= 10)
+        {
+          add((char) ('0' + frac / s));
+          frac %= s;
+        }
+      }
+      return *this;
+    }
+
+    void clear() { len = 0; buf[0] = 0; }
+    const char *c_str() const { return buf; }
+    int length() const { return len; }
+
+  private:
+    char buf[N];
+    int len = 0;
+};
+
+#endif
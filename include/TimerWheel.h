@@ -0,0 +1,61 @@
+/*
+ F4LAA : Roue de temporisations hiérarchique
+
+   Remplace les comparaisons millis() - start > délai réévaluées à chaque passage de loop() :
+   chaque échéance est programmée une fois (schedule), annulée si besoin (cancel), et advance()
+   appelle la fonction de la temporisation quand son heure est atteinte.
+
+   Temps en ticks (ms, l'heure des blocs passée à CWDecoder::process()).
+   3 niveaux de 64 cases : 64 ms au tick près, 4 s à 64 ms près, 262 s à 4 s près ; une temporisation
+   descend d'un niveau quand sa case est atteinte (cascade). Programmer / annuler : O(1).
+   advance() : O(1) par tick écoulé (quelques ticks par bloc), aucune allocation.
+*/
+#ifndef TimerWheel_h
+#define TimerWheel_h
+
+#include <stdint.h>
+
+#define TW_BITS 6
+#define TW_SLOTS (1 << TW_BITS)
+#define TW_MASK (TW_SLOTS - 1)
+#define TW_LEVELS 3
+
+typedef void (*TimerCallback)(void *ctx);
+
+struct Timer
+{
+  Timer(TimerCallback cb = 0, void *c = 0) : callback(cb), ctx(c) {}
+  bool pending() const { return pprev != 0; }
+
+  TimerCallback callback;
+  void *ctx;
+  uint32_t expires = 0;
+
+  // Slot list (pprev : the pointer to this timer)
+  Timer *next = 0;
+  Timer **pprev = 0;
+};
+
+class TimerWheel
+{
+  public:
+    TimerWheel();
+
+    void start(uint32_t now);                  // Current time, no timer pending
+    void schedule(Timer &t, uint32_t expires); // Reschedules t if pending. Past time : next tick
+    void cancel(Timer &t);
+    void advance(uint32_t now);                // Calls the timers expired up to now
+
+    uint32_t now() const { return current; }
+    int nbPending() const { return pending; }
+
+  private:
+    void add(Timer &t);
+    void cascade(int level);
+
+    Timer *slots[TW_LEVELS][TW_SLOTS];
+    uint32_t current = 0;
+    int pending = 0;
+};
+
+#endif
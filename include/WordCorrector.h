@@ -0,0 +1,90 @@
+/*
+ F4LAA : CW Decoder, correction des mots à l'aide d'un dictionnaire
+
+   Quand les temps sont ambigus, un mot est mal découpé en lettres ("dead" ==> "teeeet")
+   ou un . est pris pour un - . Les caractères d'un mot sont gardés avec leurs éléments et les marges
+   de chaque élément / silence (DecodedChar), puis à la fin du mot une recherche en faisceau (beam search)
+   essaie les autres découpages et les éléments douteux :
+     - changer un élément ou un silence coûte CORR_FLIPCOST + sa marge (0..100),
+       ceux dont la marge dépasse CORR_MAXFLIP ne sont jamais changés,
+     - un mot absent du dictionnaire coûte CORR_OOVCOST.
+   Le mot de plus faible coût est retenu : un mot du dictionnaire décodé tel quel ne change jamais.
+
+   Le dictionnaire (Q-codes, abréviations, préfixes d'indicatifs) est un trie statique généré
+   par tools/mkdict/mkdict.py à partir de tools/mkdict/words.txt : include/DictTrie.h (en flash),
+   regénéré par PlatformIO avant la compilation quand words.txt a changé.
+   RAM fixe : sizeof(WordCorrector) <= CORR_RAMBUDGET, pas d'allocation.
+*/
+#ifndef WordCorrector_h
+#define WordCorrector_h
+
+#include <stdint.h>
+#include "CWDecoder.h"
+
+#define CORR_MAXCHARS 12                     // Longer words are not corrected
+#define CORR_MAXELEMENTS (CORR_MAXCHARS * 4)
+#define CORR_BEAM 8                          // States kept by the beam search
+#define CORR_FLIPCOST 20
+#define CORR_MAXFLIP 50
+#define CORR_OOVCOST 60
+#define CORR_RAMBUDGET 1024                  // bytes
+
+// Trie node : the children of a node are contiguous, the last one has DICT_LAST
+#define DICT_END 1  // A word ends here
+#define DICT_LAST 2 // Last child
+struct DictNode
+{
+  char c;         // Or '#' : a digit, '@' : a letter, '*' : the end of the word (1 or more letters / digits)
+  uint8_t flags;
+  uint16_t child; // First child, 0 : none
+};
+
+class WordCorrector
+{
+  public:
+    WordCorrector() : changed(false), cost(0) { clear(); }
+
+    // Adds a character of the current word, false when the word is too long (correct it first)
+    bool add(const DecodedChar &d);
+
+    // Corrects the current word and clears it.
+    // text[] gets the word (CORR_MAXCHARS + 1), conf[] the confidence of each char. Returns the length.
+    int correct(char *text, uint8_t *conf);
+
+    void clear();
+
+    int wordLen;       // Chars of the current word
+    bool changed;      // The last word was corrected
+    uint16_t cost;     // of the last word
+
+  private:
+    struct State
+    {
+      uint16_t node;   // Trie node, or CORR_OOV / CORR_WILD
+      uint16_t cost;
+      uint8_t codeLen;
+      uint8_t textLen;
+      char code[bufSize];
+      char text[CORR_MAXCHARS + 1];
+    };
+
+    void push(const State &s);
+    void closeLetter(State &s, uint16_t cost);
+    uint16_t finalCost(const State &s) const;
+
+    char word[CORR_MAXCHARS + 1];
+    uint8_t wordConf[CORR_MAXCHARS];
+
+    // Elements of the word, with the kind of space after each one
+    int nbElements;
+    char elements[CORR_MAXELEMENTS];
+    uint8_t elemMargins[CORR_MAXELEMENTS];
+    uint8_t gapMargins[CORR_MAXELEMENTS];
+    uint8_t gapKinds[CORR_MAXELEMENTS];
+
+    State beam[2][CORR_BEAM];
+    int nbStates[2];
+    int cur;
+};
+
+#endif
@@ -5,9 +5,17 @@
  *
  */
 
-#include "Arduino.h"
 #include "Rotary.h"
 
+// Everything called by the interrupts in IRAM (ESP32) : they may run while the flash cache is off
+#ifdef ESP32
+#define ROT_ISR IRAM_ATTR
+#define ROT_DATA DRAM_ATTR
+#else
+#define ROT_ISR
+#define ROT_DATA
+#endif
+
 /*
  * The below state table has, for each state (row), the new state
  * to set based on the next encoder output. From left to right in,
@@ -24,7 +32,7 @@
 #define R_START_M 0x3
 #define R_CW_BEGIN_M 0x4
 #define R_CCW_BEGIN_M 0x5
-const unsigned char ttable[6][4] = {
+ROT_DATA const unsigned char ttable[6][4] = {
   // R_START (00)
   {R_START_M,            R_CW_BEGIN,     R_CCW_BEGIN,  R_START},
   // R_CCW_BEGIN
@@ -47,7 +55,7 @@ const unsigned char ttable[6][4] = {
 #define R_CCW_FINAL 0x5
 #define R_CCW_NEXT 0x6
 
-const unsigned char ttable[7][4] = {
+ROT_DATA const unsigned char ttable[7][4] = {
   // R_START
   {R_START,    R_CW_BEGIN,  R_CCW_BEGIN, R_START},
   // R_CW_FINAL
@@ -78,6 +86,7 @@ Rotary::Rotary(char _pin1, char _pin2) {
   inverter = 0;
 }
 
+#ifdef ARDUINO
 void Rotary::begin(bool internalPullup, bool flipLogicForPulldown) {
 
   if (internalPullup){
@@ -95,8 +104,97 @@ void Rotary::begin(bool internalPullup, bool flipLogicForPulldown) {
 unsigned char Rotary::process() {
   // Grab state of input pins.
   unsigned char pinstate = ((inverter ^ digitalRead(pin2)) << 1) | (inverter ^ digitalRead(pin1));
+  return step(pinstate);
+}
+
+/*
+ * Interrupt mode. One encoder : the handlers find it here.
+ */
+static Rotary *isrRotary = 0;
+
+void ROT_ISR Rotary::isrPins() {
+  Rotary *r = isrRotary;
+  r->onPins(((r->inverter ^ digitalRead(r->pin2)) << 1) | (r->inverter ^ digitalRead(r->pin1)), millis());
+}
+
+void ROT_ISR Rotary::isrSwitch() {
+  Rotary *r = isrRotary;
+  r->onButton(digitalRead(r->pinSW) == LOW, millis());
+}
+
+void Rotary::attach(int _pinSW) {
+  isrRotary = this;
+  pinSW = _pinSW;
+  attachInterrupt(digitalPinToInterrupt(pin1), isrPins, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(pin2), isrPins, CHANGE);
+  if (pinSW >= 0) {
+    pressed = digitalRead(pinSW) == LOW;
+    attachInterrupt(digitalPinToInterrupt(pinSW), isrSwitch, CHANGE);
+  }
+}
+#endif
+
+unsigned char ROT_ISR Rotary::step(unsigned char pinstate) {
   // Determine new state from the pins and state table.
   state = ttable[state & 0xf][pinstate];
   // Return emit bits, ie the generated event.
   return state & 0x30;
 }
+
+signed char ROT_ISR Rotary::accel(unsigned long dt) const {
+  if ((accelMax <= 1) || (dt >= accelSlow))
+    return 1;
+  if (dt <= accelFast)
+    return accelMax;
+  return 1 + (accelMax - 1) * (accelSlow - dt) / (accelSlow - accelFast);
+}
+
+void ROT_ISR Rotary::onPins(unsigned char pinstate, unsigned long ms) {
+  unsigned char dir = step(pinstate);
+  if (dir == DIR_NONE)
+    return;
+  // Faster in the same direction : more steps
+  signed char n = (dir == lastDir) ? accel(ms - lastStepMs) : 1;
+  lastDir = dir;
+  lastStepMs = ms;
+  RotaryEvent e = { ROT_EV_TURN, (signed char) ((dir == DIR_CW) ? n : -n), ms };
+  queue.push(e);
+}
+
+void ROT_ISR Rotary::onButton(bool _pressed, unsigned long ms) {
+  // Bounces : changes too close to the last one
+  if ((_pressed == pressed) || (ms - lastButtonMs < ROT_DEBOUNCE))
+    return;
+  pressed = _pressed;
+  lastButtonMs = ms;
+  RotaryEvent e = { (unsigned char) (pressed ? ROT_EV_PRESS : ROT_EV_RELEASE), 0, ms };
+  queue.push(e);
+}
+
+/*
+ * Queue : the producer publishes an event by writing head after it (release),
+ * the consumer frees it by writing tail after reading it.
+ */
+bool ROT_ISR RotaryQueue::push(const RotaryEvent &e) {
+  unsigned char h = head;
+  if ((unsigned char) (h - __atomic_load_n(&tail, __ATOMIC_ACQUIRE)) >= ROT_QUEUESIZE) {
+    lost = lost + 1;
+    return false;
+  }
+  events[h & (ROT_QUEUESIZE - 1)] = e;
+  __atomic_store_n(&head, (unsigned char) (h + 1), __ATOMIC_RELEASE);
+  return true;
+}
+
+bool RotaryQueue::pop(RotaryEvent &e) {
+  unsigned char t = tail;
+  if (t == __atomic_load_n(&head, __ATOMIC_ACQUIRE))
+    return false;
+  e = events[t & (ROT_QUEUESIZE - 1)];
+  __atomic_store_n(&tail, (unsigned char) (t + 1), __ATOMIC_RELEASE);
+  return true;
+}
+
+unsigned char RotaryQueue::size() const {
+  return __atomic_load_n(&head, __ATOMIC_ACQUIRE) - __atomic_load_n(&tail, __ATOMIC_ACQUIRE);
+}
@@ -5,7 +5,9 @@
 #ifndef Rotary_h
 #define Rotary_h
 
+#ifdef ARDUINO
 #include "Arduino.h"
+#endif
 
 // Enable this to emit codes twice per step.
 // #define HALF_STEP
@@ -18,21 +20,91 @@
 // Counter-clockwise step.
 #define DIR_CCW 0x20
 
+// Events of the interrupt mode (see 'attach')
+#define ROT_EV_TURN 1
+#define ROT_EV_PRESS 2
+#define ROT_EV_RELEASE 3
+
+// Queue size, power of 2 (128 max : 8 bits indexes)
+#ifndef ROT_QUEUESIZE
+#define ROT_QUEUESIZE 32
+#endif
+
+// Button debounce (ms)
+#define ROT_DEBOUNCE 10
+
+struct RotaryEvent
+{
+  unsigned char type;   // ROT_EV_xxx
+  signed char steps;    // ROT_EV_TURN : > 0 clockwise, < 0 counter-clockwise, times the acceleration
+  unsigned long ms;
+};
+
+// Single producer (the interrupt) / single consumer (loop) queue without lock :
+// head is only written by push, tail only by pop.
+class RotaryQueue
+{
+  public:
+    bool push(const RotaryEvent &e);   // false (and lost++) when full
+    bool pop(RotaryEvent &e);
+    unsigned char size() const;
+
+    volatile unsigned long lost = 0;
+
+  private:
+    RotaryEvent events[ROT_QUEUESIZE];
+    unsigned char head = 0;
+    unsigned char tail = 0;
+};
+
 class Rotary
 {
   public:
     Rotary(char, char);
+#ifdef ARDUINO
     unsigned char process();
     void begin(bool internalPullup=true, bool flipLogicForPulldown=false);
-  
+
+    // Interrupt mode : pin change interrupts on both pins (and the switch, if any) run the state table
+    // and queue the events, read in loop() by 'read'. 'process' must not be called any more.
+    void attach(int pinSW = -1);
+#endif
+    bool read(RotaryEvent &e) { return queue.pop(e); }
+
+    // Without the pins : state table on a pin state (pin2 << 1 | pin1), then
+    // what the interrupts do with it at time ms
+    unsigned char step(unsigned char pinstate);
+    void onPins(unsigned char pinstate, unsigned long ms);
+    void onButton(bool pressed, unsigned long ms);
+
+    // Acceleration : steps between 2 detents in the same direction, from 1 (accelSlow ms or more)
+    // to accelMax (accelFast ms or less). accelMax = 1 : none.
+    signed char accel(unsigned long dt) const;
+    unsigned int accelSlow = 100;
+    unsigned int accelFast = 15;
+    unsigned char accelMax = 8;
+
+    RotaryQueue queue;
+
     inline unsigned char pin_1() const { return pin1; }
     inline unsigned char pin_2() const { return pin2; }
   private:
-    unsigned char state;
+    volatile unsigned char state;
     unsigned char pin1;
     unsigned char pin2;
     unsigned char inverter;
+
+    // Interrupt mode
+    int pinSW = -1;
+#ifdef ARDUINO
+    static void isrPins();
+    static void isrSwitch();
+#endif
+    unsigned char lastDir = DIR_NONE;
+    unsigned long lastStepMs = 0;
+    bool pressed = false;
+    unsigned long lastButtonMs = 0;
 };
 
 #endif
- 
+
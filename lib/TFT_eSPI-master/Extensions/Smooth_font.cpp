@@ -245,6 +245,59 @@ void TFT_eSPI::loadMetrics(void)
   gFont.yAdvance = gFont.maxAscent + gFont.maxDescent;
 
   gFont.spaceWidth = (gFont.ascent + gFont.descent) * 2/7;  // Guess at space width
+
+  loadGlyphIndex();
+}
+
+
+/***************************************************************************************
+** Function name:           loadGlyphIndex
+** Description:             F4LAA : direct table for Latin-1, sorted table for the rest
+*************************************************************************************x*/
+static int compareUniSorted(const void* a, const void* b)
+{
+  uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+  return (x > y) - (x < y);
+}
+
+void TFT_eSPI::loadGlyphIndex(void)
+{
+  gUniCount = 0;
+  for (uint16_t i = 0; i < gFont.gCount; i++)
+    if (gUnicode[i] > 0xFF) gUniCount++;
+
+  gLatin1 = (uint16_t*)malloc(256 * 2);
+  if (gUniCount) gUniSorted = (uint32_t*)malloc(gUniCount * 4);
+  if (!gLatin1 || (gUniCount && !gUniSorted))
+  {
+    // Not enough memory : linear search
+    free(gLatin1);
+    free(gUniSorted);
+    gLatin1 = NULL;
+    gUniSorted = NULL;
+    gUniCount = 0;
+    return;
+  }
+
+  memset(gLatin1, 0xFF, 256 * 2);
+  uint16_t n = 0;
+  bool sorted = true;
+  for (uint16_t i = 0; i < gFont.gCount; i++)
+  {
+    uint16_t code = gUnicode[i];
+    if (code <= 0xFF)
+    {
+      if (gLatin1[code] == 0xFFFF) gLatin1[code] = i; // First one, as the linear search
+    }
+    else
+    {
+      gUniSorted[n] = (uint32_t)code << 16 | i;
+      if (n && gUniSorted[n] < gUniSorted[n - 1]) sorted = false;
+      n++;
+    }
+  }
+  // .vlw files from Processing are sorted by code : no sort needed
+  if (!sorted) qsort(gUniSorted, gUniCount, 4, compareUniSorted);
 }
 
 
@@ -296,6 +349,19 @@ void TFT_eSPI::unloadFont( void )
     gBitmap = NULL;
   }
 
+  if (gLatin1)
+  {
+    free(gLatin1);
+    gLatin1 = NULL;
+  }
+
+  if (gUniSorted)
+  {
+    free(gUniSorted);
+    gUniSorted = NULL;
+  }
+  gUniCount = 0;
+
   gFont.gArray = nullptr;
 
 #ifdef FONT_FS_AVAILABLE
@@ -340,6 +406,29 @@ uint32_t TFT_eSPI::readInt32(void)
 *************************************************************************************x*/
 bool TFT_eSPI::getUnicodeIndex(uint16_t unicode, uint16_t *index)
 {
+  // F4LAA : O(1) for Latin-1, O(log n) for the rest
+  if (gLatin1)
+  {
+    if (unicode <= 0xFF)
+    {
+      if (gLatin1[unicode] == 0xFFFF) return false;
+      *index = gLatin1[unicode];
+      return true;
+    }
+    // First entry >= unicode << 16 (smallest index if the code is there twice)
+    uint32_t key = (uint32_t)unicode << 16;
+    uint16_t lo = 0, hi = gUniCount;
+    while (lo < hi)
+    {
+      uint16_t mid = (lo + hi) >> 1;
+      if (gUniSorted[mid] < key) lo = mid + 1;
+      else hi = mid;
+    }
+    if (lo == gUniCount || (gUniSorted[lo] >> 16) != unicode) return false;
+    *index = (uint16_t)gUniSorted[lo];
+    return true;
+  }
+
   for (uint16_t i = 0; i < gFont.gCount; i++)
   {
     if (gUnicode[i] == unicode)
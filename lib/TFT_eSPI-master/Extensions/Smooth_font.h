@@ -40,6 +40,11 @@ fontMetrics gFont = { nullptr, 0, 0, 0, 0, 0, 0, 0 };
   int8_t*   gdX = NULL;       //leftExtent
   uint32_t* gBitmap = NULL;   //file pointer to greyscale bitmap
 
+  // F4LAA : glyph index, built by loadMetrics() (getUnicodeIndex() scans gUnicode if they could not be allocated)
+  uint16_t* gLatin1 = NULL;   //index of the codes 0x00-0xFF, 0xFFFF if not in the font
+  uint32_t* gUniSorted = NULL;//code << 16 | index of the other codes, sorted (binary search)
+  uint16_t  gUniCount = 0;
+
   bool     fontLoaded = false; // Flags when a anti-aliased font is loaded
 
 #ifdef FONT_FS_AVAILABLE
@@ -55,6 +60,7 @@ fontMetrics gFont = { nullptr, 0, 0, 0, 0, 0, 0, 0 };
   private:
 
   void     loadMetrics(void);
+  void     loadGlyphIndex(void);
   uint32_t readInt32(void);
 
   uint8_t* fontPtr = nullptr;
@@ -2190,7 +2190,7 @@ int16_t TFT_eSprite::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t fo
 
   int32_t width  = 0;
   int32_t height = 0;
-  uint32_t flash_address = 0;
+  uintptr_t flash_address = 0; // F4LAA : pointer size (host builds)
   uniCode -= 32;
 
 #ifdef LOAD_FONT2
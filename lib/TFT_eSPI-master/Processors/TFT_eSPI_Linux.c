@@ -0,0 +1,360 @@
+        ////////////////////////////////////////////////////
+        //       TFT_eSPI Linux framebuffer functions     //
+        ////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Global variables
+////////////////////////////////////////////////////////////////////////////////////////
+
+TFT_eSPI_FB  tft_fb;
+TFT_eSPI_FB& spi = tft_fb;
+
+// Bytes per pixel returned by RAMRD, as expected by readPixel() and readRect()
+#if defined (ST7796_DRIVER)
+  #define FB_READ_BYTES 2
+#else
+  #define FB_READ_BYTES 3
+#endif
+
+/***************************************************************************************
+** Function name:           TFT_eSPI_FB
+** Description:             Panel after reset : black, MADCTL 0, full window
+***************************************************************************************/
+TFT_eSPI_FB::TFT_eSPI_FB()
+{
+  memset(_mem, 0, sizeof(_mem));
+  _madctl = 0;
+  _lw = TFT_WIDTH; _lh = TFT_HEIGHT;
+  _cs = false; _dc = false; _ramWrite = false; _ramRead = false; _half = false;
+  _cmd = 0; _nbParams = 0; _hi = 0;
+  _xs = 0; _xe = TFT_WIDTH - 1; _ys = 0; _ye = TFT_HEIGHT - 1;
+  _wx = 0; _wy = 0; _rx = 0; _ry = 0;
+  _rdByte = 0; _rdColor = 0;
+  _freq = SPI_FREQUENCY;
+  _busBits = 0;
+  resetStats();
+}
+
+void TFT_eSPI_FB::resetStats()
+{
+  flushBusTime();
+  memset(&stats, 0, sizeof(stats));
+}
+
+void TFT_eSPI_FB::flushBusTime()
+{
+  stats.busUs += _busBits * 1e6 / _freq;
+  _busBits = 0;
+}
+
+void TFT_eSPI_FB::setFrequency(uint32_t freq)
+{
+  flushBusTime();
+  _freq = freq;
+}
+
+/***************************************************************************************
+** Function name:           select
+** Description:             Chip select : a low edge starts a transaction
+***************************************************************************************/
+void TFT_eSPI_FB::select(bool low)
+{
+  if (low && !_cs) stats.transactions++;
+  if (!low) flushBusTime();
+  _cs = low;
+}
+
+/***************************************************************************************
+** Function name:           physical
+** Description:             Address in the panel memory of an addressed pixel (MADCTL)
+***************************************************************************************/
+uint32_t TFT_eSPI_FB::physical(int32_t x, int32_t y) const
+{
+  if (_madctl & TFT_MAD_MV) { int32_t t = x; x = y; y = t; }
+  if (_madctl & TFT_MAD_MX) x = TFT_WIDTH - 1 - x;
+  if (_madctl & TFT_MAD_MY) y = TFT_HEIGHT - 1 - y;
+  return y * TFT_WIDTH + x;
+}
+
+/***************************************************************************************
+** Function name:           transfer
+** Description:             One byte on the bus, decoded as the panel would
+***************************************************************************************/
+uint8_t TFT_eSPI_FB::transfer(uint8_t data)
+{
+  _busBits += 8;
+
+  if (_ramRead && !_dc) {
+    stats.bytesRead++;
+    return readByte();
+  }
+  stats.bytesWritten++;
+
+  if (_dc) {
+    stats.commands++;
+    _cmd = data;
+    _nbParams = 0;
+    _half = false;
+    _ramWrite = (data == TFT_RAMWR);
+    _ramRead  = (data == TFT_RAMRD);
+    if (_ramWrite) { _wx = _xs; _wy = _ys; }
+    if (_ramRead)  { _rx = _xs; _ry = _ys; _rdByte = 0; }
+    return 0;
+  }
+
+  if (_ramWrite) {
+    if (!_half) { _hi = data; _half = true; }
+    else { _half = false; stats.pixels++; put(_hi << 8 | data); }
+    return 0;
+  }
+
+  // Command parameters
+  if (_nbParams < 4) _params[_nbParams] = data;
+  _nbParams++;
+  switch (_cmd) {
+    case TFT_CASET:
+      if (_nbParams == 4) { _xs = _params[0] << 8 | _params[1]; _xe = _params[2] << 8 | _params[3]; }
+      break;
+    case TFT_PASET:
+      if (_nbParams == 4) { _ys = _params[0] << 8 | _params[1]; _ye = _params[2] << 8 | _params[3]; }
+      break;
+    case TFT_MADCTL:
+      if (_nbParams == 1) {
+        _madctl = data;
+        _lw = (data & TFT_MAD_MV) ? TFT_HEIGHT : TFT_WIDTH;
+        _lh = (data & TFT_MAD_MV) ? TFT_WIDTH  : TFT_HEIGHT;
+      }
+      break;
+  }
+  return 0;
+}
+
+/***************************************************************************************
+** Function name:           readByte
+** Description:             RAMRD : a dummy byte, then the window pixels
+***************************************************************************************/
+uint8_t TFT_eSPI_FB::readByte()
+{
+  if (_rdByte++ == 0) return 0; // Dummy byte
+
+  uint32_t k = (_rdByte - 2) % FB_READ_BYTES;
+  if (k == 0) {
+    _rdColor = 0;
+    if ((uint32_t)_rx < (uint32_t)_lw && (uint32_t)_ry < (uint32_t)_lh) _rdColor = _mem[physical(_rx, _ry)];
+    if (++_rx > _xe) { _rx = _xs; if (++_ry > _ye) _ry = _ys; }
+  }
+#if (FB_READ_BYTES == 2)
+  return k ? _rdColor : _rdColor >> 8;
+#else
+  // 18-bit panel memory : 6 bits in the top of each byte
+  uint8_t c = (k == 0) ? (_rdColor >> 8) & 0xF8 : (k == 1) ? (_rdColor >> 3) & 0xFC : (_rdColor << 3) & 0xF8;
+  #if defined (ST7735_DRIVER)
+    c >>= 1;
+  #endif
+  return c;
+#endif
+}
+
+/***************************************************************************************
+** Function name:           writePixels
+** Description:             The same colour len times
+***************************************************************************************/
+void TFT_eSPI_FB::writePixels(uint16_t color, uint32_t len)
+{
+  stats.bytesWritten += 2 * (uint64_t)len;
+  stats.pixels += len;
+  _busBits += 16 * (uint64_t)len;
+  while (len--) put(color);
+}
+
+/***************************************************************************************
+** Function name:           width, height, pixel, fill
+** Description:             Panel memory as addressed with the current rotation
+***************************************************************************************/
+int32_t TFT_eSPI_FB::width() const  { return _lw; }
+int32_t TFT_eSPI_FB::height() const { return _lh; }
+
+uint16_t TFT_eSPI_FB::pixel(int32_t x, int32_t y) const
+{
+  if ((uint32_t)x >= (uint32_t)_lw || (uint32_t)y >= (uint32_t)_lh) return 0;
+  return _mem[physical(x, y)];
+}
+
+void TFT_eSPI_FB::fill(uint16_t color)
+{
+  for (uint32_t i = 0; i < TFT_WIDTH * TFT_HEIGHT; i++) _mem[i] = color;
+}
+
+uint32_t TFT_eSPI_FB::checksum() const
+{
+  uint32_t h = 2166136261u;
+  for (int32_t y = 0; y < _lh; y++)
+    for (int32_t x = 0; x < _lw; x++) {
+      uint16_t c = _mem[physical(x, y)];
+      h = (h ^ (c & 0xFF)) * 16777619u;
+      h = (h ^ (c >> 8)) * 16777619u;
+    }
+  return h;
+}
+
+/***************************************************************************************
+** Function name:           savePPM, savePNG, comparePPM
+** Description:             Snapshots (RGB888) as seen with the current rotation
+***************************************************************************************/
+static void fbRGB(uint16_t c, uint8_t* rgb)
+{
+  uint8_t r = c >> 11, g = (c >> 5) & 0x3F, b = c & 0x1F;
+  rgb[0] = r << 3 | r >> 2;
+  rgb[1] = g << 2 | g >> 4;
+  rgb[2] = b << 3 | b >> 2;
+}
+
+bool TFT_eSPI_FB::savePPM(const char* fileName) const
+{
+  FILE* f = fopen(fileName, "wb");
+  if (!f) return false;
+  fprintf(f, "P6\n%d %d\n255\n", (int)_lw, (int)_lh);
+  uint8_t rgb[3];
+  for (int32_t y = 0; y < _lh; y++)
+    for (int32_t x = 0; x < _lw; x++) { fbRGB(_mem[physical(x, y)], rgb); fwrite(rgb, 1, 3, f); }
+  return fclose(f) == 0;
+}
+
+static uint32_t fbCrc(uint32_t crc, const uint8_t* data, size_t len)
+{
+  static uint32_t table[256];
+  if (!table[1])
+    for (uint32_t n = 0; n < 256; n++) {
+      uint32_t c = n;
+      for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      table[n] = c;
+    }
+  crc = ~crc;
+  while (len--) crc = table[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+  return ~crc;
+}
+
+static void fbPut32(uint8_t* p, uint32_t v) { p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v; }
+
+static void fbChunk(FILE* f, const char* type, const uint8_t* data, uint32_t len)
+{
+  uint8_t b[4];
+  fbPut32(b, len); fwrite(b, 1, 4, f);
+  fwrite(type, 1, 4, f);
+  if (len) fwrite(data, 1, len, f);
+  uint32_t crc = fbCrc(fbCrc(0, (const uint8_t*)type, 4), data, len);
+  fbPut32(b, crc); fwrite(b, 1, 4, f);
+}
+
+// Uncompressed (stored deflate blocks) : no zlib needed
+bool TFT_eSPI_FB::savePNG(const char* fileName) const
+{
+  uint32_t rowLen = 1 + 3 * _lw;               // Filter byte (none), then RGB
+  uint32_t rawLen = rowLen * _lh;
+  uint32_t nbBlocks = (rawLen + 65534) / 65535;
+  uint8_t* raw = (uint8_t*)malloc(rawLen);
+  uint8_t* z = (uint8_t*)malloc(2 + rawLen + 5 * nbBlocks + 4);
+  if (!raw || !z) { free(raw); free(z); return false; }
+
+  uint8_t* p = raw;
+  for (int32_t y = 0; y < _lh; y++) {
+    *p++ = 0;
+    for (int32_t x = 0; x < _lw; x++, p += 3) fbRGB(_mem[physical(x, y)], p);
+  }
+
+  uint32_t a = 1, b = 0, n = 0;                // Adler-32
+  for (uint32_t i = 0; i < rawLen; i++) { a = (a + raw[i]) % 65521; b = (b + a) % 65521; }
+  z[n++] = 0x78; z[n++] = 0x01;
+  for (uint32_t pos = 0; pos < rawLen; pos += 65535) {
+    uint32_t len = (rawLen - pos < 65535) ? rawLen - pos : 65535;
+    z[n++] = (pos + len == rawLen);
+    z[n++] = len; z[n++] = len >> 8; z[n++] = ~len; z[n++] = (~len) >> 8;
+    memcpy(z + n, raw + pos, len);
+    n += len;
+  }
+  fbPut32(z + n, b << 16 | a); n += 4;
+
+  uint8_t ihdr[13] = { 0 };
+  fbPut32(ihdr, _lw);
+  fbPut32(ihdr + 4, _lh);
+  ihdr[8] = 8;  // Bits per channel
+  ihdr[9] = 2;  // RGB
+
+  bool ok = false;
+  FILE* f = fopen(fileName, "wb");
+  if (f) {
+    static const uint8_t sig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    fwrite(sig, 1, 8, f);
+    fbChunk(f, "IHDR", ihdr, 13);
+    fbChunk(f, "IDAT", z, n);
+    fbChunk(f, "IEND", nullptr, 0);
+    ok = (fclose(f) == 0);
+  }
+  free(raw);
+  free(z);
+  return ok;
+}
+
+// Different pixels in red on the darkened snapshot in diffName
+int32_t TFT_eSPI_FB::comparePPM(const char* fileName, const char* diffName) const
+{
+  FILE* f = fopen(fileName, "rb");
+  if (!f) return -1;
+  int w = 0, h = 0, maxVal = 0;
+  if ((fscanf(f, "P6 %d %d %d", &w, &h, &maxVal) != 3) || (fgetc(f) == EOF) ||
+      (w != _lw) || (h != _lh) || (maxVal != 255)) {
+    fclose(f);
+    return -1;
+  }
+  FILE* d = diffName ? fopen(diffName, "wb") : nullptr;
+  if (d) fprintf(d, "P6\n%d %d\n255\n", w, h);
+
+  int32_t nbDiff = 0;
+  uint8_t ref[3], rgb[3];
+  for (int32_t y = 0; y < _lh; y++)
+    for (int32_t x = 0; x < _lw; x++) {
+      if (fread(ref, 1, 3, f) != 3) { fclose(f); if (d) fclose(d); return -1; }
+      fbRGB(_mem[physical(x, y)], rgb);
+      bool same = !memcmp(ref, rgb, 3);
+      nbDiff += !same;
+      if (d) {
+        if (same) { rgb[0] >>= 2; rgb[1] >>= 2; rgb[2] >>= 2; }
+        else { rgb[0] = 255; rgb[1] = 0; rgb[2] = 0; }
+        fwrite(rgb, 1, 3, d);
+      }
+    }
+  fclose(f);
+  if (d) fclose(d);
+  return nbDiff;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+//                Display interface functions
+////////////////////////////////////////////////////////////////////////////////////////
+
+/***************************************************************************************
+** Function name:           pushBlock - for the simulated panel
+** Description:             Write a block of pixels of the same colour
+***************************************************************************************/
+void TFT_eSPI::pushBlock(uint16_t color, uint32_t len){
+
+  spi.writePixels(color, len);
+}
+
+/***************************************************************************************
+** Function name:           pushPixels - for the simulated panel
+** Description:             Write a sequence of pixels
+***************************************************************************************/
+void TFT_eSPI::pushPixels(const void* data_in, uint32_t len){
+
+  uint16_t *data = (uint16_t*)data_in;
+
+  if (_swapBytes) while ( len-- ) {tft_Write_16(*data); data++;}
+  else while ( len-- ) {tft_Write_16S(*data); data++;}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+//                                DMA FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////////////
+
+//                No DMA : see TFT_eSPI_Generic.c
@@ -0,0 +1,181 @@
+        ////////////////////////////////////////////////////
+        //       TFT_eSPI Linux framebuffer functions     //
+        ////////////////////////////////////////////////////
+
+// F4LAA : host (PC) build, selected by TFT_LINUX_FB. There is no display : the "SPI bus" is a
+// simulated panel that decodes the command stream (CASET, PASET, RAMWR, RAMRD, MADCTL) into an
+// RGB565 memory of TFT_WIDTH x TFT_HEIGHT pixels. Everything above the bus (setWindow, readPixel,
+// fonts, sprites) is the unchanged library code. Bytes and transactions are counted, with the time
+// they would take at SPI_FREQUENCY / SPI_READ_FREQUENCY. Snapshots in PPM or PNG.
+// 16-bit colour SPI panels only (not 18-bit, not parallel).
+// Arduino.h, Print.h and SPI.h come from tools/host/arduino.
+
+#ifndef _TFT_eSPI_LINUXH_
+#define _TFT_eSPI_LINUXH_
+
+#if defined (TFT_PARALLEL_8_BIT) || defined (TFT_PARALLEL_16_BIT) || defined (SPI_18BIT_DRIVER) || defined (RPI_DISPLAY_TYPE)
+  #error "TFT_LINUX_FB : 16-bit colour SPI panels only"
+#endif
+
+// Processor ID reported by getSetup()
+#define PROCESSOR_ID 0x1F00
+
+// Processor specific code used by SPI bus transaction startWrite and endWrite functions
+#define SET_BUS_WRITE_MODE // Not used
+#define SET_BUS_READ_MODE  // Not used
+
+// Code to check if DMA is busy, used by SPI bus transaction startWrite and endWrite functions
+#define DMA_BUSY_CHECK // Not used so leave blank
+
+#if !defined (SUPPORT_TRANSACTIONS)
+  #define SUPPORT_TRANSACTIONS
+#endif
+
+// Initialise processor specific SPI functions, used by init()
+#define INIT_TFT_DATA_BUS
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Simulated panel on the SPI bus
+////////////////////////////////////////////////////////////////////////////////////////
+class TFT_eSPI_FB
+{
+  public:
+    TFT_eSPI_FB();
+
+    // SPIClass functions used by TFT_eSPI
+    void     begin() {}
+    void     end() {}
+    void     setFrequency(uint32_t freq);
+    uint8_t  transfer(uint8_t data);   // Returns the RAMRD bytes after a RAMRD command
+    void     transfer16(uint16_t data)
+    {
+      if (_ramWrite && !_dc && !_half) { writePixel(data); return; }
+      transfer(data >> 8); transfer(data);
+    }
+
+    // CS and DC lines
+    void     select(bool low);
+    void     command(bool low) { _dc = low; }
+
+    // RAMWR data without going through the byte decoder (same bytes counted)
+    void     writePixel(uint16_t color)
+    {
+      stats.bytesWritten += 2; _busBits += 16;
+      stats.pixels++;
+      put(color);
+    }
+    void     writePixels(uint16_t color, uint32_t len);
+
+    // Panel memory
+    uint16_t* memory() { return _mem; }      // TFT_WIDTH x TFT_HEIGHT, panel orientation
+    int32_t  width() const;                  // As addressed with the current MADCTL (rotation)
+    int32_t  height() const;
+    uint16_t pixel(int32_t x, int32_t y) const;
+    void     fill(uint16_t color);
+    uint32_t checksum() const;               // FNV-1a of the pixels as seen with the rotation
+
+    // Snapshots as seen with the current rotation
+    bool     savePPM(const char* fileName) const;
+    bool     savePNG(const char* fileName) const;
+    // Compare with a PPM snapshot : number of different pixels, -1 if unreadable or another size
+    int32_t  comparePPM(const char* fileName, const char* diffName = nullptr) const;
+
+    // SPI counters
+    struct Stats
+    {
+      uint64_t bytesWritten;
+      uint64_t bytesRead;
+      uint64_t transactions;  // CS assertions
+      uint64_t commands;
+      uint64_t pixels;        // Written by RAMWR
+      double   busUs;         // Time on the bus at the programmed frequencies
+    } stats;
+    void     resetStats();
+
+  private:
+    uint32_t physical(int32_t x, int32_t y) const;
+    void     put(uint16_t color)
+    {
+      if ((uint32_t)_wx < (uint32_t)_lw && (uint32_t)_wy < (uint32_t)_lh) _mem[physical(_wx, _wy)] = color;
+      if (++_wx > _xe) { _wx = _xs; if (++_wy > _ye) _wy = _ys; }
+    }
+    uint8_t  readByte();
+    void     flushBusTime();
+
+    uint16_t _mem[TFT_WIDTH * TFT_HEIGHT];
+    uint8_t  _madctl;
+    bool     _cs, _dc, _ramWrite, _ramRead, _half;
+    uint8_t  _cmd, _nbParams, _params[4], _hi;
+    int32_t  _lw, _lh;                       // Addressed size (MADCTL MV)
+    int32_t  _xs, _xe, _ys, _ye, _wx, _wy;   // Window, write position
+    int32_t  _rx, _ry;                       // Read position
+    uint32_t _rdByte;
+    uint16_t _rdColor;
+    uint32_t _freq;
+    uint64_t _busBits;
+};
+
+extern TFT_eSPI_FB tft_fb;
+typedef TFT_eSPI_FB SPIClass; // getSPIinstance()
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Define the DC (TFT Data/Command or Register Select (RS))pin drive code
+////////////////////////////////////////////////////////////////////////////////////////
+#define DC_C tft_fb.command(true)
+#define DC_D tft_fb.command(false)
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Define the CS (TFT chip select) pin drive code
+////////////////////////////////////////////////////////////////////////////////////////
+#define CS_L tft_fb.select(true)
+#define CS_H tft_fb.select(false)
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Make sure TFT_RD is defined if not used to avoid an error message
+////////////////////////////////////////////////////////////////////////////////////////
+#ifndef TFT_RD
+  #define TFT_RD -1
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Define the touch screen chip select pin drive code
+////////////////////////////////////////////////////////////////////////////////////////
+#define T_CS_L // No touch controller
+#define T_CS_H
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Make sure TFT_MISO is defined if not used to avoid an error message
+////////////////////////////////////////////////////////////////////////////////////////
+#ifndef TFT_MISO
+  #define TFT_MISO -1
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Macros to write commands/pixel colour data to the simulated panel
+////////////////////////////////////////////////////////////////////////////////////////
+#define tft_Write_8(C)   spi.transfer(C)
+#define tft_Write_16(C)  spi.transfer16(C)
+#define tft_Write_16S(C) spi.transfer16((uint16_t)(((C)>>8) | ((C)<<8)))
+
+#define tft_Write_32(C) \
+  tft_Write_16((uint16_t) ((C)>>16)); \
+  tft_Write_16((uint16_t) ((C)>>0))
+
+#define tft_Write_32C(C,D) \
+  tft_Write_16((uint16_t) (C)); \
+  tft_Write_16((uint16_t) (D))
+
+#define tft_Write_32D(C) \
+  tft_Write_16((uint16_t) (C)); \
+  tft_Write_16((uint16_t) (C))
+
+#ifndef tft_Write_16N
+  #define tft_Write_16N tft_Write_16
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////
+// Macros to read from display using SPI
+////////////////////////////////////////////////////////////////////////////////////////
+#define tft_Read_8() spi.transfer(0)
+
+#endif // Header end
@@ -93,7 +93,10 @@
 #endif
 
 // Include the processor specific drivers
-#if defined(CONFIG_IDF_TARGET_ESP32S3)
+#if defined (TFT_LINUX_FB) // F4LAA : simulated panel for host builds
+  #include "Processors/TFT_eSPI_Linux.h"
+  #define GENERIC_PROCESSOR
+#elif defined(CONFIG_IDF_TARGET_ESP32S3)
   #include "Processors/TFT_eSPI_ESP32_S3.h"
 #elif defined(CONFIG_IDF_TARGET_ESP32C3)
   #include "Processors/TFT_eSPI_ESP32_C3.h"
@@ -0,0 +1,35 @@
+/*
+ F4LAA : CW Decoder, trous entre 2 acquisitions (voir AcqMonitor.h)
+*/
+#include "AcqMonitor.h"
+
+void AcqMonitor::block(uint32_t start, uint32_t end)
+{
+  if (started)
+  {
+    uint32_t gap = start - lastEnd;
+    gaps += gap;
+    if (gap > wGapMax)
+      wGapMax = gap;
+    if (gap > maxGap)
+    {
+      wOverruns++;
+      totalOverruns++;
+    }
+  }
+  started = true;
+  sampled += end - start;
+  lastEnd = end;
+}
+
+void AcqMonitor::window()
+{
+  uint32_t elapsed = sampled + gaps;
+  dutyPermil = elapsed ? (uint16_t) ((uint64_t) sampled * 1000 / elapsed) : 1000;
+  gapMax = wGapMax;
+  overruns = wOverruns;
+  sampled = 0;
+  gaps = 0;
+  wGapMax = 0;
+  wOverruns = 0;
+}
@@ -0,0 +1,64 @@
+/*
+ F4LAA : CW Decoder, compression IMA-ADPCM (voir Adpcm.h)
+*/
+#include "Adpcm.h"
+
+static const int16_t stepTable[89] = {
+  7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+  50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+  337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+  2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+  15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int8_t indexTable[16] = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+
+// Same reconstruction in the encoder and the decoder
+static inline void step(AdpcmState &state, uint8_t code)
+{
+  int s = stepTable[state.index];
+  int diff = s >> 3;
+  if (code & 4) diff += s;
+  if (code & 2) diff += s >> 1;
+  if (code & 1) diff += s >> 2;
+  int p = state.predictor + ((code & 8) ? -diff : diff);
+  state.predictor = (p > 32767) ? 32767 : ((p < -32768) ? -32768 : p);
+  int i = state.index + indexTable[code];
+  state.index = (i < 0) ? 0 : ((i > 88) ? 88 : i);
+}
+
+void adpcmEncode(AdpcmState &state, const int16_t *in, int n, uint8_t *out)
+{
+  for (int i = 0; i < n; i++)
+  {
+    int s = stepTable[state.index];
+    int diff = in[i] - state.predictor;
+    uint8_t code = 0;
+    if (diff < 0)
+    {
+      code = 8;
+      diff = -diff;
+    }
+    if (diff >= s) { code |= 4; diff -= s; }
+    s >>= 1;
+    if (diff >= s) { code |= 2; diff -= s; }
+    s >>= 1;
+    if (diff >= s) code |= 1;
+    step(state, code);
+
+    if (i & 1)
+      out[i >> 1] |= code << 4;
+    else
+      out[i >> 1] = code;
+  }
+}
+
+void adpcmDecode(AdpcmState &state, const uint8_t *in, int n, int16_t *out)
+{
+  for (int i = 0; i < n; i++)
+  {
+    uint8_t code = (i & 1) ? in[i >> 1] >> 4 : in[i >> 1] & 0x0F;
+    step(state, code);
+    out[i] = state.predictor;
+  }
+}
@@ -0,0 +1,641 @@
+/*
+ F4LAA : CW Decoder, étage de décision (voir CWDecoder.h)
+*/
+#include <string.h>
+#include <math.h>
+#include "CWDecoder.h"
+#include "Profiler.h"
+#include "EventTrace.h"
+
+#define HIGH 1
+#define LOW 0
+
+// Adaptive timing model
+#define ADAPT_SPEED 4   // Rolling average over 4 values
+#define ADAPT_RESCALE 3 // Consecutive too short / too long marks before a speed change is assumed
+#define ADAPT_LEARN 8   // First marks : the first one may be a dash, rescale at once
+
+// Confidence
+#define CONF_SNRMIN 6.0  // dB : confidence 0
+#define CONF_SNRMAX 20.0 // dB : full confidence
+#define CONF_NOISESPEED 16
+
+// Timing margin of x against a threshold [0..1] : 0 on the threshold,
+// 1 when x is scale times above or below it (the average of its class)
+static float margin(float x, float threshold, float scale)
+{
+  if ((x <= 0) || (threshold <= 0) || (scale <= 1))
+    return 0;
+  float m = fabs(log(x / threshold)) / log(scale);
+  return (m > 1) ? 1 : m;
+}
+
+CWDecoder::CWDecoder()
+{
+  clearCodeBuffer();
+}
+
+void CWDecoder::clearCodeBuffer()
+{
+  for (int i = 0; i < MAXTIMES; i++)
+    dTimes[i] = 0;
+  iTimes = -1;
+  CodeBuffer[0] = '\0';
+  bufLen = 0;
+  for (int i = 0; i < bufSize; i++)
+    gapMargins[i] = 100;
+  charMargin = 1;
+  charMarkMag = 0;
+}
+
+float CWDecoder::snr() const
+{
+  if (charMarkMag <= 0)
+    return 0;
+  return charMarkMag / ((noiseAvg > 1) ? noiseAvg : 1);
+}
+
+void CWDecoder::resetTiming()
+{
+  starttimehigh = 0;
+  starttimelow = 0;
+  lowduration = 0;
+  highduration = 0;
+  scheduleEndOfChar(timers.now());
+  if (events)
+    events->add(timers.now(), EV_RESET);
+}
+
+// As if marks at this speed had already been decoded : the first characters after a reboot
+// are decoded without waiting for the timing to be learnt. Still in learning mode (nbMarks = 0) :
+// a wrong speed is corrected on the first marks.
+void CWDecoder::warmStart(int lastWpm, int limit)
+{
+  if (lastWpm <= 0)
+    return;
+  float dot = 1200.0 / lastWpm;
+  wpm = lastWpm;
+  hightimesavg = dot;
+  dotAvg = 0;
+  rescale(dot);
+  nbMarks = ADAPT_LEARN; // The saved speed is trusted : a mark far from it is noise, unless they keep coming
+  magnitudelimit = (limit > magnitudelimit_low) ? limit : magnitudelimit_low;
+}
+
+void CWDecoder::onBlanker(void *ctx)
+{
+  ((CWDecoder *) ctx)->stable = true;
+}
+
+void CWDecoder::onEndOfChar(void *ctx)
+{
+  ((CWDecoder *) ctx)->endOfCharDue = true;
+}
+
+// End of character : no new element for a long time after starttimelow
+void CWDecoder::scheduleEndOfChar(unsigned long now)
+{
+  endOfCharDue = false;
+  timers.cancel(endOfChar);
+  long limit;
+  if (model == TIMING_ADAPTIVE)
+  {
+    if (filteredstate != LOW)
+      return;
+    limit = sqrt(charGapAvg * wordGapAvg); // Beyond letter space
+  }
+  else
+    limit = highduration * 6;
+  unsigned long expires = starttimelow + limit + 1;
+  if ((long) (expires - now) <= 0)
+    endOfCharDue = true;
+  else
+  {
+    endOfChar.callback = onEndOfChar;
+    endOfChar.ctx = this;
+    timers.schedule(endOfChar, expires);
+  }
+}
+
+// Same fields, in the same order
+#define STATE_FIELDS(X) \
+  X(nbTime) X(spaceDetector) X(magReactivity) X(model) \
+  X(magnitudelimit) X(magnitudelimit_low) X(realstate) X(realstatebefore) X(filteredstate) X(filteredstatebefore) \
+  X(laststarttime) X(starttimehigh) X(highduration) X(starttimelow) X(lowduration) X(hightimesavg) X(stop) X(wpm) \
+  X(bufLen) X(iTimes) X(dotAvg) X(dashAvg) X(elemGapAvg) X(charGapAvg) X(wordGapAvg) \
+  X(noiseAvg) X(charMargin) X(charMarkMag) X(nbMarks) X(nbShort) X(nbLong) X(gapStart) \
+  X(markMagSum) X(markMagCnt) X(stable) X(endOfCharDue)
+
+void CWDecoder::save(CWDecoderState &s) const
+{
+#define SAVE(f) s.f = f;
+  STATE_FIELDS(SAVE)
+  memcpy(s.CodeBuffer, CodeBuffer, bufSize);
+  memcpy(s.elemMargins, elemMargins, bufSize);
+  memcpy(s.gapMargins, gapMargins, bufSize);
+  for (int i = 0; i < MAXTIMES; i++)
+    s.dTimes[i] = dTimes[i];
+  s.now = timers.now();
+  s.blankerPending = blanker.pending();
+  s.blankerExpires = blanker.expires;
+  s.endOfCharPending = endOfChar.pending();
+  s.endOfCharExpires = endOfChar.expires;
+}
+
+void CWDecoder::restore(const CWDecoderState &s)
+{
+#define RESTORE(f) f = s.f;
+  STATE_FIELDS(RESTORE)
+  memcpy(CodeBuffer, s.CodeBuffer, bufSize);
+  memcpy(elemMargins, s.elemMargins, bufSize);
+  memcpy(gapMargins, s.gapMargins, bufSize);
+  for (int i = 0; i < MAXTIMES; i++)
+    dTimes[i] = s.dTimes[i];
+  timers.start(s.now);
+  if (s.blankerPending)
+  {
+    blanker.callback = onBlanker;
+    blanker.ctx = this;
+    timers.schedule(blanker, s.blankerExpires);
+  }
+  if (s.endOfCharPending)
+  {
+    endOfChar.callback = onEndOfChar;
+    endOfChar.ctx = this;
+    timers.schedule(endOfChar, s.endOfCharExpires);
+  }
+  nbDecoded = 0;
+}
+
+void CWDecoder::addTime(int t)
+{
+  if (iTimes < MAXTIMES - 1)
+  {
+    iTimes++;
+    dTimes[iTimes] = t;
+  }
+}
+
+void CWDecoder::addElement(char element, int duration, float margin)
+{
+  char s[2] = { element, '\0' };
+  strcat(CodeBuffer, s);
+  if (events)
+    events->add(timers.now(), EV_ELEMENT, element, margin * 100, duration);
+  addTime(duration);
+  if (bufLen < bufSize)
+    elemMargins[bufLen] = margin * 100;
+  bufLen++;
+  addMargin(margin);
+
+  // Magnitude of this element (the mark which just ended)
+  if (markMagCnt > 0)
+  {
+    float mag = markMagSum / markMagCnt;
+    if ((charMarkMag == 0) || (mag < charMarkMag))
+      charMarkMag = mag;
+  }
+}
+
+// Space after the last element
+void CWDecoder::setGapMargin(float m)
+{
+  if ((bufLen > 0) && (bufLen <= bufSize))
+    gapMargins[bufLen - 1] = m * 100;
+}
+
+void CWDecoder::emit(char c, float margin)
+{
+  if (nbDecoded == MAXDECODED)
+    return;
+  DecodedChar &d = decoded[nbDecoded++];
+  d.c = c;
+  for (int i = 0; i < MAXTIMES; i++)
+    d.times[i] = (c == ' ') ? 0 : dTimes[i];
+  strcpy(d.code, (c == ' ') ? "" : CodeBuffer);
+  memcpy(d.elemMargins, elemMargins, bufSize);
+  memcpy(d.gapMargins, gapMargins, bufSize);
+
+  float conf = margin;
+  if (c != ' ')
+  {
+    float s = snr();
+    float score = (s > 0) ? ((20 * log10(s)) - CONF_SNRMIN) / (CONF_SNRMAX - CONF_SNRMIN) : 0;
+    if (score < 0) score = 0;
+    if (score > 1) score = 1;
+    conf *= score;
+  }
+  d.confidence = (uint8_t) ((conf * 100) + 0.5);
+}
+
+void CWDecoder::CodeToChar() {
+  PROF_SCOPE(PROF_CODETOCHAR);
+  char decodedChar = toChar(CodeBuffer);
+  int32_t code = 1;
+  for (const char *p = CodeBuffer; *p; p++)
+    code = (code << 1) | (*p == '-');
+  if (events)
+    events->add(timers.now(), EV_CHAR, decodedChar, strlen(CodeBuffer), code);
+  if (decodedChar != '{')
+    emit(decodedChar, charMargin);
+  clearCodeBuffer();
+}
+
+char CWDecoder::toChar(const char *CodeBuffer) { // translate cw code to ascii character//
+  char decodedChar = '{';
+  if (strcmp(CodeBuffer,".-") == 0)      decodedChar = char('a');
+  if (strcmp(CodeBuffer,"-...") == 0)    decodedChar = char('b');
+  if (strcmp(CodeBuffer,"-.-.") == 0)    decodedChar = char('c');
+  if (strcmp(CodeBuffer,"-..") == 0)     decodedChar = char('d');
+  if (strcmp(CodeBuffer,".") == 0)       decodedChar = char('e');
+  if (strcmp(CodeBuffer,"..-.") == 0)    decodedChar = char('f');
+  if (strcmp(CodeBuffer,"--.") == 0)     decodedChar = char('g');
+  if (strcmp(CodeBuffer,"....") == 0)    decodedChar = char('h');
+  if (strcmp(CodeBuffer,"..") == 0)      decodedChar = char('i');
+  if (strcmp(CodeBuffer,".---") == 0)    decodedChar = char('j');
+  if (strcmp(CodeBuffer,"-.-") == 0)     decodedChar = char('k');
+  if (strcmp(CodeBuffer,".-..") == 0)    decodedChar = char('l');
+  if (strcmp(CodeBuffer,"--") == 0)      decodedChar = char('m');
+  if (strcmp(CodeBuffer,"-.") == 0)      decodedChar = char('n');
+  if (strcmp(CodeBuffer,"---") == 0)     decodedChar = char('o');
+  if (strcmp(CodeBuffer,".--.") == 0)    decodedChar = char('p');
+  if (strcmp(CodeBuffer,"--.-") == 0)    decodedChar = char('q');
+  if (strcmp(CodeBuffer,".-.") == 0)     decodedChar = char('r');
+  if (strcmp(CodeBuffer,"...") == 0)     decodedChar = char('s');
+  if (strcmp(CodeBuffer,"-") == 0)       decodedChar = char('t');
+  if (strcmp(CodeBuffer,"..-") == 0)     decodedChar = char('u');
+  if (strcmp(CodeBuffer,"...-") == 0)    decodedChar = char('v');
+  if (strcmp(CodeBuffer,".--") == 0)     decodedChar = char('w');
+  if (strcmp(CodeBuffer,"-..-") == 0)    decodedChar = char('x');
+  if (strcmp(CodeBuffer,"-.--") == 0)    decodedChar = char('y');
+  if (strcmp(CodeBuffer,"--..") == 0)    decodedChar = char('z');
+
+  if (strcmp(CodeBuffer,".----") == 0)   decodedChar = char('1');
+  if (strcmp(CodeBuffer,"..---") == 0)   decodedChar = char('2');
+  if (strcmp(CodeBuffer,"...--") == 0)   decodedChar = char('3');
+  if (strcmp(CodeBuffer,"....-") == 0)   decodedChar = char('4');
+  if (strcmp(CodeBuffer,".....") == 0)   decodedChar = char('5');
+  if (strcmp(CodeBuffer,"-....") == 0)   decodedChar = char('6');
+  if (strcmp(CodeBuffer,"--...") == 0)   decodedChar = char('7');
+  if (strcmp(CodeBuffer,"---..") == 0)   decodedChar = char('8');
+  if (strcmp(CodeBuffer,"----.") == 0)   decodedChar = char('9');
+  if (strcmp(CodeBuffer,"-----") == 0)   decodedChar = char('0');
+
+  if (strcmp(CodeBuffer,"..--..") == 0)  decodedChar = char('?');
+  if (strcmp(CodeBuffer,".-.-.-") == 0)  decodedChar = char('.');
+  if (strcmp(CodeBuffer,"--..--") == 0)  decodedChar = char(',');
+  if (strcmp(CodeBuffer,"-.-.--") == 0)  decodedChar = char('!');
+  if (strcmp(CodeBuffer,".--.-.") == 0)  decodedChar = char('@');
+  if (strcmp(CodeBuffer,"---...") == 0)  decodedChar = char(':');
+  if (strcmp(CodeBuffer,"-....-") == 0)  decodedChar = char('-');
+  if (strcmp(CodeBuffer,"-..-.") == 0)   decodedChar = char('/');
+
+  if (strcmp(CodeBuffer,"-.--.") == 0)   decodedChar = char('(');
+  if (strcmp(CodeBuffer,"-.--.-") == 0)  decodedChar = char(')');
+  if (strcmp(CodeBuffer,".-...") == 0)   decodedChar = char('_');
+  if (strcmp(CodeBuffer,"...-..-") == 0) decodedChar = char('$');
+  if (strcmp(CodeBuffer,"...-.-") == 0)  decodedChar = char('>');
+  if (strcmp(CodeBuffer,".-.-.") == 0)   decodedChar = char('<');
+  if (strcmp(CodeBuffer,"...-.") == 0)   decodedChar = char('~');
+  if (strcmp(CodeBuffer,".-.-") == 0)    decodedChar = char('a'); // a umlaut
+  if (strcmp(CodeBuffer,"---.") == 0)    decodedChar = char('o'); // o accent
+  if (strcmp(CodeBuffer,".--.-") == 0)   decodedChar = char('a'); // a accent
+
+  return decodedChar;
+}
+
+void CWDecoder::process(float magnitude, unsigned long now, bool decode)
+{
+  nbDecoded = 0;
+  timers.advance(now);
+
+  // Adjust magnitudelimit
+  if (magnitude > magnitudelimit_low) { magnitudelimit = (magnitudelimit + ((magnitude - magnitudelimit) / magReactivity)); } /// moving average filter
+  if (magnitudelimit < magnitudelimit_low) magnitudelimit = magnitudelimit_low;
+  if (events)
+    events->threshold(now, magnitudelimit);
+
+  // Now check the magnitude //
+  if (magnitude > magnitudelimit * 0.3) // just to have some space up
+    realstate = HIGH;
+  else
+    realstate = LOW;
+
+  // Clean up the state with a noise blanker //
+  if (realstate != realstatebefore)
+  {
+    if (events)
+      events->add(now, EV_REAL, realstate);
+    laststarttime = now;
+    stable = false;
+    blanker.callback = onBlanker; // ctx set here : the decoder may have been copied
+    blanker.ctx = this;
+    timers.schedule(blanker, now + nbTime + 1);
+  }
+  if (stable)
+  {
+    if (realstate != filteredstate)
+    {
+      filteredstate = realstate;
+    }
+  }
+
+  // Magnitudes for the SNR
+  if (filteredstate == HIGH)
+  {
+    if (filteredstatebefore != HIGH)
+    {
+      markMagSum = 0;
+      markMagCnt = 0;
+    }
+    markMagSum += magnitude;
+    markMagCnt++;
+  }
+  else
+    noiseAvg += (magnitude - noiseAvg) / CONF_NOISESPEED;
+
+  if (filteredstate != filteredstatebefore)
+  {
+    if (filteredstate == HIGH)
+    {
+      // front montant
+      starttimehigh = now;
+      lowduration = (starttimehigh - starttimelow);
+      if (events)
+        events->add(now, EV_EDGE, HIGH, 0, lowduration);
+    }
+
+    if (filteredstate == LOW)
+    {
+      // front descendant
+      starttimelow = now;
+      highduration = (starttimelow - starttimehigh);
+
+      // Strange cumputation of hightimesavg (very low compared to average of highduration )
+      if ( (highduration < (2 * hightimesavg)) || (hightimesavg == 0) )
+      {
+        hightimesavg = (highduration + hightimesavg + hightimesavg) / 3; // now we know avg dit time ( rolling 3 avg)
+      }
+      if (highduration > (5 * hightimesavg) )
+      {
+        hightimesavg = highduration + hightimesavg;   // if speed decrease fast ..
+      }
+      if (events)
+      {
+        events->add(now, EV_EDGE, LOW, 0, highduration);
+        events->add(now, EV_HIGHAVG, 0, dotAvg, hightimesavg);
+      }
+    }
+  }
+
+  if (decode) // Not in search frequency mode
+  {
+    // Now check the baud rate based on dit or dah duration either 1, 3 or 7 pauses
+    if (filteredstate != filteredstatebefore) {
+      stop = LOW;
+      if (filteredstate == LOW) { // we did end on a HIGH
+        if (model == TIMING_ADAPTIVE)
+          adaptiveMark();
+        else
+          classicMark();
+      }
+
+      if (filteredstate == HIGH) { // we did end a LOW
+        if (model == TIMING_ADAPTIVE)
+          gapStart = starttimelow; // The space is classified with the next mark (which may be noise)
+        else
+          classicSpace();
+      }
+    } // filteredstate != filteredstatebefore
+  }
+
+  if (filteredstate != filteredstatebefore)
+    scheduleEndOfChar(now);
+
+  if (decode)
+  {
+    if (endOfCharDue && stop == LOW) {
+      CodeToChar();
+      stop = HIGH;
+    }
+
+    // Sécurité buffer overflow
+    if (strlen(CodeBuffer) == bufSize - 1) {
+      // On a reçu des . et -, mais pas de silence...
+      clearCodeBuffer();
+    }
+  }
+
+  // the end of main loop clean up//
+  realstatebefore     = realstate;
+  filteredstatebefore = filteredstate;
+}
+
+// ===== TIMING_G6EJD : everything is based on hightimesavg =====
+
+void CWDecoder::classicMark()
+{
+  if (highduration < (hightimesavg * 2) && highduration > (hightimesavg * 0.6)) { /// 0.6 filter out false dits
+    addElement('.', highduration, margin(highduration, hightimesavg * 2, 1.5)); // Dot duration
+  }
+
+  if (highduration > (hightimesavg * 2) && highduration < (hightimesavg * 6)) {
+    addElement('-', highduration, margin(highduration, hightimesavg * 2, 1.5)); // Dash duration
+
+    if ( (highduration > 66) // Ignore too short highduration caused by silent
+         &&
+         (highduration < 500) // Ignore too long highduration caused by silent
+       )
+    {
+      // Compute WPM based on Dash
+      wpm = (wpm + (1200 / ((highduration) / 3))) / 2; //// the most precise we can do ;o)
+    }
+  }
+}
+
+void CWDecoder::classicSpace()
+{
+  float lacktime = 1;
+  if (wpm > 25) lacktime = 1.0; ///  when high speeds we have to have a little more pause before new letter or new word
+  if (wpm > 30) lacktime = 1.2;
+  if (wpm > 35) lacktime = 1.5;
+
+  bool storeTime = true;
+  float letterMargin = margin(lowduration, hightimesavg * (2 * lacktime), 1.5);
+  float wordMargin = margin(lowduration, hightimesavg * (spaceDetector * lacktime), 1.4);
+  if (lowduration > (hightimesavg * (2 * lacktime)) && lowduration < hightimesavg * (5 * lacktime)) { // letter space
+      storeTime = false;
+      setGapMargin(letterMargin);
+      addMargin(letterMargin);
+      addMargin(wordMargin);
+      CodeToChar();
+  }
+
+  if (lowduration >= hightimesavg * (spaceDetector * lacktime)) { // word space
+    storeTime = false;
+    addMargin(wordMargin);
+    CodeToChar();
+    emit(' ', wordMargin);
+  }
+
+  if (storeTime)
+  {
+    addTime(lowduration); // Silent inside char
+    setGapMargin(letterMargin);
+    addMargin(letterMargin);
+  }
+}
+
+// ===== TIMING_ADAPTIVE : separate averages for each kind of mark and space =====
+// Limits are the geometric means of the 2 neighbour averages, so they follow
+// the weighting (dash/dot ratio) and the Farnsworth spacing of the operator.
+// A space is only classified when the mark which ends it is accepted : a noise
+// mark inside a word space must not split it in 2 letter spaces.
+
+void CWDecoder::rescale(float dot)
+{
+  float k = (dotAvg > 0) ? dot / dotAvg : 0;
+  if (k == 0)
+  {
+    // First mark : standard timing 1:3:7
+    dotAvg = dot;
+    dashAvg = 3 * dot;
+    elemGapAvg = dot;
+    charGapAvg = 3 * dot;
+    wordGapAvg = 7 * dot;
+  }
+  else
+  {
+    // Speed change : keep the measured ratios
+    dotAvg *= k;
+    dashAvg *= k;
+    elemGapAvg *= k;
+    charGapAvg *= k;
+    wordGapAvg *= k;
+  }
+  nbShort = 0;
+  nbLong = 0;
+}
+
+// Learning : the first mark was a dash taken for a dot (the speed was too low). The elements of the
+// character in progress are classified again with the new averages ("t" of "the" was decoded "e").
+void CWDecoder::reclassify()
+{
+  float limit = sqrt(dotAvg * dashAvg);
+  for (int i = 0; (i < bufLen) && (i < bufSize - 1) && (2 * i <= iTimes); i++)
+    if ((CodeBuffer[i] == '.') && (dTimes[2 * i] >= limit)) // Elements and spaces alternate in dTimes
+    {
+      CodeBuffer[i] = '-';
+      elemMargins[i] = margin(dTimes[2 * i], limit, sqrt(dashAvg / dotAvg)) * 100;
+    }
+}
+
+void CWDecoder::adaptiveMark()
+{
+  float d = highduration;
+  bool first = (dotAvg == 0);
+  if (first)
+    rescale(d);
+
+  // Marks far too short or far too long are noise, unless they keep coming (speed change)
+  if (d < dotAvg * 0.5)
+  {
+    nbLong = 0;
+    if ((++nbShort < ADAPT_RESCALE) && (nbMarks >= ADAPT_LEARN))
+    {
+      starttimelow = gapStart; // Ignore it : the space goes on
+      return;
+    }
+    rescale(d);
+    if (nbMarks < ADAPT_LEARN)
+      reclassify();
+  }
+  else if (d > dashAvg * 2.5)
+  {
+    nbShort = 0;
+    if ((++nbLong < ADAPT_RESCALE) && (nbMarks >= ADAPT_LEARN))
+    {
+      starttimelow = gapStart;
+      return;
+    }
+    rescale(d / dashDotRatio());
+  }
+  nbShort = 0;
+  nbLong = 0;
+  if (nbMarks < ADAPT_LEARN)
+    nbMarks++;
+
+  // The space before this mark
+  lowduration = starttimehigh - gapStart;
+  if (!first)
+    adaptiveSpace();
+
+  float m = margin(d, sqrt(dotAvg * dashAvg), sqrt(dashAvg / dotAvg));
+  if (d < sqrt(dotAvg * dashAvg))
+  {
+    addElement('.', highduration, m); // Dot duration
+    dotAvg += (d - dotAvg) / ADAPT_SPEED;
+  }
+  else
+  {
+    addElement('-', highduration, m); // Dash duration
+    dashAvg += (d - dashAvg) / ADAPT_SPEED;
+  }
+
+  // Dash / dot ratio stays in [2..5]
+  if (dashAvg > dotAvg * 5)
+    dotAvg = dashAvg / 5;
+  if (dashAvg < dotAvg * 2)
+    dashAvg = dotAvg * 2;
+
+  wpm = 4800 / (dotAvg + dashAvg); // dot + dash = 4 units, 1 unit = 1200 / wpm
+}
+
+void CWDecoder::adaptiveSpace()
+{
+  float g = lowduration;
+  float letterMargin = margin(g, sqrt(elemGapAvg * charGapAvg), sqrt(charGapAvg / elemGapAvg));
+  float wordMargin = margin(g, sqrt(charGapAvg * wordGapAvg), sqrt(wordGapAvg / charGapAvg));
+
+  if (g < sqrt(elemGapAvg * charGapAvg))
+  {
+    // Silent inside char
+    addTime(lowduration);
+    setGapMargin(letterMargin);
+    addMargin(letterMargin);
+    if (g > dotAvg * 0.3)
+      elemGapAvg += (g - elemGapAvg) / ADAPT_SPEED;
+  }
+  else if (g < sqrt(charGapAvg * wordGapAvg))
+  {
+    // Letter space
+    setGapMargin(letterMargin);
+    addMargin(letterMargin);
+    addMargin(wordMargin);
+    CodeToChar();
+    charGapAvg += (g - charGapAvg) / ADAPT_SPEED;
+  }
+  else
+  {
+    // Word space
+    addMargin(wordMargin);
+    CodeToChar();
+    emit(' ', wordMargin);
+    if (g < wordGapAvg * 3) // Not a pause
+    {
+      wordGapAvg += (g - wordGapAvg) / ADAPT_SPEED;
+      if (g < wordGapAvg)
+        charGapAvg += (g - charGapAvg) / (2 * ADAPT_SPEED); // Farnsworth : letter spaces may all be above the initial limit
+    }
+  }
+
+  // Keep the 3 kinds of space apart
+  if (elemGapAvg < dotAvg * 0.5)
+    elemGapAvg = dotAvg * 0.5;
+  if (elemGapAvg > dotAvg * 2)
+    elemGapAvg = dotAvg * 2;
+  if (charGapAvg < elemGapAvg * 2)
+    charGapAvg = elemGapAvg * 2;
+  if (wordGapAvg < charGapAvg * 1.8)
+    wordGapAvg = charGapAvg * 1.8;
+}
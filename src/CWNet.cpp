@@ -0,0 +1,111 @@
+/*
+ F4LAA : CW Decoder, décodeur neuronal de l'enveloppe (voir CWNet.h)
+*/
+#include "CWNet.h"
+#include "CWNetWeights.h"
+
+#define LUTSIZE (1 << CWNET_LUTBITS)
+
+// Q15 values of sigmoid and tanh on [-8..8[, filled once (RAM, no allocation)
+static int16_t sigmoidLut[LUTSIZE];
+static int16_t tanhLut[LUTSIZE];
+static bool lutReady = false;
+
+static void initLuts()
+{
+  for (int i = 0; i < LUTSIZE; i++)
+  {
+    float v = (i + 0.5f - LUTSIZE / 2) * 16.0f / LUTSIZE;
+    sigmoidLut[i] = (int16_t) (32767 / (1 + exp(-v)) + 0.5f);
+    tanhLut[i] = (int16_t) (32767 * tanh(v) + ((v < 0) ? -0.5f : 0.5f));
+  }
+  lutReady = true;
+}
+
+// Q10 ==> Q15
+static inline int32_t lut(const int16_t *table, int32_t q10)
+{
+  int32_t i = (q10 + (8 << 10)) >> (14 - CWNET_LUTBITS);
+  if (i < 0) i = 0;
+  if (i >= LUTSIZE) i = LUTSIZE - 1;
+  return table[i];
+}
+
+// Rows of w (int8) times v (Q7) ==> Q10
+static void matVec(const int8_t *w, const int32_t *mul, const int32_t *bias, const int8_t *v, int nbRows, int nbCols, int32_t *out)
+{
+  for (int r = 0; r < nbRows; r++)
+  {
+    const int8_t *row = w + r * nbCols;
+    int32_t acc = 0;
+    for (int c = 0; c < nbCols; c++)
+      acc += row[c] * v[c];
+    out[r] = (int32_t) (((int64_t) acc * mul[r]) >> 16) + bias[r];
+  }
+}
+
+void CWNet::reset()
+{
+  if (!lutReady)
+    initLuts();
+  for (int i = 0; i < CWNET_HIDDEN; i++)
+    h[i] = 0;
+  features = CWNetFeatures();
+  lastClass = 0;
+  confidence = 0;
+}
+
+char CWNet::process(float magnitude, float dtMs)
+{
+  float xf[CWNET_INPUTS];
+  features.compute(magnitude, dtMs, xf);
+  int8_t x[CWNET_INPUTS];
+  for (int i = 0; i < CWNET_INPUTS; i++)
+    x[i] = (xf[i] >= 127 / 128.0f) ? 127 : (int8_t) (xf[i] * 128 + 0.5f);
+  int8_t h8[CWNET_HIDDEN];
+  for (int i = 0; i < CWNET_HIDDEN; i++)
+    h8[i] = h[i] >> 8;
+
+  // GRU : z = s(x + h), r = s(x + h), n = tanh(x + r.h), h = n + z.(h - n)
+  int32_t gx[CWNET_GATES], gh[CWNET_GATES];
+  matVec(model.wx, model.mx, model.bx, x, CWNET_GATES, CWNET_INPUTS, gx);
+  matVec(model.wh, model.mh, model.bh, h8, CWNET_GATES, CWNET_HIDDEN, gh);
+  for (int j = 0; j < CWNET_HIDDEN; j++)
+  {
+    int32_t z = lut(sigmoidLut, gx[j] + gh[j]);
+    int32_t r = lut(sigmoidLut, gx[CWNET_HIDDEN + j] + gh[CWNET_HIDDEN + j]);
+    int32_t n = lut(tanhLut, gx[2 * CWNET_HIDDEN + j] + (int32_t) (((int64_t) r * gh[2 * CWNET_HIDDEN + j]) >> 15));
+    h[j] = n + ((z * (h[j] - n)) >> 15);
+  }
+
+  // Classes : greedy CTC
+  for (int i = 0; i < CWNET_HIDDEN; i++)
+    h8[i] = h[i] >> 8;
+  int32_t logits[CWNET_CLASSES];
+  matVec(model.wo, model.mo, model.bo, h8, CWNET_CLASSES, CWNET_HIDDEN, logits);
+  int best = 0, second = 1;
+  if (logits[1] > logits[0])
+  {
+    best = 1;
+    second = 0;
+  }
+  for (int c = 2; c < CWNET_CLASSES; c++)
+    if (logits[c] > logits[best])
+    {
+      second = best;
+      best = c;
+    }
+    else if (logits[c] > logits[second])
+      second = c;
+
+  char decoded = 0;
+  if ((best != 0) && (best != lastClass))
+  {
+    decoded = classChar(best);
+    // Log-odds of the 2 best classes : 0 when equal, 100 from 4 (Q10)
+    int32_t margin = (logits[best] - logits[second]) * 100 / (4 << 10);
+    confidence = (margin > 100) ? 100 : margin;
+  }
+  lastClass = best;
+  return decoded;
+}
@@ -0,0 +1,86 @@
+/*
+ F4LAA : CW Decoder, lignes de texte décodé de l'écran TFT (voir DisplayLine.h)
+*/
+#include "TFT_eSPI.h"
+#include "DisplayLine.h"
+
+int confLevel(uint8_t confidence)
+{
+  int level = (confidence * CONFLEVELS) / 101;
+  return level + 1;
+}
+
+uint16_t confColor(uint16_t color, int level)
+{
+  uint16_t r = ((color >> 11) & 0x1F) * level / CONFLEVELS;
+  uint16_t g = ((color >> 5) & 0x3F) * level / CONFLEVELS;
+  uint16_t b = (color & 0x1F) * level / CONFLEVELS;
+  return (r << 11) | (g << 5) | b;
+}
+
+void DisplayLine::clear()
+{
+  for (int i = 0; i < nbChars; i++) text[i] = ' ';
+  for (int i = 0; i < nbChars; i++) conf[i] = 100;
+  text[nbChars] = '\0';
+}
+
+void DisplayLine::clearScreen()
+{
+  row = 0;
+  tft.fillRect(0, LINE_TOP, 480, 220, TFT_BLACK); // Clear display area
+}
+
+void DisplayLine::clearCode()
+{
+  tft.fillRect(CODE_X, posRow(), 72, LINE_HEIGHT, TFT_BLACK);
+}
+
+// Affiche la ligne en cours (intensité selon la confiance), suivie de CodeBuffer
+void DisplayLine::draw(uint16_t color, const char *codeBuffer)
+{
+  if (!enabled)
+    return;
+  tft.setCursor(0, posRow());
+  char run[nbChars + 1];
+  int i = 0;
+  while (i < nbChars)
+  {
+    // Chars with the same level are drawn at once
+    int level = confLevel(conf[i]);
+    int n = 0;
+    while ((i < nbChars) && ((text[i] == ' ') || (confLevel(conf[i]) == level)))
+      run[n++] = text[i++];
+    run[n] = '\0';
+    tft.setTextColor(confColor(color, level), TFT_BLACK);
+    tft.print(run);
+  }
+  tft.setTextColor(color, TFT_BLACK);
+  tft.println(codeBuffer);
+}
+
+void DisplayLine::add(char c, uint8_t confidence, const char *codeBuffer)
+{
+  nbAdded++;
+  if (nbAdded == nbChars)
+  {
+    nbAdded = 0;
+    draw(TFT_WHITE, codeBuffer); // Affiche aussi CodeBuffer
+    clearCode();
+    clear();
+    row++;
+    if (row > MAXLINES)
+      row = 0;
+  }
+  else
+  {
+    // Shift chars to get place for the new char
+    for (int i = 0; i < nbChars - 1; i++)
+    {
+      text[i] = text[i + 1];
+      conf[i] = conf[i + 1];
+    }
+  }
+  text[nbChars - 1] = c;
+  conf[nbChars - 1] = confidence;
+}
@@ -0,0 +1,34 @@
+/*
+ F4LAA : CW Decoder, comptage des allocations sur le tas (voir HeapStats.h)
+*/
+#include <stddef.h>
+#include "HeapStats.h"
+
+volatile uint32_t heapAllocs = 0;
+
+#ifdef HEAP_STATS
+extern "C"
+{
+  void *__real_malloc(size_t size);
+  void *__real_calloc(size_t n, size_t size);
+  void *__real_realloc(void *p, size_t size);
+
+  void *__wrap_malloc(size_t size)
+  {
+    heapAllocs = heapAllocs + 1;
+    return __real_malloc(size);
+  }
+
+  void *__wrap_calloc(size_t n, size_t size)
+  {
+    heapAllocs = heapAllocs + 1;
+    return __real_calloc(n, size);
+  }
+
+  void *__wrap_realloc(void *p, size_t size)
+  {
+    heapAllocs = heapAllocs + 1;
+    return __real_realloc(p, size);
+  }
+}
+#endif
@@ -0,0 +1,77 @@
+/*
+ F4LAA : Capture binaire des blocs de l'étage de décision (voir MagCapture.h)
+*/
+#include <string.h>
+#include "MagCapture.h"
+
+static_assert(sizeof(CaptureBlock) == 16, "CaptureBlock : 16 bytes");
+
+void MagCapture::process(CWDecoder &decoder, float magnitude, unsigned long now, bool decode, int nbSamples)
+{
+  int i = nbTotal % CAP_BLOCKS;
+  if ((i % CAP_SEGBLOCKS) == 0)
+    decoder.save(keys[i / CAP_SEGBLOCKS]);
+  unsigned long dt = now - decoder.timers.now();
+
+  decoder.process(magnitude, now, decode);
+
+  CaptureBlock &b = blocks[i];
+  b.magnitude = magnitude;
+  b.threshold = decoder.magnitudelimit;
+  b.dt = (dt > 0xFFFF) ? 0xFFFF : dt;
+  b.flags = (decoder.filteredstate ? CAP_HIGH : 0) | (decoder.realstate ? CAP_REAL : 0)
+          | (decode ? CAP_DECODE : 0) | ((decoder.model == TIMING_ADAPTIVE) ? CAP_ADAPTIVE : 0);
+  b.nbTime = decoder.nbTime;
+  b.magReactivity = decoder.magReactivity;
+  b.spaceDetector = decoder.spaceDetector;
+  b.nbSamples = (nbSamples > 255) ? 255 : nbSamples;
+  b.reserved = 0;
+  nbTotal++;
+}
+
+// From the oldest complete keyframe
+static int firstBlock(uint32_t nbTotal)
+{
+  if (nbTotal <= CAP_BLOCKS)
+    return 0;
+  int w = nbTotal % CAP_BLOCKS; // Next one written
+  int seg = w / CAP_SEGBLOCKS;
+  if ((w % CAP_SEGBLOCKS) != 0)
+    seg = (seg + 1) % CAP_SEGMENTS; // The current segment is partly overwritten
+  return seg * CAP_SEGBLOCKS;
+}
+
+int MagCapture::nbBlocks() const
+{
+  if (nbTotal <= CAP_BLOCKS)
+    return nbTotal;
+  int n = ((int) (nbTotal % CAP_BLOCKS) - firstBlock(nbTotal) + CAP_BLOCKS) % CAP_BLOCKS;
+  return n ? n : CAP_BLOCKS;
+}
+
+void MagCapture::dump(CaptureWriter write, float sampleRate, float processingRate, float freq) const
+{
+  CaptureHeader h;
+  memcpy(h.magic, "CWCP", 4);
+  h.version = CAP_VERSION;
+  h.blockSize = sizeof(CaptureBlock);
+  h.stateSize = sizeof(CWDecoderState);
+  h.nbBlocks = nbBlocks();
+  h.sampleRate = sampleRate;
+  h.processingRate = processingRate;
+  h.freq = freq;
+  int first = firstBlock(nbTotal);
+  if (h.nbBlocks > 0)
+    h.state = keys[first / CAP_SEGBLOCKS];
+  else
+    memset(&h.state, 0, sizeof(h.state));
+  write(&h, sizeof(h));
+
+  // The blocks, in 2 parts when the ring wraps around
+  int n1 = CAP_BLOCKS - first;
+  if (n1 > (int) h.nbBlocks)
+    n1 = h.nbBlocks;
+  write(&blocks[first], n1 * sizeof(CaptureBlock));
+  if (n1 < (int) h.nbBlocks)
+    write(&blocks[0], (h.nbBlocks - n1) * sizeof(CaptureBlock));
+}
@@ -0,0 +1,191 @@
+/*
+ F4LAA : CW Decoder, registre des paramètres réglables (voir Params.h)
+*/
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "Params.h"
+
+const ParamDef *ParamRegistry::find(char cde) const
+{
+  int i = index(cde);
+  return (i < 0) ? 0 : &defs[i];
+}
+
+const ParamDef *ParamRegistry::find(const char *name) const
+{
+  if (name[0] && !name[1])
+    return find((char) toupper(name[0]));
+  for (int i = 0; i < nbParams; i++)
+    if (!strcmp(defs[i].name, name))
+      return &defs[i];
+  return 0;
+}
+
+int ParamRegistry::index(char cde) const
+{
+  for (int i = 0; i < nbParams; i++)
+    if (defs[i].cde == cde)
+      return i;
+  return -1;
+}
+
+int32_t ParamRegistry::get(const ParamDef &p) const
+{
+  switch (p.type)
+  {
+    case PARAM_INT:
+    case PARAM_ENUM:
+      return *(int *) p.value;
+    case PARAM_BOOL:
+      return *(bool *) p.value;
+  }
+  return 0;
+}
+
+void ParamRegistry::set(const ParamDef &p, int32_t v)
+{
+  int32_t old = get(p);
+  switch (p.type)
+  {
+    case PARAM_INT:
+      if (v < p.min)
+        v = p.min;
+      if (v > p.max)
+        v = p.max;
+      *(int *) p.value = v;
+      break;
+    case PARAM_ENUM:
+    {
+      int32_t range = p.max - p.min + 1;
+      *(int *) p.value = p.min + (((v - p.min) % range) + range) % range;
+      break;
+    }
+    case PARAM_BOOL:
+      *(bool *) p.value = (v != 0);
+      break;
+  }
+  if (get(p) != old)
+    changes++;
+  if (p.apply)
+    p.apply();
+}
+
+void ParamRegistry::step(const ParamDef &p, int n)
+{
+  switch (p.type)
+  {
+    case PARAM_INT:
+    case PARAM_ENUM:
+      set(p, get(p) + n * p.step);
+      break;
+    case PARAM_BOOL:
+      set(p, !get(p));
+      break;
+    case PARAM_ACTION:
+      if (p.apply)
+        p.apply();
+      break;
+  }
+}
+
+void ParamRegistry::text(const ParamDef &p, ParamText &text) const
+{
+  if (p.format)
+  {
+    p.format(text);
+    return;
+  }
+  text.add(p.label);
+  if (p.type == PARAM_BOOL)
+    text.add(get(p) ? " ON" : " OFF");
+  else if (p.type != PARAM_ACTION)
+    text.add('=').add((long) get(p)).add(p.unit);
+}
+
+int ParamRegistry::nextMenu(int i) const
+{
+  for (int n = 0; n < nbParams; n++)
+  {
+    i = (i + 1) % nbParams;
+    if (!(defs[i].flags & PARAM_NOMENU))
+      return i;
+  }
+  return i;
+}
+
+// PARAM;name;cde;value;min;max;step;unit;text
+void ParamRegistry::reply(const ParamDef &p, ParamReply out) const
+{
+  TextBuf<96> line;
+  ParamText t;
+  text(p, t);
+  line.add("PARAM;").add(p.name).add(';').add(p.cde).add(';');
+  if (p.type != PARAM_ACTION)
+    line.add((long) get(p));
+  line.add(';').add((int) p.min).add(';').add((int) p.max).add(';').add((int) p.step).add(';').add(p.unit)
+      .add(';').add(t.c_str());
+  out(line.c_str());
+}
+
+void ParamRegistry::command(const char *line, ParamReply out)
+{
+  char name[24];
+  int n = 0;
+  while (*line == ' ')
+    line++;
+  while (*line && (isalnum((unsigned char) *line) || (*line == '?')) && (n < (int) sizeof(name) - 1))
+    name[n++] = *line++;
+  name[n] = 0;
+  while (*line == ' ')
+    line++;
+
+  if (!strcmp(name, "?"))
+  {
+    for (int i = 0; i < nbParams; i++)
+      reply(defs[i], out);
+    return;
+  }
+  if (!strcmp(name, "save"))
+  {
+    saveRequested = true;
+    out("PARAM;save");
+    return;
+  }
+  const ParamDef *p = find(name);
+  if (!p)
+  {
+    TextBuf<48> text;
+    out(text.add("PARAM;?;").add(name).c_str());
+    return;
+  }
+  if (*line == '=')
+    set(*p, atol(line + 1));
+  else if (*line == '+')
+    step(*p, 1);
+  else if (*line == '-')
+    step(*p, -1);
+  else if (p->type == PARAM_ACTION)
+    step(*p, 1);
+  reply(*p, out);
+}
+
+void ParamRegistry::save(ParamWriter write) const
+{
+  for (int i = 0; i < nbParams; i++)
+    if ((defs[i].flags & PARAM_PERSIST) && (defs[i].type != PARAM_ACTION))
+      write(defs[i].name, get(defs[i]));
+}
+
+void ParamRegistry::load(ParamReader read)
+{
+  for (int i = 0; i < nbParams; i++)
+  {
+    const ParamDef &p = defs[i];
+    if (!(p.flags & PARAM_PERSIST) || (p.type == PARAM_ACTION))
+      continue;
+    int32_t v = read(p.name, get(p));
+    if (v != get(p))
+      set(p, v);
+  }
+}
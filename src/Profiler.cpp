@@ -0,0 +1,83 @@
+/*
+ F4LAA : CW Decoder, temps passé dans chaque étage de loop() (voir Profiler.h)
+*/
+#include <string.h>
+#include "Profiler.h"
+#include "TextBuf.h"
+
+#ifdef PROFILER
+Profiler profiler;
+#endif
+
+static const char *stageNames[PROF_NBSTAGES] = {
+  "loop", "acq", "resample", "goertzel", "decode", "codetochar", "tft", "pot", "rotary"
+};
+
+const char *Profiler::name(int stage)
+{
+  return ((stage >= 0) && (stage < PROF_NBSTAGES)) ? stageNames[stage] : "?";
+}
+
+void Profiler::reset()
+{
+  memset(stages, 0, sizeof(stages));
+  for (int i = 0; i < PROF_NBSTAGES; i++)
+    stages[i].min = 0xFFFFFFFF;
+}
+
+void Profiler::add(int stage, uint32_t ticks)
+{
+  ProfStage &s = stages[stage];
+  s.count++;
+  s.sum += ticks;
+  if (ticks < s.min)
+    s.min = ticks;
+  if (ticks > s.max)
+    s.max = ticks;
+  s.hist[ticks ? 32 - __builtin_clz(ticks) : 0]++;
+}
+
+uint32_t ProfStage::percentile(int pct) const
+{
+  uint64_t limit = ((uint64_t) count * pct + 99) / 100;
+  uint64_t cumul = 0;
+  for (int b = 0; b < PROF_BUCKETS; b++)
+  {
+    cumul += hist[b];
+    if (cumul >= limit)
+      return (b == 0) ? 0 : ((b == 32) ? 0xFFFFFFFF : (1u << b) - 1);
+  }
+  return max;
+}
+
+void Profiler::dump(void (*line)(const char *text)) const
+{
+  line("PROF;stage;count;min;avg;p99;max (us)");
+  for (int i = 0; i < PROF_NBSTAGES; i++)
+  {
+    const ProfStage &s = stages[i];
+    if (!s.count)
+      continue;
+    // p99 : upper bound of its bucket, not above max
+    uint32_t p99 = s.percentile(99);
+    if (p99 > s.max)
+      p99 = s.max;
+    TextBuf<160> text;
+    text.add("PROF;").add(name(i)).add(';').add((long) s.count).add(';').add(s.min / ticksPerUs, 1).add(';')
+        .add((float) ((double) s.sum / s.count / ticksPerUs), 1).add(';').add(p99 / ticksPerUs, 1).add(';')
+        .add(s.max / ticksPerUs, 1);
+    line(text.c_str());
+
+    // HIST;stage;first bucket;counts... (bucket b : [2^(b-1), 2^b[ ticks)
+    int first = 0, last = PROF_BUCKETS - 1;
+    while (!s.hist[first])
+      first++;
+    while (!s.hist[last])
+      last--;
+    text.clear();
+    text.add("HIST;").add(name(i)).add(';').add(first);
+    for (int b = first; (b <= last) && (text.length() < 160 - 12); b++)
+      text.add(';').add((long) s.hist[b]);
+    line(text.c_str());
+  }
+}
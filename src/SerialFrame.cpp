@@ -0,0 +1,119 @@
+/*
+ F4LAA : CW Decoder, protocole série binaire (voir SerialFrame.h)
+*/
+#include "SerialFrame.h"
+
+static_assert((FRAME_RINGSIZE & (FRAME_RINGSIZE - 1)) == 0, "FRAME_RINGSIZE : power of 2");
+
+// CRC-16 CCITT (0x1021), bit by bit : a few frames per block
+uint16_t frameCrc(const uint8_t *data, int len, uint16_t crc)
+{
+  for (int i = 0; i < len; i++)
+  {
+    crc ^= (uint16_t) data[i] << 8;
+    for (int k = 0; k < 8; k++)
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+  return crc;
+}
+
+void FrameTx::put(uint8_t b)
+{
+  ring[head] = b;
+  head = (head + 1) & (FRAME_RINGSIZE - 1);
+}
+
+bool FrameTx::send(uint8_t type, const void *payload, int len)
+{
+  if ((len < 0) || (len > FRAME_MAXPAYLOAD) || (FRAME_RINGSIZE - 1 - pending() < len + FRAME_OVERHEAD))
+  {
+    dropped++;
+    return false;
+  }
+  uint8_t h[2] = { type, (uint8_t) len };
+  uint16_t crc = frameCrc(h, 2);
+  crc = frameCrc((const uint8_t *) payload, len, crc);
+  put(FRAME_SYNC1);
+  put(FRAME_SYNC2);
+  put(type);
+  put(len);
+  for (int i = 0; i < len; i++)
+    put(((const uint8_t *) payload)[i]);
+  put(crc & 0xFF);
+  put(crc >> 8);
+  sent++;
+  return true;
+}
+
+bool FrameTx::write(const void *data, int len)
+{
+  if ((len < 0) || (FRAME_RINGSIZE - 1 - pending() < len))
+  {
+    dropped++;
+    return false;
+  }
+  for (int i = 0; i < len; i++)
+    put(((const uint8_t *) data)[i]);
+  return true;
+}
+
+int FrameTx::contiguous(const uint8_t **data) const
+{
+  *data = ring + tail;
+  return (head >= tail) ? head - tail : FRAME_RINGSIZE - tail;
+}
+
+bool FrameRx::push(uint8_t b)
+{
+  switch (state)
+  {
+    case SYNC1:
+      if (b == FRAME_SYNC1)
+        state = SYNC2;
+      else
+        skipped++;
+      return false;
+    case SYNC2:
+      if (b == FRAME_SYNC2)
+        state = TYPE;
+      else
+      {
+        skipped++;
+        state = (b == FRAME_SYNC1) ? SYNC2 : SYNC1;
+      }
+      return false;
+    case TYPE:
+      type = b;
+      crc = frameCrc(&b, 1);
+      state = LEN;
+      return false;
+    case LEN:
+      len = b;
+      crc = frameCrc(&b, 1, crc);
+      pos = 0;
+      state = len ? PAYLOAD : CRC1;
+      return false;
+    case PAYLOAD:
+      payload[pos++] = b;
+      crc = frameCrc(&b, 1, crc);
+      if (pos == len)
+        state = CRC1;
+      return false;
+    case CRC1:
+      crc ^= b;
+      state = CRC2;
+      return false;
+    case CRC2:
+      crc ^= (uint16_t) b << 8;
+      state = SYNC1;
+      if (crc != 0)
+      {
+        crcErrors++;
+        return false;
+      }
+      payload[len] = 0;
+      frames++;
+      return true;
+  }
+  return false;
+}
@@ -0,0 +1,231 @@
+/*
+ F4LAA : CW Decoder, extraction des indicatifs et des échanges (voir SpotExtractor.h)
+*/
+#include <string.h>
+#include "SpotExtractor.h"
+#include "PrefixTable.h"
+
+static bool isDigit(char c) { return (c >= '0') && (c <= '9'); }
+static bool isLetter(char c) { return (c >= 'a') && (c <= 'z'); }
+
+// Same hash as tools/mkprefix/mkprefix.py
+static uint32_t prefixHash(const char *s, int len)
+{
+  uint32_t h = 2166136261u ^ PREFIX_HASHSEED;
+  for (int i = 0; i < len; i++)
+  {
+    h ^= (uint8_t) s[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static int findPrefix(const char *s, int len)
+{
+  uint32_t i = prefixHash(s, len) & (PREFIX_HASHSIZE - 1);
+  for (int probe = 0; probe < PREFIX_MAXPROBE; probe++)
+  {
+    const PrefixSlot &slot = prefixTable[i];
+    if (slot.prefix[0] == '\0')
+      return -1;
+    if ((strncmp(slot.prefix, s, len) == 0) && ((len == PREFIX_MAXLEN) || (slot.prefix[len] == '\0')))
+      return slot.country;
+    i = (i + 1) & (PREFIX_HASHSIZE - 1);
+  }
+  return -1;
+}
+
+// Callsign without / : 1 to 3 chars of prefix (with a letter), a digit, 1 to 4 letters
+static bool isBaseCall(const char *s, int len)
+{
+  int d = len - 1;
+  while ((d >= 0) && !isDigit(s[d]))
+    d--;
+  int suffix = len - d - 1;
+  if ((d < 1) || (d > 3) || (suffix < 1) || (suffix > 4))
+    return false;
+  for (int i = d + 1; i < len; i++)
+    if (!isLetter(s[i]))
+      return false;
+  bool letter = false;
+  for (int i = 0; i < d; i++)
+  {
+    if (!isDigit(s[i]) && !isLetter(s[i]))
+      return false;
+    letter |= isLetter(s[i]);
+  }
+  return letter;
+}
+
+bool SpotExtractor::isCallsign(const char *token)
+{
+  // f4laa, f4laa/p, ea8/f4laa, ea8/f4laa/p
+  const char *slash = strchr(token, '/');
+  if (!slash)
+    return isBaseCall(token, strlen(token));
+  if (isBaseCall(token, slash - token))
+    return true;
+  const char *end = strchr(slash + 1, '/');
+  int len = end ? end - slash - 1 : strlen(slash + 1);
+  return isBaseCall(slash + 1, len);
+}
+
+const char *SpotExtractor::country(const char *call)
+{
+  // The part before / : f4laa/p ==> f4laa, ea8/f4laa ==> ea8 (location)
+  const char *slash = strchr(call, '/');
+  int len = slash ? slash - call : strlen(call);
+  for (int n = (len < PREFIX_MAXLEN) ? len : PREFIX_MAXLEN; n > 0; n--)
+  {
+    int c = findPrefix(call, n);
+    if (c >= 0)
+      return prefixCountries[c];
+  }
+  return "?";
+}
+
+const char *SpotExtractor::typeName(uint8_t type)
+{
+  switch (type)
+  {
+    case SPOT_CQ:     return "CQ";
+    case SPOT_QSO:    return "QSO";
+    case SPOT_BEACON: return "BEACON";
+    case SPOT_DE:     return "DE";
+    case SPOT_REPORT: return "RST";
+  }
+  return "?";
+}
+
+void SpotExtractor::clear()
+{
+  tokLen = 0;
+  tok[0] = '\0';
+  lastTok[0] = '\0';
+  cq = false;
+  de = false;
+  beacon = false;
+  report = false;
+  to[0] = '\0';
+  call[0] = '\0';
+  endOfOver = false;
+  nbSpots = 0;
+}
+
+bool SpotExtractor::tokenIs(const char *s) const
+{
+  return strcmp(lastTok, s) == 0;
+}
+
+void SpotExtractor::add(char c)
+{
+  nbSpots = 0;
+  endOfOver = false;
+  if (c != ' ')
+  {
+    if (tokLen < SPOT_MAXTOKEN - 1)
+      tok[tokLen++] = c;
+    return;
+  }
+  if (tokLen == 0)
+    return;
+  tok[tokLen] = '\0';
+  token();
+  strcpy(lastTok, tok);
+  tokLen = 0;
+}
+
+void SpotExtractor::emit(uint8_t type, const char *call, const char *to, const char *rst)
+{
+  if (nbSpots == MAXSPOTS)
+    return;
+  Spot &s = spots[nbSpots++];
+  s.type = type;
+  strcpy(s.call, call);
+  strcpy(s.to, to);
+  strcpy(s.rst, rst);
+  s.country = country(call);
+}
+
+void SpotExtractor::token()
+{
+  if (!strcmp(tok, "cq"))
+  {
+    cq = true;
+    de = false;
+    beacon = false;
+    report = false;
+    to[0] = '\0';
+    return;
+  }
+  if (!strcmp(tok, "de"))
+  {
+    de = true;
+    return;
+  }
+  if (!strcmp(tok, "vvv") || !strcmp(tok, "bcn") || !strcmp(tok, "beacon"))
+  {
+    beacon = true;
+    return;
+  }
+  if (!strcmp(tok, "rst") || !strcmp(tok, "ur"))
+  {
+    report = true;
+    return;
+  }
+  if (!strcmp(tok, "k") || !strcmp(tok, "kn") || !strcmp(tok, "bk") || !strcmp(tok, "sk") || !strcmp(tok, "ar"))
+  {
+    endOfOver = true;
+    cq = false;
+    de = false;
+    beacon = false;
+    report = false;
+    to[0] = '\0';
+    return;
+  }
+
+  // Report : 599, 5nn, 579...
+  if (report && (tokLen == 3) && (tok[0] >= '1') && (tok[0] <= '5'))
+  {
+    char rst[4] = { tok[0], tok[1], tok[2], '\0' };
+    bool ok = true;
+    for (int i = 1; i < 3; i++)
+    {
+      if (rst[i] == 'n')
+        rst[i] = '9';
+      ok &= (rst[i] >= '1') && (rst[i] <= '9');
+    }
+    if (ok)
+    {
+      report = false;
+      if (call[0] != '\0')
+        emit(SPOT_REPORT, call, to, rst);
+      return;
+    }
+  }
+
+  if ((tokLen >= SPOT_MAXCALL) || !isCallsign(tok))
+    return;
+
+  // xx/b : beacon
+  bool slashB = (tokLen > 2) && !strcmp(tok + tokLen - 2, "/b");
+  if (slashB)
+    tok[tokLen - 2] = '\0';
+
+  if (!strcmp(tok, lastTok))
+    return; // Repeated : de f4laa f4laa
+  beacon |= slashB;
+
+  if (de || cq)
+  {
+    // de f4laa, or cq test f4laa (contest)
+    uint8_t type = beacon ? SPOT_BEACON : (cq ? SPOT_CQ : ((to[0] != '\0') ? SPOT_QSO : SPOT_DE));
+    strcpy(call, tok);
+    emit(type, call, to, "");
+    de = false;
+    cq = false;
+    beacon = false;
+  }
+  else
+    strcpy(to, tok); // f4laa de hb9f : the one who is called
+}
@@ -0,0 +1,116 @@
+/*
+ F4LAA : Roue de temporisations hiérarchique (voir TimerWheel.h)
+*/
+#include "TimerWheel.h"
+
+TimerWheel::TimerWheel()
+{
+  for (int l = 0; l < TW_LEVELS; l++)
+    for (int i = 0; i < TW_SLOTS; i++)
+      slots[l][i] = 0;
+}
+
+void TimerWheel::start(uint32_t now)
+{
+  for (int l = 0; l < TW_LEVELS; l++)
+    for (int i = 0; i < TW_SLOTS; i++)
+      while (slots[l][i])
+        cancel(*slots[l][i]);
+  current = now;
+}
+
+// The slot of level L is reached when the tick number >> (L * TW_BITS) gets to expires >> (L * TW_BITS) :
+// a level holds the timers up to TW_SLOTS of its rounds ahead.
+// Rounds are counted from the delay, so that the 32 bits time may wrap around.
+void TimerWheel::add(Timer &t)
+{
+  uint32_t delta = t.expires - current;
+  int level = 0;
+  uint32_t rounds = delta;
+  while ((level < TW_LEVELS - 1) && (rounds >= ((level == 0) ? TW_SLOTS : TW_SLOTS + 1)))
+  {
+    level++;
+    int shift = level * TW_BITS;
+    rounds = ((current & ((1 << shift) - 1)) + delta) >> shift;
+  }
+  if (rounds > TW_SLOTS)
+    rounds = TW_SLOTS; // Too far : goes down later, and up again
+  uint32_t round = (current >> (level * TW_BITS)) + rounds;
+  Timer **slot = &slots[level][round & TW_MASK];
+  t.next = *slot;
+  if (t.next)
+    t.next->pprev = &t.next;
+  t.pprev = slot;
+  *slot = &t;
+}
+
+void TimerWheel::schedule(Timer &t, uint32_t expires)
+{
+  if (t.pending())
+    cancel(t);
+  if ((int32_t) (expires - current) <= 0)
+    expires = current + 1;
+  t.expires = expires;
+  add(t);
+  pending++;
+}
+
+void TimerWheel::cancel(Timer &t)
+{
+  if (!t.pending())
+    return;
+  *t.pprev = t.next;
+  if (t.next)
+    t.next->pprev = t.pprev;
+  t.next = 0;
+  t.pprev = 0;
+  pending--;
+}
+
+// The timers of the current slot of a level go down
+void TimerWheel::cascade(int level)
+{
+  Timer **slot = &slots[level][(current >> (level * TW_BITS)) & TW_MASK];
+  Timer *t = *slot;
+  *slot = 0;
+  while (t)
+  {
+    Timer *next = t->next;
+    add(*t);
+    t = next;
+  }
+}
+
+void TimerWheel::advance(uint32_t now)
+{
+  if (pending == 0)
+  {
+    current = now;
+    return;
+  }
+  while ((int32_t) (now - current) > 0)
+  {
+    current++;
+    for (int level = TW_LEVELS - 1; level > 0; level--)
+      if ((current & ((1 << (level * TW_BITS)) - 1)) == 0)
+        cascade(level);
+
+    // Expired : the list is taken first, the callbacks may schedule or cancel timers
+    Timer *expired = slots[0][current & TW_MASK];
+    slots[0][current & TW_MASK] = 0;
+    if (expired)
+      expired->pprev = &expired;
+    while (expired)
+    {
+      Timer *t = expired;
+      cancel(*t);
+      if (t->callback)
+        t->callback(t->ctx);
+    }
+    if (pending == 0)
+    {
+      current = now;
+      return;
+    }
+  }
+}
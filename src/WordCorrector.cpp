@@ -0,0 +1,223 @@
+/*
+ F4LAA : CW Decoder, correction des mots à l'aide d'un dictionnaire (voir WordCorrector.h)
+*/
+#include <string.h>
+#include "WordCorrector.h"
+#include "DictTrie.h"
+
+#define CORR_OOV  0xFFFF // Not in the dictionary
+#define CORR_WILD 0xFFFE // '*' matched : any letters / digits up to the end of the word
+
+#define GAP_INTRA 0  // Silent inside char
+#define GAP_LETTER 1 // Letter space
+#define GAP_END 2    // End of the word
+
+static_assert(sizeof(WordCorrector) <= CORR_RAMBUDGET, "WordCorrector RAM budget");
+
+static bool isDigit(char c) { return (c >= '0') && (c <= '9'); }
+static bool isLetter(char c) { return (c >= 'a') && (c <= 'z'); }
+
+void WordCorrector::clear()
+{
+  wordLen = 0;
+  nbElements = 0;
+  word[0] = '\0';
+}
+
+bool WordCorrector::add(const DecodedChar &d)
+{
+  int len = strlen(d.code);
+  if ((wordLen == CORR_MAXCHARS) || (nbElements + len > CORR_MAXELEMENTS) || (len == 0))
+    return false;
+  for (int i = 0; i < len; i++)
+  {
+    elements[nbElements] = d.code[i];
+    elemMargins[nbElements] = d.elemMargins[i];
+    gapMargins[nbElements] = d.gapMargins[i];
+    gapKinds[nbElements] = (i < len - 1) ? GAP_INTRA : GAP_LETTER;
+    nbElements++;
+  }
+  word[wordLen] = d.c;
+  wordConf[wordLen] = d.confidence;
+  wordLen++;
+  word[wordLen] = '\0';
+  return true;
+}
+
+// Adds s to the next beam : same text and code ==> keep the cheapest, beam full ==> replace the worst
+void WordCorrector::push(const State &s)
+{
+  int next = 1 - cur;
+  State *b = beam[next];
+  int worst = 0;
+  for (int i = 0; i < nbStates[next]; i++)
+  {
+    if ((b[i].node == s.node) && (b[i].textLen == s.textLen) && (b[i].codeLen == s.codeLen)
+        && (memcmp(b[i].text, s.text, s.textLen) == 0) && (memcmp(b[i].code, s.code, s.codeLen) == 0))
+    {
+      if (s.cost < b[i].cost)
+        b[i].cost = s.cost;
+      return;
+    }
+    if (b[i].cost > b[worst].cost)
+      worst = i;
+  }
+  if (nbStates[next] < CORR_BEAM)
+    b[nbStates[next]++] = s;
+  else if (s.cost < b[worst].cost)
+    b[worst] = s;
+}
+
+// End of a letter : its code becomes a char, and the trie is followed (maybe several wildcard children)
+void WordCorrector::closeLetter(State &s, uint16_t cost)
+{
+  s.code[s.codeLen] = '\0';
+  char c = CWDecoder::toChar(s.code);
+  if ((c == '{') || (s.textLen == CORR_MAXCHARS))
+    return;
+  State t = s;
+  t.cost = cost;
+  t.codeLen = 0;
+  t.text[t.textLen++] = c;
+  t.text[t.textLen] = '\0';
+
+  if ((s.node == CORR_OOV) || (s.node == CORR_WILD))
+  {
+    t.node = ((s.node == CORR_WILD) && (isDigit(c) || isLetter(c))) ? CORR_WILD : CORR_OOV;
+    push(t);
+    return;
+  }
+
+  bool found = false;
+  uint16_t child = dictTrie[s.node].child;
+  if (child != 0)
+  {
+    for (uint16_t i = child; ; i++)
+    {
+      char n = dictTrie[i].c;
+      bool match = (n == c)
+                   || ((n == '#') && isDigit(c))
+                   || ((n == '@') && isLetter(c));
+      if (match || ((n == '*') && (isDigit(c) || isLetter(c))))
+      {
+        t.node = (n == '*') ? CORR_WILD : i;
+        push(t);
+        found = true;
+      }
+      if (dictTrie[i].flags & DICT_LAST)
+        break;
+    }
+  }
+  if (!found)
+  {
+    t.node = CORR_OOV;
+    push(t);
+  }
+}
+
+uint16_t WordCorrector::finalCost(const State &s) const
+{
+  bool inDict = (s.node == CORR_WILD) || ((s.node != CORR_OOV) && (dictTrie[s.node].flags & DICT_END));
+  return s.cost + (inDict ? 0 : CORR_OOVCOST);
+}
+
+int WordCorrector::correct(char *text, uint8_t *conf)
+{
+  int len = wordLen;
+  strcpy(text, word);
+  memcpy(conf, wordConf, len);
+  changed = false;
+  cost = 0;
+  if (nbElements == 0)
+  {
+    clear();
+    return len;
+  }
+  gapKinds[nbElements - 1] = GAP_END;
+
+  cur = 0;
+  nbStates[0] = 1;
+  nbStates[1] = 0;
+  State &root = beam[0][0];
+  root.node = 0;
+  root.cost = 0;
+  root.codeLen = 0;
+  root.textLen = 0;
+  root.text[0] = '\0';
+
+  for (int k = 0; k < nbElements; k++)
+  {
+    int next = 1 - cur;
+    nbStates[next] = 0;
+    for (int i = 0; i < nbStates[cur]; i++)
+    {
+      for (int flip = 0; flip < 2; flip++)
+      {
+        if (flip && (elemMargins[k] > CORR_MAXFLIP))
+          continue;
+        State s = beam[cur][i];
+        if (s.codeLen == bufSize - 1)
+          continue;
+        char e = elements[k];
+        if (flip)
+          e = (e == '.') ? '-' : '.';
+        s.code[s.codeLen++] = e;
+        uint16_t c = s.cost + (flip ? CORR_FLIPCOST + elemMargins[k] : 0);
+
+        // The space after this element
+        uint16_t gapFlip = CORR_FLIPCOST + gapMargins[k];
+        bool canFlip = (gapMargins[k] <= CORR_MAXFLIP);
+        switch (gapKinds[k])
+        {
+          case GAP_END:
+            closeLetter(s, c);
+            break;
+          case GAP_INTRA:
+            if (canFlip)
+              closeLetter(s, c + gapFlip);
+            s.cost = c;
+            push(s);
+            break;
+          case GAP_LETTER:
+            closeLetter(s, c);
+            if (canFlip)
+            {
+              s.cost = c + gapFlip;
+              push(s);
+            }
+            break;
+        }
+      }
+    }
+    cur = next;
+  }
+
+  // Best word : the one decoded is kept on equal costs
+  int best = -1;
+  uint16_t bestCost = 0;
+  for (int i = 0; i < nbStates[cur]; i++)
+  {
+    State &s = beam[cur][i];
+    uint16_t c = finalCost(s);
+    bool original = (s.cost == 0);
+    if ((best < 0) || (c < bestCost) || ((c == bestCost) && original))
+    {
+      best = i;
+      bestCost = c;
+    }
+  }
+  if ((best >= 0) && (beam[cur][best].cost > 0))
+  {
+    State &s = beam[cur][best];
+    changed = true;
+    cost = s.cost;
+    len = s.textLen;
+    strcpy(text, s.text);
+    // The new chars are as sure as the correction
+    uint8_t c = (s.cost < CORR_OOVCOST) ? ((CORR_OOVCOST - s.cost) * 100) / CORR_OOVCOST : 0;
+    for (int i = 0; i < len; i++)
+      conf[i] = c;
+  }
+  clear();
+  return len;
+}
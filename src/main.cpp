@@ -47,6 +47,74 @@
    - On ne force plus un CR tous les 100 caractères (comme quand c'est l'IDE Arduino qui écoute)
    - On ajuste automatiquement nbSamples en fonction du WPM (Mesuré OK: 110samples pour 15WPM, 70samples pour 33WPM )
 
+ 19/10/2026 : Modifications V2.0a ==> V2.1 :
+   - AFC : estimation de la fréquence exacte du signal (interpolation entre bins voisins), et suivi continu
+     de la dérive avec limitation de la vitesse de correction. La fréquence affichée est la fréquence mesurée.
+   - Resampler : les blocs acquis à sampling_freq (mesurée au boot) sont convertis à PROCESSING_FREQ (11025 Hz).
+     Coefficients Goertzel, bande passante et nbSamples ne dépendent plus de la vitesse de l'ADC.
+   - L'étage de décision (états, . / -, caractères) passe dans CWDecoder (include/CWDecoder.h) pour être utilisable sur PC.
+   - Nouveau modèle de temps adaptatif : rapport dash/dot et espacements lettre / mot mesurés séparément
+     (Farnsworth, manipulation "lourde"). Affichés sur la ligne de trace. Choix du modèle par la commande 'M'
+     (G6EJD par défaut : l'adaptatif démarre mal à vitesse lente, 97% de CER contre 88% sur la balise 8 WPM).
+     Si le premier élément reçu est un dash, le caractère en cours est reclassé dès le premier dot.
+  - Confiance de chaque caractère décodé (marges des temps par rapport aux seuils, et SNR) :
+    intensité de la couleur sur le TFT, et envoyée sur Serial après le caractère (e{87}) avec la commande 'Q'.
+  - Dictionnaire (commande 'W') : chaque mot est corrigé à sa fin (WordCorrector) en essayant d'autres découpages
+    en lettres et les éléments douteux, contre un trie en flash de Q-codes, abréviations et préfixes d'indicatifs.
+  - Spots (SpotExtractor) : indicatifs, CQ / DE / RST / balises reconnus dans le texte décodé, avec le pays
+    (table de hachage des préfixes générée à la compilation depuis tools/mkprefix/prefixes.txt).
+    Envoyés sur Serial (SPOT;type;call;to;rst;country) avec la commande 'P'. La fin de ligne BK passe par lui.
+  - Capture (MagCapture) des derniers blocs de l'étage de décision (magnitude, seuil, états, paramètres) en RAM,
+    envoyée en binaire sur Serial avec la commande 'X', et rejouée à l'identique sur PC par tools/magreplay.
+  - Temporisations (noise blanker, fin de caractère, 10s sans son, 5s sans signal avant scan) programmées sur une
+    roue hiérarchique (TimerWheel) avancée à chaque bloc, au lieu des comparaisons millis() - start de chaque passage.
+  - Décodeur neuronal (CWNet, commande 'E') : un GRU lit la magnitude de chaque bloc et remplace les caractères
+    de CWDecoder (poids int8 appris sur PC par tools/cwnet). Arrêté s'il est plus lent que l'acquisition d'un bloc.
+  - Préréglages (commande 'O') : nbTime, magReactivity, spaceDetector, modèle et nbSamples par conditions
+    (clean, noisy, fast), optimisés sur PC par tools/cwopt (include/DecoderPresets.h). nbSamples suit le WPM
+    tant qu'il n'est pas fixé ('S' ou préréglage) ; commande 'Z' (autonbs) pour qu'il le suive à nouveau.
+    Bornes de 'N' (0..50), 'R' (1..250) et 'B' (0..20) élargies à la recherche de cwopt.
+  - Arbre de décision (commande 'K') : chaque caractère est reclassé à partir de ses 11 durées par du code
+    généré sur PC par tools/cwtree (include/CWTreeCode.h, comparaisons d'entiers seulement). Durées en unités
+    du silence entre éléments (CWTreeUnit), comme à l'apprentissage, quel que soit le modèle de temps.
+  - Protocole binaire vers CWDecoder-UI (commande 'U', SerialFrame) : caractères et confiance, durées, magnitude,
+    spots et état (toutes les secondes) en trames avec CRC, rangées dans un anneau vidé à chaque passage de loop()
+    sans attendre la liaison série. Décodées et enregistrées sur PC par tools/cwframe.
+  - Télémétrie sans allocation : les lignes de graph, de DataSet et de trace, et le volume, sont formatés dans des
+    buffers fixes sur la pile (TextBuf) au lieu de concaténations de String, et toutes les sorties texte (graph,
+    DataSet, caractères, spots, réponses PARAM, profileur) passent par l'anneau d'émission, dans l'ordre. Allocations sur le tas par seconde (HeapStats) sur la ligne de trace et dans la trame d'état.
+    Comptage avant / après sur PC : tools/heapfmt.
+  - Audio brut (commande 'L') : les échantillons de l'ADC de chaque bloc, compressés en IMA-ADPCM (4 bits),
+    envoyés en trames FRAME_AUDIO numérotées. tools/cwaudio les remet dans un WAV pour les outils PC,
+    et compte les trames perdues. 'L' active le protocole binaire ('U'), et s'arrête avec lui.
+  - Profileur (Profiler, compilé avec -DPROFILER) : cycles CPU de chaque étage de loop() (acquisition, resampler,
+    Goertzel, décodage, CodeToChar, TFT, potentiomètre, bouton rotatif), min / moyenne / p99 / max et histogramme
+    log2, envoyés sur Serial avec la commande 'H'. Rien n'est compilé sans -DPROFILER.
+  - Trous d'acquisition (AcqMonitor) : temps entre la fin d'un bloc et le début du suivant (non échantillonné).
+    Taux d'échantillonnage de la dernière seconde sur la ligne d'état (D=..%, en rouge s'il y a des dépassements :
+    trous de plus d'un quart de point au WPM courant), et dans la trame d'état avec le trou max.
+  - Journal d'événements (EventTrace), toujours actif : fronts, hightimesavg, seuil, éléments, caractères,
+    pas de l'autotune et de l'AFC, datés, dans un buffer circulaire sans verrou. Envoyé en binaire sur Serial
+    avec la commande 'J', affiché en ligne de temps (SVG) par tools/cwevents. Chaque CWDecoder a son journal
+    (pointeur events, aucun si nul) : les décodeurs des outils PC en parallèle ne partagent plus rien.
+  - Encodeur rotatif sur interruptions (lib/Rotary : Rotary::attach()) : la table d'états tourne dans l'ISR,
+    rotations et appuis passent par une file sans verrou vidée par loop(), plus rien n'est perdu pendant
+    une acquisition ou un affichage lent. Accélération : jusqu'à 8 pas par cran quand on tourne vite
+    (fréquence, volume, bande passante seulement).
+  - Registre des paramètres (Params.h) : une ligne de table par commande (bornes, pas, unité, effet, texte)
+    remplace les 2 switch du bouton rotatif et celui de showCde(). Le même registre répond aux commandes
+    série ("?", "nom", "nom=v", "nom+", "nom-", "save") et sauvegarde les réglages en NVS (5s après
+    le dernier changement). Les paramètres de l'étage DSP (nbSamples, filtre, magReactivity, détection
+    des blancs, modèle) sont publiés d'un coup et relus par loop() au début d'un bloc seulement.
+  - Démarrage à chaud : la vitesse de l'ADC mesurée au premier démarrage, la dernière fréquence, le WPM,
+    le volume et le seuil sont gardés en NVS. Au démarrage suivant, plus d'attente (1.2s + 4s) :
+    le décodage part avec ces valeurs (CWDecoder::warmStart()), la vitesse de l'ADC est affinée sur les
+    acquisitions des 4 premières secondes. Commande série "coldboot" : nouvelle mesure au prochain démarrage.
+    La vitesse gardée n'est pas réapprise sur les premiers éléments : mis sous tension pendant une émission,
+    le décodeur ne se cale plus sur un élément coupé ou du bruit (tools/warmboot).
+  - Lignes de texte de l'écran dans DisplayLine (include/DisplayLine.h) : le même code dessine l'écran simulé
+    de tools/tftfb, comparé à une image de référence (tools/tftfb/golden.ppm).
+
  =====================================================================================
  Morse Code Decoder using an OLED and basic microphone
 
@@ -78,8 +146,9 @@
 #include "TFT_eSPI.h"
 
 TFT_eSPI tft = TFT_eSPI();  
+bool display = true;
 
-void tftDrawString(int x, int y, String s, bool disp = true)
+void tftDrawString(int x, int y, const char *s, bool disp = true)
 {
   if (disp)
   {
@@ -88,44 +157,61 @@ void tftDrawString(int x, int y, String s, bool disp = true)
   }
 }
 
+void tftDrawString(int x, int y, const String &s, bool disp = true)
+{
+  tftDrawString(x, y, s.c_str(), disp);
+}
+
+// Heap allocations per second (HEAP_STATS), shown on the trace line and in FRAME_STATUS
+#include "HeapStats.h"
+#include "TextBuf.h"
+#include "Profiler.h"
+uint32_t heapPerSec = 0;
+
+// Time not sampled between 2 blocks : duty cycle on the status line and in FRAME_STATUS
+#include "AcqMonitor.h"
+AcqMonitor acqMon;
+
 // SPI Potentiometre
 const int slaveSelectPin = 22; // CS 
 
 #define POTMIDVALUE 128
-uint8_t potVal = POTMIDVALUE;  // Middle value
+int potVal = POTMIDVALUE;  // Middle value
 uint8_t potCmd = 0x11; // =0b00010001 so set PotA value
 void setVolume(uint8_t value) 
 { 
-  digitalWrite(slaveSelectPin, LOW); 
-  tft.spiwrite(potCmd);
-  tft.spiwrite(255 - value);
-  digitalWrite(slaveSelectPin, HIGH); 
+  {
+    PROF_SCOPE(PROF_POT);
+    digitalWrite(slaveSelectPin, LOW); 
+    tft.spiwrite(potCmd);
+    tft.spiwrite(255 - value);
+    digitalWrite(slaveSelectPin, HIGH); 
+  }
   float pourcent = ((value / 255.00) * 100);
-  tftDrawString(396, 280, String(pourcent, 0) + "%  ");
+  TextBuf<8> text;
+  tftDrawString(396, 280, text.add(pourcent, 0).add("%  ").c_str());
   potVal = value;
 } 
 
 // Variables G6EJD using Goertzel algorithm
 float magnitude           = 0;;
-int   magnitudelimit      = 100;
-int   magnitudelimit_low  = 100;
-int   realstate           = LOW;
-int   realstatebefore     = LOW;
-int   filteredstate       = LOW;
-int   filteredstatebefore = LOW;
-
-// Noise Blanker time which shall be computed so this is initial 
-int nbTime = 6;  // ms noise blanker
-int spaceDetector = 5;
-int magReactivity = 6;
-
-int starttimehigh;
-int highduration;
-int lasthighduration;
-int starttimelow;
-int lowduration;
-int laststarttime = 0;
-float hightimesavg = 0; // Séparation dot / dash et SP
+
+// Décodage : magnitude ==> états ==> . / - ==> caractères
+#include "CWDecoder.h"
+CWDecoder decoder;
+#include "EventTrace.h"
+EventTrace eventTrace; // Journal of the decision stage (command 'J'), written by the decoder and loop()
+#include "MagCapture.h"
+MagCapture capture; // Last blocks of the decoder, for tools/magreplay (command 'X')
+#include "CWNet.h"
+CWNet net;             // Neural decoder of the envelope (command 'E')
+bool netOn = false;
+unsigned long netLastBlock = 0;
+unsigned long netTime = 0;    // us, last block
+unsigned long netTimeMax = 0; // us, since ON
+#include "CWTreeCode.h"
+bool treeOn = false; // Characters classified by the decision tree (command 'K')
+CWTreeUnit treeUnit; // Its time unit, followed even when off
 
 // Encodeur rotatif GND, VCC, SW, DT (B), CLK (A)
 // (A) CLK pin GPIO8 , (B) DT pin GPIO7, SW pin GPIO6 
@@ -137,88 +223,78 @@ Rotary rot= Rotary(rotEncA, rotEncB);
 int rotCounter = 0;
 int rotAState;
 int rotALastState;
-int rotSWState = 0;
-int rotSWLastState = 0;
 // EndOf Rotary variables definition
 
-// Gestion des temps
-// Stockage des temps : High & Silent pour chaque caractère décodé
-#define MAXTIMES 11
-int iTimes;
-int dTimes[MAXTIMES];
-int dTimes2[MAXTIMES];
+// Binary frames for CWDecoder-UI (command 'U') : the text outputs are replaced by frames
+#include "SerialFrame.h"
+FrameTx frameTx;
+bool binOut = false;
+bool audioOut = false; // Raw ADC samples in FRAME_AUDIO (command 'L')
 
-void clearTimes(bool clone)
+void sendText(uint8_t type, const String &text)
 {
-  if(clone)
-    for (int i=0; i<MAXTIMES; i++)
-    {
-      dTimes2[i] = dTimes[i]; // Clone it
-      dTimes[i] = 0;
-    }
-  else
-    for (int i=0; i<MAXTIMES; i++)
-    {
-      dTimes[i] = 0;
-      dTimes2[i] = 0;
-    }
+  int len = text.length();
+  frameTx.send(type, text.c_str(), (len > FRAME_MAXPAYLOAD) ? FRAME_MAXPAYLOAD : len);
+}
 
-  iTimes = -1;
+// Text mode : through the ring too, so that a reply never cuts a graph / DataSet line
+void serialPrint(const char *text)
+{
+  frameTx.write(text, strlen(text));
 }
-void addTime(int t)
+
+void serialPrintln(const char *text = "")
+{
+  serialPrint(text);
+  serialPrint("\r\n");
+}
+
+// Each loop : only what the TX buffer of Serial can take, the DSP loop never waits for the link
+void drainFrames()
 {
-  if (iTimes < MAXTIMES)
+  const uint8_t *data;
+  int n;
+  while ((n = frameTx.contiguous(&data)) > 0)
   {
-    iTimes++;
-    dTimes[iTimes] = t;
+    int room = Serial.availableForWrite();
+    if (room <= 0)
+      break;
+    if (n > room)
+      n = room;
+    Serial.write(data, n);
+    frameTx.consume(n);
   }
 }
-void printTimes(char c)
+
+// Gestion des temps
+// Stockage des temps : High & Silent pour chaque caractère décodé (DecodedChar.times)
+void printTimes(const DecodedChar &d)
 {
-  Serial.print(String(c));
-  for (int i=0; i<MAXTIMES; i++)
+  if (binOut)
   {
-    Serial.print(";"); 
-    Serial.print(dTimes2[i]); // Use cloned
+    FrameTimes f;
+    f.c = d.c;
+    for (int i = 0; i < MAXTIMES; i++)
+      f.times[i] = constrain(d.times[i], -32768, 32767);
+    frameTx.send(FRAME_TIMES, &f, sizeof(f));
+    return;
   }
-  Serial.println();
+  TextBuf<96> line;
+  line.add(d.c);
+  for (int i=0; i<MAXTIMES; i++)
+    line.add(';').add(d.times[i]);
+  line.add("\r\n");
+  frameTx.write(line.c_str(), line.length());
 }
 
-#define bufSize 8
-int bufLen;
 int sBufLen;
-int startNoChange = 0;
-char CodeBuffer[bufSize]; // 6 . ou - + 1 en trop (avant sécurité) + \0
-char CodeBuffer2[bufSize]; // 6 . ou - + 1 en trop (avant sécurité) + \0
-#define nbChars 33
-char DisplayLine[nbChars];
-int iRow = 0;
-int iCar = 0;
-int  stop = LOW;
-int  wpm;
+bool noChangeTimeout = false;
+void onNoChange(void *) { noChangeTimeout = true; }
+Timer noChangeTimer(onNoChange);
+#include "DisplayLine.h"
+DisplayLine displayLine(tft); // Decoded text, with CodeBuffer after the current line
 int  sWpm;
 
-void clearDisplay()
-{
-  iRow = 0;
-  tft.fillRect(0, 60, 480, 220, TFT_BLACK); // Clear display area
-}
-
-void clearDisplayLine()
-{
-  for (int i = 0; i < nbChars; i++) DisplayLine[i] = ' ';
-}
-
-void clearCodeBuffer(bool clone)
-{
-  clearTimes(clone);
-  if (clone)
-    strcpy(CodeBuffer2, CodeBuffer);
-  CodeBuffer[0] = '\0';
-  bufLen = 0;
-  // for (int i = 1; i < bufSize; i++) CodeBuffer[i] = ' ';
-};
-
 // ADC speed problem 
 // 11496 when the following code is not compiled (with ADCGives11496SampBySec defined)
 // 9000 samp/s only when the code is compiled with ADCGives9000SampBySec defined)
@@ -241,34 +317,36 @@ void clearIfNotChanged()
 #endif
 
 #ifdef ADCGives9000SampBySec
-  if ( (bufLen > 0) && (bufLen == sBufLen) )
+  if ( (decoder.bufLen > 0) && (decoder.bufLen == sBufLen) )
   {
     cptNoChange++;
     if (cptNoChange > 500)
     {
       cptNoChange = 0;
-      clearCodeBuffer(false);
+      decoder.clearCodeBuffer();
+      capture.event(CAP_CLEAR);
     }
-    if (startNoChange == 0)
-      startNoChange = millis();
-    else if (millis() - startNoChange > 3000) 
+    if (noChangeTimeout)
     {
       // Trop long sans changement de CodeBuffer
-      startNoChange = 0;
-      clearCodeBuffer(false);
+      noChangeTimeout = false;
+      decoder.clearCodeBuffer();
+      capture.event(CAP_CLEAR);
     }
+    else if (!noChangeTimer.pending())
+      decoder.timers.schedule(noChangeTimer, millis() + 3001);
   }
-  sBufLen = bufLen;
+  sBufLen = decoder.bufLen;
 #endif
 }
 
-bool display = true;
 int cptCharPrinted = 0;
 bool CRRequested = false;
 bool graph = false;   // To draw magnitude curve
 bool dataSet = false; // To generate DataSet for Neural Network
-#define MAXLINES 9
-void AddCharacter(char newchar)
+bool trace = false;   // To show details on TFT
+bool confOutput = false; // Confidence sent after each char : e{87} (off for CWDecoder-UI)
+void AddCharacter(char newchar, uint8_t confidence)
 {
   if (CRRequested && (newchar != ' ')) 
   {
@@ -277,118 +355,158 @@ void AddCharacter(char newchar)
     // if (!graph && !dataSet)
     //   Serial.println(); // Inutile si avec CWDecoder-UI
   }
+  displayLine.add(newchar, confidence, decoder.CodeBuffer);
+}
+
+// Callsigns and exchanges found in the decoded text
+#include "SpotExtractor.h"
+SpotExtractor spots;
+bool spotsOn = false; // Spots sent on Serial : SPOT;type;call;to;rst;country
 
-  iCar++;
-  if (iCar == nbChars)
+void printSpots()
+{
+  if (!spotsOn || ((graph || dataSet) && !binOut))
+    return;
+  for (int i = 0; i < spots.nbSpots; i++)
   {
-    iCar = 0;
-    int posRow = 60 + (iRow * 20);
-    tft.setTextColor(TFT_WHITE, TFT_BLACK);
-    tftDrawString(0, posRow, DisplayLine, display); // Affiche aussi CodeBuffer (qui suit DisplayLine en mémmoire et contient le \0)
-    tft.fillRect(394, posRow, 72, 20, TFT_BLACK); // Clear CodeBuffer
-    clearDisplayLine();
-    iRow++;
-    if (iRow > MAXLINES) 
-      iRow = 0;
+    Spot &s = spots.spots[i];
+    if (binOut)
+    {
+      sendText(FRAME_SPOT, String(SpotExtractor::typeName(s.type)) + ";" + String(s.call) + ";" + String(s.to)
+                           + ";" + String(s.rst) + ";" + String(s.country));
+      continue;
+    }
+    serialPrintln();
+    serialPrintln(("SPOT;" + String(SpotExtractor::typeName(s.type)) + ";" + String(s.call) + ";" + String(s.to)
+                   + ";" + String(s.rst) + ";" + String(s.country)).c_str());
   }
-  else
+}
+
+void printChar(char c, uint8_t confidence)
+{
+  spots.add(c);
+  printSpots();
+  if (binOut)
+  {
+    AddCharacter(c, confidence);
+    FrameChar f = { (uint32_t) millis(), c, confidence };
+    frameTx.send(FRAME_CHAR, &f, sizeof(f));
+    return;
+  }
+  if (c == ' ') {
+    // word space
+    AddCharacter(' ', confidence);
+    if (!graph && !dataSet)
+    {
+      serialPrint(" ");
+      if (spots.tokenIs("bk")) // EOL
+      {
+        serialPrintln("<===");
+        CRRequested = false;
+        cptCharPrinted = 0;
+      }
+    }
+    return;
+  }
+
+  AddCharacter(c, confidence);
+  if (!graph && !dataSet)
   {
-    // Shift chars to get place for the new char
-    for (int i = 0; i < nbChars; i++) 
-      DisplayLine[i] = DisplayLine[i+1];
+    cptCharPrinted++;
+    if (cptCharPrinted > 100)
+      CRRequested = true;
+    TextBuf<8> text;
+    text.add(c);
+    if (confOutput)
+      text.add('{').add((int) confidence).add('}');
+    serialPrint(text.c_str());
   }
-  DisplayLine[nbChars - 1] = newchar;
 }
 
-char lastChar = '{';
-char curChar = '{';
-void CodeToChar() { // translate cw code to ascii character//
-  clearCodeBuffer(true);
-  char decodedChar = '{';
-  if (strcmp(CodeBuffer2,".-") == 0)      decodedChar = char('a');
-  if (strcmp(CodeBuffer2,"-...") == 0)    decodedChar = char('b');
-  if (strcmp(CodeBuffer2,"-.-.") == 0)    decodedChar = char('c');
-  if (strcmp(CodeBuffer2,"-..") == 0)     decodedChar = char('d'); 
-  if (strcmp(CodeBuffer2,".") == 0)       decodedChar = char('e'); 
-  if (strcmp(CodeBuffer2,"..-.") == 0)    decodedChar = char('f'); 
-  if (strcmp(CodeBuffer2,"--.") == 0)     decodedChar = char('g'); 
-  if (strcmp(CodeBuffer2,"....") == 0)    decodedChar = char('h'); 
-  if (strcmp(CodeBuffer2,"..") == 0)      decodedChar = char('i');
-  if (strcmp(CodeBuffer2,".---") == 0)    decodedChar = char('j');
-  if (strcmp(CodeBuffer2,"-.-") == 0)     decodedChar = char('k'); 
-  if (strcmp(CodeBuffer2,".-..") == 0)    decodedChar = char('l'); 
-  if (strcmp(CodeBuffer2,"--") == 0)      decodedChar = char('m'); 
-  if (strcmp(CodeBuffer2,"-.") == 0)      decodedChar = char('n'); 
-  if (strcmp(CodeBuffer2,"---") == 0)     decodedChar = char('o'); 
-  if (strcmp(CodeBuffer2,".--.") == 0)    decodedChar = char('p'); 
-  if (strcmp(CodeBuffer2,"--.-") == 0)    decodedChar = char('q'); 
-  if (strcmp(CodeBuffer2,".-.") == 0)     decodedChar = char('r'); 
-  if (strcmp(CodeBuffer2,"...") == 0)     decodedChar = char('s'); 
-  if (strcmp(CodeBuffer2,"-") == 0)       decodedChar = char('t'); 
-  if (strcmp(CodeBuffer2,"..-") == 0)     decodedChar = char('u'); 
-  if (strcmp(CodeBuffer2,"...-") == 0)    decodedChar = char('v'); 
-  if (strcmp(CodeBuffer2,".--") == 0)     decodedChar = char('w'); 
-  if (strcmp(CodeBuffer2,"-..-") == 0)    decodedChar = char('x'); 
-  if (strcmp(CodeBuffer2,"-.--") == 0)    decodedChar = char('y'); 
-  if (strcmp(CodeBuffer2,"--..") == 0)    decodedChar = char('z'); 
-  
-  if (strcmp(CodeBuffer2,".----") == 0)   decodedChar = char('1'); 
-  if (strcmp(CodeBuffer2,"..---") == 0)   decodedChar = char('2'); 
-  if (strcmp(CodeBuffer2,"...--") == 0)   decodedChar = char('3'); 
-  if (strcmp(CodeBuffer2,"....-") == 0)   decodedChar = char('4'); 
-  if (strcmp(CodeBuffer2,".....") == 0)   decodedChar = char('5'); 
-  if (strcmp(CodeBuffer2,"-....") == 0)   decodedChar = char('6'); 
-  if (strcmp(CodeBuffer2,"--...") == 0)   decodedChar = char('7'); 
-  if (strcmp(CodeBuffer2,"---..") == 0)   decodedChar = char('8'); 
-  if (strcmp(CodeBuffer2,"----.") == 0)   decodedChar = char('9'); 
-  if (strcmp(CodeBuffer2,"-----") == 0)   decodedChar = char('0'); 
-
-  if (strcmp(CodeBuffer2,"..--..") == 0)  decodedChar = char('?'); 
-  if (strcmp(CodeBuffer2,".-.-.-") == 0)  decodedChar = char('.'); 
-  if (strcmp(CodeBuffer2,"--..--") == 0)  decodedChar = char(','); 
-  if (strcmp(CodeBuffer2,"-.-.--") == 0)  decodedChar = char('!'); 
-  if (strcmp(CodeBuffer2,".--.-.") == 0)  decodedChar = char('@'); 
-  if (strcmp(CodeBuffer2,"---...") == 0)  decodedChar = char(':'); 
-  if (strcmp(CodeBuffer2,"-....-") == 0)  decodedChar = char('-'); 
-  if (strcmp(CodeBuffer2,"-..-.") == 0)   decodedChar = char('/'); 
-
-  if (strcmp(CodeBuffer2,"-.--.") == 0)   decodedChar = char('('); 
-  if (strcmp(CodeBuffer2,"-.--.-") == 0)  decodedChar = char(')'); 
-  if (strcmp(CodeBuffer2,".-...") == 0)   decodedChar = char('_'); 
-  if (strcmp(CodeBuffer2,"...-..-") == 0) decodedChar = char('$'); 
-  if (strcmp(CodeBuffer2,"...-.-") == 0)  decodedChar = char('>'); 
-  if (strcmp(CodeBuffer2,".-.-.") == 0)   decodedChar = char('<'); 
-  if (strcmp(CodeBuffer2,"...-.") == 0)   decodedChar = char('~'); 
-  if (strcmp(CodeBuffer2,".-.-") == 0)    decodedChar = char('a'); // a umlaut
-  if (strcmp(CodeBuffer2,"---.") == 0)    decodedChar = char('o'); // o accent
-  if (strcmp(CodeBuffer2,".--.-") == 0)   decodedChar = char('a'); // a accent
-
-  if (decodedChar != '{') {
-    AddCharacter(decodedChar);
-    if (!graph && !dataSet)
+// Dictionary : the chars of a word are kept until its end, then corrected
+#include "WordCorrector.h"
+WordCorrector corrector;
+bool dictOn = false;
+
+void flushWord()
+{
+  char text[CORR_MAXCHARS + 1];
+  uint8_t conf[CORR_MAXCHARS];
+  int n = corrector.correct(text, conf);
+  for (int i = 0; i < n; i++)
+    printChar(text[i], conf[i]);
+}
+
+void printDecoded(const DecodedChar &d)
+{
+  if (dictOn && !dataSet)
+  {
+    if (d.c == ' ')
     {
-      lastChar = curChar;
-      curChar = decodedChar;
-      cptCharPrinted++;
-      if (cptCharPrinted > 100)
-        CRRequested = true;
-      Serial.print(decodedChar);
+      flushWord();
+      printChar(' ', d.confidence);
     }
-    if (dataSet)
-      printTimes(decodedChar);
+    else if (!corrector.add(d))
+    {
+      // Too long for a word of the dictionary
+      flushWord();
+      printChar(d.c, d.confidence);
+    }
+    return;
   }
+
+  printChar(d.c, d.confidence);
+  if (dataSet && (d.c != ' '))
+    printTimes(d);
 }
 
-float goertzelCoeff; // For Goertzel algorithm
-float Q1 = 0;
-float Q2 = 0;
+// End of transmission : the last word is not followed by a word space
+void endOfWordIfSilent()
+{
+  if ((corrector.wordLen == 0) && !spots.pending())
+    return;
+  long wordTime = (decoder.model == TIMING_ADAPTIVE) ? decoder.wordGapAvg : decoder.hightimesavg * 7;
+  if ((decoder.filteredstate == LOW) && ((long) (millis() - decoder.starttimelow) > 2 * wordTime))
+  {
+    flushWord();
+    spots.endOfWord();
+    printSpots();
+  }
+}
+
+// Trace : mesures du modèle de temps adaptatif
+void showTiming()
+{
+  if (trace && (decoder.model == TIMING_ADAPTIVE) && (decoder.dotAvg > 0))
+  {
+    TextBuf<48> text;
+    text.add("Dash/Dot=").add(decoder.dashDotRatio(), 1).add(" LtrSp=").add(decoder.charSpaceScale(), 1)
+        .add(" WordSp=").add(decoder.wordSpaceScale(), 1).add("  ");
+    tftDrawString(0, 240, text.c_str());
+  }
+}
+
+#include "Goertzel.h"
+Goertzel goertzel;      // For Goertzel algorithm
+Goertzel goertzelLeft;  // AFC : f - bw/2
+Goertzel goertzelRight; // AFC : f + bw/2
+Goertzel goertzelNoiseLow;  // AFC : f - 3.bw (noise reference)
+Goertzel goertzelNoiseHigh; // AFC : f + 3.bw (noise reference)
+
+#include "Resampler.h"
+Resampler resampler; // sampling_freq ==> PROCESSING_FREQ
 
 #define NBSAMPLEMIN 30
-#define NBSAMPLEMAX 250
+#define NBSAMPLEMAX 250 // At PROCESSING_FREQ
+#define ADCSAMPLEMAX ((NBSAMPLEMAX * 2) + 2) // ADC up to 2 x PROCESSING_FREQ
+int adcData[ADCSAMPLEMAX];
 int testData[NBSAMPLEMAX];
+int adcMidpoint = 1940; // Measured on NodeMCU32 with 3.3v divisor
 int nbSamples = 100;
 int newNbSamples = 100;
 int sNewNbSamples = 100;
+bool autoNbSamples = true; // nbSamples follows WPM
+int sDecoderWpm = 0;
 
 // you can set the tuning tone to 496, 558, 744 or 992
 int iFreq;
@@ -406,265 +524,498 @@ int freqs[] = { 496, // for MorseSample-15WPM.wav file
 bool autoTune = false;
 bool sAutoTune = false;
 int sensFreq = 1;
-float sampling_freq = 0;
+float sampling_freq = 0; // Measured ADC speed
 float target_freq = 0;
-void setFreq(int freq)
-{
-  target_freq = freqs[freq];
+float bw;
 
-  int k = (int) (0.5 + ((nbSamples * target_freq) / sampling_freq));
-  float omega = (2.0 * PI * k) / nbSamples;
-  goertzelCoeff = 2.0 * cos(omega);
+// AFC : the measured frequency drives target_freq, by steps of AFC_SLEW Hz max per block
+#define AFC_SLEW 2.0
+#define AFC_MINFREQ 300
+#define AFC_MAXFREQ 1200
+#define AFC_MINSNR 6 // magnitude / noise measured 3 bins away, to ignore the blocks where noise triggers the HIGH state
+bool afc = true;
+float measuredFreq = 0;
+int dispFreq = 0;
 
+void showFreq(float freq)
+{
+  dispFreq = (int) (freq + 0.5);
   tft.fillRect(60, 20, 48, 20, TFT_BLACK);
-  tftDrawString(60, 20, String(target_freq, 0));
+  tftDrawString(60, 20, String(dispFreq));
+}
+
+void tuneFreq(float freq)
+{
+  target_freq = freq;
+  goertzel.setFreq(target_freq, PROCESSING_FREQ);
+  goertzelLeft.setFreq(target_freq - (bw / 2), PROCESSING_FREQ);
+  goertzelRight.setFreq(target_freq + (bw / 2), PROCESSING_FREQ);
+  goertzelNoiseLow.setFreq(target_freq - (3 * bw), PROCESSING_FREQ);
+  goertzelNoiseHigh.setFreq(target_freq + (3 * bw), PROCESSING_FREQ);
+}
+
+void setFreq(int freq)
+{
+  tuneFreq(freqs[freq]);
+  measuredFreq = target_freq;
+  showFreq(measuredFreq);
 }
 
-float bw;
 void setBandWidth(int nbsampl)
 {
-  bw = sampling_freq / nbsampl;
+  bw = (float) PROCESSING_FREQ / nbsampl;
+  tuneFreq(target_freq); // AFC bins depend on bw
   tft.fillRect(180, 20, 36, 20, TFT_BLACK);
   tftDrawString(180, 20, String(bw, 0));
 }
 
-bool trace = false;
-int idxCde= 0;
-int idxCdeMax = 9;
-char cdes[] = { 'F',  // sampling_freq
-                'A',  // AutoTuneFreq
-                'V',  // Volume
-                'G',  // graph
-                'D',  // display
-                'T',  // trace
-                'I',  // Generate DataSet fo Neural Network training
-                'S',  // nbSamples
-                'N',  // nbTime filter
-                'R',  // magReactivity
-                'B'   // Space detector
-              }; 
+// Parameters of the DSP stage : changed in dspEdit (rotary, serial, presets, nbSamples following WPM),
+// published at once, taken by loop() at the start of a block only
+#include "Params.h"
+struct DspParams
+{
+  int nbSamples;
+  int nbTime;
+  int magReactivity;
+  int spaceDetector;
+  int model;
+};
+DspParams dspEdit;
+ParamSnapshot<DspParams> dspParams;
 
-void showCde(int cde)
+void publishDsp()
+{
+  dspParams.publish(dspEdit);
+}
+
+void applyDsp(const DspParams &p)
 {
-  String cdeText = "";
-  switch(cdes[cde])
+  decoder.nbTime = p.nbTime;
+  decoder.magReactivity = p.magReactivity;
+  decoder.spaceDetector = p.spaceDetector;
+  decoder.model = p.model;
+  if (p.nbSamples != nbSamples)
   {
-    case 'F':
-      cdeText = "Freq";
-      break;
-    case 'A':
-      if (autoTune)
-        cdeText = "AutoTune ON";
-      else
-        cdeText = "AutoTune OFF";
-      break;
-    case 'V':
-      cdeText = "Volume=" + String(potVal);
-      break;
-    case 'S':
-      cdeText = "NbSample=" + String(nbSamples);
-      break;
-    case 'N':
-      cdeText = "Filtre=" + String(nbTime);
-      break;
-    case 'R':
-      cdeText = "MagReact=" + String(magReactivity);
-      break;
-    case 'B':
-      cdeText = "DetectBL=" + String(spaceDetector);
-      break;
-    case 'G':
-      if (graph)
-        cdeText = "Graph ON";
-      else
-        cdeText = "Graph OFF";
-      break;
-    case 'D':
-      if (display)
-        cdeText = "Display ON";
-      else
-        cdeText = "Display OFF";
-      break;
-    case 'T':
-      if (trace)
-        cdeText = "Trace ON";
-      else
-        cdeText = "Trace OFF";
-      break;
-    case 'I':
-      if (dataSet)
-        cdeText = "DataSet ON";
-      else
-        cdeText = "DataSet OFF";
-      break;
+    nbSamples = p.nbSamples;
+    setBandWidth(nbSamples);
+  }
+}
+
+// nbSamples set by hand : it no longer follows WPM, until "autonbs" is set again
+void applyNbSamples()
+{
+  autoNbSamples = false;
+  publishDsp();
+}
+
+void applyAutoNbSamples()
+{
+  sDecoderWpm = 0; // nbSamples computed again on the next block
+  sNewNbSamples = 0;
+}
+
+// Presets by reception conditions, optimised on PC by tools/cwopt (command 'O')
+#include "DecoderPresets.h"
+int iPreset = -1; // -1 : none loaded
+
+void loadPreset(int i)
+{
+  const DecoderPreset &p = decoderPresets[i];
+  iPreset = i;
+  dspEdit.nbTime = p.nbTime;
+  dspEdit.magReactivity = p.magReactivity;
+  dspEdit.spaceDetector = p.spaceDetector;
+  dspEdit.model = p.model;
+  autoNbSamples = (p.nbSamples == 0);
+  if (autoNbSamples)
+    applyAutoNbSamples();
+  else
+    dspEdit.nbSamples = p.nbSamples; // "autonbs" to follow WPM again
+  publishDsp();
+}
+
+// Called on each block holding the tone : measure the exact frequency
+// using the 2 neighbour half-bins and move target_freq toward it
+void afcTrack(float magnitude)
+{
+  float noise = max(goertzelNoiseLow.magnitude(testData, nbSamples, adcMidpoint),
+                    goertzelNoiseHigh.magnitude(testData, nbSamples, adcMidpoint));
+  if (magnitude < noise * AFC_MINSNR)
+    return; // Noise, not a tone
+
+  float offset = goertzelPeakOffset(goertzelLeft.magnitude(testData, nbSamples, adcMidpoint),
+                                    magnitude,
+                                    goertzelRight.magnitude(testData, nbSamples, adcMidpoint));
+  measuredFreq = ((measuredFreq * 3) + target_freq + (offset * bw / 2)) / 4; // Rolling average
+
+  float step = measuredFreq - target_freq;
+  if (step > AFC_SLEW)
+    step = AFC_SLEW;
+  if (step < -AFC_SLEW)
+    step = -AFC_SLEW;
+  float freq = target_freq + step;
+  if (freq < AFC_MINFREQ)
+    freq = AFC_MINFREQ;
+  if (freq > AFC_MAXFREQ)
+    freq = AFC_MAXFREQ;
+  tuneFreq(freq);
+
+  if ((int) (measuredFreq + 0.5) != dispFreq)
+  {
+    eventTrace.add(millis(), EV_TUNE, EV_TUNE_AFC, 0, measuredFreq * 10);
+    showFreq(measuredFreq);
+  }
+}
+
+// Binary dump of the capture : "CAPTURE;<size>", then the bytes (tools/magreplay)
+void writeSerial(const void *data, int len)
+{
+  Serial.write((const uint8_t *) data, len);
+}
+
+void dumpCapture()
+{
+  while (frameTx.pending()) // No frame cut by the dump
+    drainFrames();
+  Serial.println();
+  Serial.println("CAPTURE;" + String(capture.dumpSize()));
+  capture.dump(writeSerial, sampling_freq, PROCESSING_FREQ, measuredFreq);
+  Serial.println();
+}
+
+// Binary dump of the event trace : "EVENTS;<size>", then the bytes (tools/cwevents)
+void dumpEvents()
+{
+  while (frameTx.pending())
+    drainFrames();
+  uint32_t nb = (eventTrace.nbTotal() < EVT_SIZE) ? eventTrace.nbTotal() : EVT_SIZE;
+  Serial.println();
+  Serial.println("EVENTS;" + String(sizeof(EventTraceHeader) + nb * sizeof(TraceEvent)));
+  eventTrace.dump(writeSerial);
+  Serial.println();
+}
+
+// Profiler : one line per stage, then the measures start again
+void profLine(const char *text)
+{
+  if (binOut)
+    frameTx.send(FRAME_TEXT, text, strlen(text));
+  else
+    serialPrintln(text);
+}
+
+void dumpProfiler()
+{
+#ifdef PROFILER
+  if (!binOut)
+    serialPrintln();
+  profiler.dump(profLine);
+  profiler.reset();
+#endif
+}
+
+void applyNet()
+{
+  net.reset();
+  netLastBlock = millis();
+  netTimeMax = 0;
+}
+
+bool statusDue = false;
+void applyBinOut()
+{
+  statusDue = binOut;
+  if (!binOut)
+    audioOut = false; // FRAME_AUDIO would be mixed with the text
+}
+
+// Raw audio (command 'L') : the ADC samples of each block in FRAME_AUDIO (tools/cwaudio), binary frames only
+#include "Adpcm.h"
+uint16_t audioSeq = 0;
+AdpcmState adpcm;
+
+void applyAudio()
+{
+  if (audioOut && !binOut)
+  {
+    binOut = true;
+    applyBinOut();
+  }
+}
+
+void sendAudio(const int *adc, int n, unsigned long ms)
+{
+  uint8_t payload[sizeof(FrameAudio) + AUDIO_MAXSAMPLES / 2];
+  int16_t pcm[AUDIO_MAXSAMPLES];
+  for (int pos = 0; pos < n; pos += AUDIO_MAXSAMPLES)
+  {
+    int nb = (n - pos > AUDIO_MAXSAMPLES) ? AUDIO_MAXSAMPLES : n - pos;
+    FrameAudio h;
+    h.ms = ms + (unsigned long) (pos * 1000.0 / sampling_freq);
+    h.seq = audioSeq++; // Even if the frame is dropped
+    h.rate = sampling_freq + 0.5;
+    h.midpoint = adcMidpoint;
+    h.predictor = adpcm.predictor;
+    h.index = adpcm.index;
+    h.nbSamples = nb;
+    for (int i = 0; i < nb; i++)
+      pcm[i] = constrain((adc[pos + i] - adcMidpoint) * 16, -32768, 32767);
+    adpcmEncode(adpcm, pcm, nb, payload + sizeof(h));
+    memcpy(payload, &h, sizeof(h));
+    frameTx.send(FRAME_AUDIO, payload, sizeof(h) + (nb + 1) / 2);
   }
-  tft.fillRect(60, 300, 152, 20, TFT_BLACK);
-  tftDrawString(60, 300, cdeText);
 }
 
 int cptLoop = 0;
+
+// NVS : settings of the registry, and the warm boot state
+#include <Preferences.h>
+Preferences prefs;
+
+// Warm boot : ADC rate calibration and lock state of the last session. With it, setup() does not wait
+// 1.2s + 4s : the cached rate is used at once and refined on the acquisitions of loop() (refineRate())
+#define WARM_VERSION 1
+struct WarmState
+{
+  uint16_t version;
+  int16_t wpm;           // 0 : never locked
+  float samplingFreq;
+  float freq;            // Measured (AFC) frequency
+  int32_t magnitudelimit;
+  int32_t potVal;
+};
+WarmState warm;
+bool warmBoot = false;
+bool warmDue = false;
+void onWarm(void *) { warmDue = true; }
+Timer warmTimer(onWarm);
+long warmChars = 0;          // Decoded since the last save
+bool rateRefined = true;     // false on a warm boot, until refineRate() measured 4s of samples
+uint32_t rateSamples = 0;
+uint32_t rateUs = 0;
+
+bool loadWarm()
+{
+  return (prefs.getBytes("warm", &warm, sizeof(warm)) == sizeof(warm)) && (warm.version == WARM_VERSION)
+         && (warm.samplingFreq > 0);
+}
+
+void saveWarm()
+{
+  warm.version = WARM_VERSION;
+  prefs.putBytes("warm", &warm, sizeof(warm));
+}
+
+// Serial "coldboot" : the next boot measures the ADC rate again
+void forgetWarm()
+{
+  prefs.remove("warm");
+}
+
+// Effects of a change, and menu texts
+void applyFreq() { setFreq(iFreq); }
+void applyVolume() { setVolume(potVal); }
+void applyPreset() { loadPreset(iPreset); }
+
+void applyDisplay()
+{
+  displayLine.enabled = display;
+  if (!display)
+    displayLine.clearScreen();
+}
+
+void applyTrace()
+{
+  if (!trace)
+    tft.fillRect(0, 220, 480, 60, TFT_BLACK); // Clear trace
+}
+
+void applyDataSet()
+{
+  if (dataSet)
+  {
+    sAutoTune = autoTune;
+    autoTune = false;
+  }
+  else
+    autoTune = sAutoTune;
+}
+
+void applyDict()
+{
+  if (!dictOn)
+    flushWord();
+}
+
+void formatFreq(ParamText &t) { t.add("Freq=").add(freqs[iFreq]).add("Hz"); }
+void formatModel(ParamText &t) { t.add((dspEdit.model == TIMING_ADAPTIVE) ? "Timing Adapt" : "Timing G6EJD"); }
+void formatCapture(ParamText &t) { t.add("Capture ").add(capture.nbBlocks()); }
+void formatEvents(ParamText &t) { t.add("Events ").add((long) eventTrace.nbTotal()); }
+
+void formatNet(ParamText &t)
+{
+  if (netOn)
+    t.add("NN ON ").add((long) netTimeMax).add("us");
+  else
+    t.add("NN OFF");
+}
+
+void formatPreset(ParamText &t)
+{
+  t.add("Preset ").add((iPreset < 0) ? "-" : decoderPresets[iPreset].name);
+}
+
+void formatProfiler(ParamText &t)
+{
+#ifdef PROFILER
+  t.add("Profiler ").add((long) profiler.stages[PROF_LOOP].count);
+#else
+  t.add("Profiler -");
+#endif
+}
+
+// Commands : the rotary menu in this order, the serial commands and the saved settings
+#define NBFREQS ((int) (sizeof(freqs) / sizeof(freqs[0])))
+const ParamDef paramDefs[] = {
+  // cde  name        label       type         min  max             step unit  value                  apply         format          flags
+  { 'F', "freq",      "Freq",     PARAM_INT,     0, NBFREQS - 1,       1, "",  &iFreq,                applyFreq,    formatFreq,     PARAM_PERSIST | PARAM_ACCEL },
+  { 'A', "autotune",  "AutoTune", PARAM_BOOL,    0, 1,                 1, "",  &autoTune,             0,            0,              PARAM_PERSIST },
+  { 'C', "afc",       "AFC",      PARAM_BOOL,    0, 1,                 1, "",  &afc,                  0,            0,              PARAM_PERSIST },
+  { 'M', "model",     "Timing",   PARAM_ENUM,    TIMING_G6EJD, TIMING_ADAPTIVE, 1, "", &dspEdit.model, publishDsp,  formatModel,    PARAM_PERSIST },
+  { 'V', "volume",    "Volume",   PARAM_INT,     0, 255,               1, "",  &potVal,               applyVolume,  0,              PARAM_ACCEL },
+  { 'G', "graph",     "Graph",    PARAM_BOOL,    0, 1,                 1, "",  &graph,                0,            0,              0 },
+  { 'D', "display",   "Display",  PARAM_BOOL,    0, 1,                 1, "",  &display,              applyDisplay, 0,              0 },
+  { 'T', "trace",     "Trace",    PARAM_BOOL,    0, 1,                 1, "",  &trace,                applyTrace,   0,              0 },
+  { 'I', "dataset",   "DataSet",  PARAM_BOOL,    0, 1,                 1, "",  &dataSet,              applyDataSet, 0,              0 },
+  { 'Q', "conf",      "Conf",     PARAM_BOOL,    0, 1,                 1, "",  &confOutput,           0,            0,              PARAM_PERSIST },
+  { 'W', "dict",      "Dict",     PARAM_BOOL,    0, 1,                 1, "",  &dictOn,               applyDict,    0,              PARAM_PERSIST },
+  { 'P', "spots",     "Spots",    PARAM_BOOL,    0, 1,                 1, "",  &spotsOn,              0,            0,              PARAM_PERSIST },
+  { 'X', "capture",   "Capture",  PARAM_ACTION,  0, 0,                 0, "",  0,                     dumpCapture,  formatCapture,  0 },
+  { 'E', "net",       "NN",       PARAM_BOOL,    0, 1,                 1, "",  &netOn,                applyNet,     formatNet,      0 },
+  { 'O', "preset",    "Preset",   PARAM_INT,     0, NBPRESETS - 1,     1, "",  &iPreset,              applyPreset,  formatPreset,   0 },
+  { 'K', "tree",      "Tree",     PARAM_BOOL,    0, 1,                 1, "",  &treeOn,               0,            0,              PARAM_PERSIST },
+  { 'U', "bin",       "Bin",      PARAM_BOOL,    0, 1,                 1, "",  &binOut,               applyBinOut,  0,              0 },
+  { 'L', "audio",     "Audio",    PARAM_BOOL,    0, 1,                 1, "",  &audioOut,             applyAudio,   0,              0 },
+  { 'H', "profiler",  "Profiler", PARAM_ACTION,  0, 0,                 0, "",  0,                     dumpProfiler, formatProfiler, 0 },
+  { 'J', "events",    "Events",   PARAM_ACTION,  0, 0,                 0, "",  0,                     dumpEvents,   formatEvents,   0 },
+  { 'Z', "autonbs",   "AutoNbS",  PARAM_BOOL,    0, 1,                 1, "",  &autoNbSamples,        applyAutoNbSamples, 0,        0 },
+  { 'S', "nbsamples", "NbSample", PARAM_INT,     NBSAMPLEMIN, NBSAMPLEMAX, 5, "", &dspEdit.nbSamples, applyNbSamples, 0,          PARAM_ACCEL },
+  { 'N', "nbtime",    "Filtre",   PARAM_INT,     0, 50,                1, "ms", &dspEdit.nbTime,      publishDsp,   0,              PARAM_PERSIST | PARAM_ACCEL },
+  { 'R', "magreact",  "MagReact", PARAM_INT,     1, 250,               1, "",  &dspEdit.magReactivity, publishDsp,  0,              PARAM_PERSIST | PARAM_NOMENU },
+  { 'B', "spacedet",  "DetectBL", PARAM_INT,     0, 20,                1, "",  &dspEdit.spaceDetector, publishDsp,  0,              PARAM_PERSIST | PARAM_NOMENU },
+  { 'Y', "coldboot",  "ColdBoot", PARAM_ACTION,  0, 0,                 0, "",  0,                     forgetWarm,   0,              PARAM_NOMENU }
+};
+ParamRegistry params(paramDefs, sizeof(paramDefs) / sizeof(paramDefs[0]));
+int idxCde = 0;
+
+void showCde(int cde)
+{
+  ParamText text;
+  params.text(paramDefs[cde], text);
+  tft.fillRect(60, 300, 152, 20, TFT_BLACK);
+  tftDrawString(60, 300, text.c_str());
+}
+
 void manageRotaryButton()
 {
   // Manage Commands Rotary button
-  // Rotary Encoder
-  unsigned char dRot = rot.process();    
-  if (dRot)
+  // Events queued by the interrupts (rot.attach()) : nothing lost during a slow loop()
+  RotaryEvent e;
+  while (rot.read(e))
   {
     cptLoop = 0; // To show new acquired and loop time
-    if (dRot != DIR_CW)
+    if (e.type == ROT_EV_TURN)
     {
-      switch(cdes[idxCde])
-      {
-        case 'F':
-          iFreq++;
-          if (iFreq > iFreqMax)
-            iFreq = iFreqMax;
-          setFreq(iFreq);
-          break;
-        case 'A':
-          autoTune = !autoTune;
-          break;
-        case 'V':
-          potVal++;
-          setVolume(potVal); 
-          break;
-        case 'S':
-          nbSamples += 5;
-          if (nbSamples > NBSAMPLEMAX)
-            nbSamples = NBSAMPLEMAX;
-          setBandWidth(nbSamples);
-          break;
-        case 'N':
-          nbTime++;
-          if (nbTime > 10)
-            nbTime = 10;
-          break;
-        case 'R':
-          magReactivity++;
-          if (magReactivity > 10)
-            magReactivity = 10;
-          break;
-        case 'B':
-          spaceDetector++;
-          if (spaceDetector > 10)
-            spaceDetector = 10;
-          break;
-        case 'G':
-          graph = !graph;
-          break;
-        case 'D':
-          display = !display;
-          if (!display)
-            clearDisplay();
-          break;
-        case 'T':
-          trace = !trace;
-          if (!trace)
-          {
-            // Clear trace
-            tft.fillRect(0, 220, 480, 60, TFT_BLACK);
-          }
-          break;
-        case 'I':
-          dataSet = !dataSet;
-          if (dataSet)
-          {
-            sAutoTune = autoTune;
-            autoTune = false;
-          }
-          else
-            autoTune = sAutoTune;
-          break;
-      }        
+      // Acceleration for the values only, not for the ON / OFF and the dumps. Clockwise : down
+      const ParamDef &p = paramDefs[idxCde];
+      int n = (p.flags & PARAM_ACCEL) ? abs(e.steps) : 1;
+      params.step(p, (e.steps > 0) ? -n : n);
+      showCde(idxCde);
     }
-    else
+    else if (e.type == ROT_EV_PRESS) // SW pressed
     {
-      switch(cdes[idxCde])
-      {
-        case 'F':
-          iFreq--;
-          if (iFreq < 0)
-            iFreq = 0;
-          setFreq(iFreq);
-          break;
-        case 'A':
-          autoTune = !autoTune;
-          break;
-        case 'V':
-          potVal--;
-          setVolume(potVal); 
-          break;
-        case 'S':
-          nbSamples -= 5;
-          if (nbSamples < NBSAMPLEMIN)
-            nbSamples = NBSAMPLEMIN;
-          setBandWidth(nbSamples);
-          break;
-        case 'N':
-          nbTime--;
-          if (nbTime < 0)
-            nbTime = 0;
-          break;
-        case 'R':
-          magReactivity--;
-          if (magReactivity < 1)
-            magReactivity = 1;
-          break;
-        case 'B':
-          spaceDetector--;
-          if (spaceDetector < 0)
-            spaceDetector = 0;
-          break;
-        case 'G':
-          graph = !graph;
-          break;
-        case 'D':
-          display = !display;
-          if (!display)
-            clearDisplay();
-          break;
-        case 'T':
-          trace = !trace;
-          if (!trace)
-          {
-            // Clear trace
-            tft.fillRect(0, 220, 480, 60, TFT_BLACK);
-          }
-          break;
-        case 'I':
-          dataSet = !dataSet;
-          if (dataSet)
-          {
-            sAutoTune = autoTune;
-            autoTune = false;
-          }
-          else
-            autoTune = sAutoTune;
-          break;
-      }
+      idxCde = params.nextMenu(idxCde);
+      showCde(idxCde);
     }
-    showCde(idxCde);
   }
+}
+
+// Serial commands : one per line (see Params.h), answered by "PARAM;..." lines
+char cmdLine[40];
+int cmdLen = 0;
+
+void paramReply(const char *text)
+{
+  if (binOut)
+    frameTx.send(FRAME_TEXT, text, strlen(text));
+  else
+    serialPrintln(text);
+}
 
-  // Manage Rotary SW button
-  rotSWState = digitalRead(rotEncSW);
-  if (rotSWState != rotSWLastState)
+void readCommands()
+{
+  while (Serial.available() > 0)
   {
-    if (rotSWState == LOW) // SW pressed
+    char c = Serial.read();
+    if ((c == '\r') || (c == '\n'))
     {
-      idxCde++;
-      if (idxCde == idxCdeMax)
-        idxCde = 0;
+      if (cmdLen == 0)
+        continue;
+      cmdLine[cmdLen] = '\0';
+      cmdLen = 0;
+      params.command(cmdLine, paramReply);
       showCde(idxCde);
-    }        
-    cptLoop = 0;
+    }
+    else if (cmdLen < (int) sizeof(cmdLine) - 1)
+      cmdLine[cmdLen++] = c;
+  }
+}
+
+// Settings (PARAM_PERSIST) saved in NVS 5s after the last change, or on "save"
+uint32_t savedChanges = 0;
+uint32_t scheduledChanges = 0; // params.changes when saveTimer was last (re)scheduled
+bool saveDue = false;
+void onSave(void *) { saveDue = true; }
+Timer saveTimer(onSave);
+
+void prefsWrite(const char *key, int32_t value) { prefs.putInt(key, value); }
+int32_t prefsRead(const char *key, int32_t defaultValue) { return prefs.getInt(key, defaultValue); }
+
+void saveParams()
+{
+  if (params.changes != savedChanges)
+  {
+    if (params.changes != scheduledChanges)
+    {
+      // A new change : 5s from now
+      scheduledChanges = params.changes;
+      saveDue = false;
+      decoder.timers.schedule(saveTimer, millis() + 5000);
+    }
+    else if (saveDue)
+    {
+      saveDue = false;
+      params.save(prefsWrite);
+      savedChanges = params.changes;
+    }
+  }
+  if (params.saveRequested)
+  {
+    params.saveRequested = false;
+    decoder.timers.cancel(saveTimer);
+    saveDue = false;
+    params.save(prefsWrite);
+    savedChanges = params.changes;
   }
-  rotSWLastState = rotSWState;
 }
 
 void setup() {
   Serial.begin(115200);
-  delay(1200); // 1200 mini to wait Serial is initialized...
+  decoder.events = &eventTrace;
+  prefs.begin("cwdecoder", false);
+  warmBoot = loadWarm();
+  if (!warmBoot)
+    delay(1200); // 1200 mini to wait Serial is initialized...
 
   // TFT 4" SPI Init
   // Max SPI_FREQUENCY for this tft is 80000000 (80MHz) which is also the Max SPI speed for ESP32
@@ -676,6 +1027,9 @@ void setup() {
   tft.setTextSize(1);
   tft.setTextColor(TFT_ORANGE);
   uint32_t cpu_freq = esp_clk_cpu_freq();
+#ifdef PROFILER
+  profiler.ticksPerUs = cpu_freq / 1000000;
+#endif
   tftDrawString(0, 5, "CW Decoder V2.0a (03/01/2024) by F4LAA (PlatformIO)             CpuFreq: " + String(cpu_freq / 1000000) + "MHz", true);
   tft.setTextSize(2);
 
@@ -684,7 +1038,7 @@ void setup() {
   rot.begin(true);
   rotALastState = digitalRead(rotEncA);
   pinMode (rotEncSW,INPUT_PULLUP);
-  //rotSWState = digitalRead(rotEncSW);
+  rot.attach(rotEncSW); // Interrupts on A, B and SW
   /* */
 
   // Gestion des ADC
@@ -707,11 +1061,25 @@ void setup() {
   // Now, i leave those 2 lines commented, 
   // and i try to see what happen to ADC speed when compiling ot not the function clearIfNotChanged()
 
-  // Measure sampling_freq
-  int tStartLoop = millis();
-  int cpt = 0;
-  while ( (millis() - tStartLoop) < 4000) { testData[0] = analogRead(A0); cpt++;}
-  sampling_freq = cpt / 4;  // Measured at Startup on NodeMCU-32S  
+  // Measure sampling_freq (warm boot : the last one, refined by loop())
+  if (warmBoot)
+  {
+    sampling_freq = warm.samplingFreq;
+    rateRefined = false;
+  }
+  else
+  {
+    int tStartLoop = millis();
+    int cpt = 0;
+    while ( (millis() - tStartLoop) < 4000) { testData[0] = analogRead(A0); cpt++;}
+    sampling_freq = cpt / 4;  // Measured at Startup on NodeMCU-32S  
+    if (sampling_freq > 2 * PROCESSING_FREQ)
+      sampling_freq = 2 * PROCESSING_FREQ; // adcData[] size
+    memset(&warm, 0, sizeof(warm));
+    warm.samplingFreq = sampling_freq;
+    saveWarm();
+  }
+  resampler.setRates(sampling_freq, PROCESSING_FREQ);
   //Serial.println("sampling_freq=" + String(sampling_freq)); // 11496 when this line is commented !!!! and 10114 when this line is uncommented
 
   // Templates
@@ -719,6 +1087,7 @@ void setup() {
   tftDrawString(0, 20, "Freq=    Hz BW=   Hz WPM=   MAG=");
   tftDrawString(0, 280, "Acq=   ms", true);  
   tftDrawString(116, 280, "Loop=   ms", true);  
+  tftDrawString(240, 280, "D=", true);  
   tftDrawString(0, 300, "Cde:");
   tftDrawString(312, 280, "Volume:");
   tftDrawString(312, 300, "SmplFreq=", true);
@@ -734,16 +1103,36 @@ void setup() {
   iFreq = 3; // = 640Hz i.e. la frequence CW de l'IC-7300 
   setFreq(iFreq); 
 
-  idxCde = 0;
-  showCde(idxCde);
-
-  clearDisplayLine(); // CodeBuffer suit en mémoire. C'est lui qui contient le \0 final
-  clearCodeBuffer(true);
+  displayLine.clear();
 
   // SPI Potentiometre (uses SPI instance defined in TFT library)
   pinMode (slaveSelectPin, OUTPUT); 
   setVolume(potVal); // Valeur mediane
 
+  // DSP parameters, then the saved settings
+  dspEdit = { nbSamples, decoder.nbTime, decoder.magReactivity, decoder.spaceDetector, decoder.model };
+  params.load(prefsRead);
+  savedChanges = params.changes;
+  scheduledChanges = params.changes;
+  publishDsp();
+  DspParams dsp;
+  if (dspParams.read(dsp))
+    applyDsp(dsp);
+
+  // Warm boot : back on the last signal, at its speed
+  if (warmBoot && (warm.wpm > 0))
+  {
+    tuneFreq(warm.freq);
+    measuredFreq = warm.freq;
+    showFreq(measuredFreq);
+    setVolume(constrain(warm.potVal, 0, 255));
+    decoder.warmStart(warm.wpm, warm.magnitudelimit);
+  }
+  decoder.timers.schedule(warmTimer, millis() + 60000);
+
+  idxCde = 0;
+  showCde(idxCde);
+
   /* Debug SPI Potentiometer *
   int potSens = 1;
 deb:
@@ -768,19 +1157,21 @@ void changeVolume(int delta)
   setVolume(cValue);
 }
 
-long startLowSignal = 0;
-long startLowSound = 0;
+// Timers on decoder.timers (ms)
+bool lowSignalTimeout = false;
+void onLowSignal(void *) { lowSignalTimeout = true; }
+Timer lowSignalTimer(onLowSignal); // 5s without audible signal
 bool bScan = false;
 void stopScan()
 {
-  startLowSignal = 0;
+  decoder.timers.cancel(lowSignalTimer);
+  lowSignalTimeout = false;
   bScan = false;  
 }
 
 int vMin = 32000;
 int vMax = 0;
 int tStartLoop;
-int adcMidpoint = 1940; // Measured on NodeMCU32 with 3.3v divisor
 float vMoy = adcMidpoint;
 #define MAXMOY 20
 int cptMoy = 0;
@@ -791,9 +1182,119 @@ bool moyChanged = false;
 bool moyComputed = false;
 bool silentDuringSound = false;
 int silent = 5; // barGraph silent level
+void onLowSound(void *)
+{
+  silentDuringSound = false;
+  moyComputed = false;
+}
+Timer lowSoundTimer(onLowSound); // 10s with low sound
+
+// Neural decoder : one step per block, stopped if slower than the acquisition of a block
+void netBlock(float mag, unsigned long now)
+{
+  unsigned long t0 = micros();
+  char c = net.process(mag, now - netLastBlock);
+  netTime = micros() - t0;
+  netLastBlock = now;
+  if (netTime > netTimeMax)
+    netTimeMax = netTime;
+  if (c && !bScan)
+    printChar(c, net.confidence);
+  if (netTime > 1e6 * resampler.inputCount(nbSamples) / sampling_freq)
+  {
+    netOn = false;
+    if (binOut)
+      sendText(FRAME_TEXT, "NN OFF : " + String(netTime) + "us per block");
+    else
+      serialPrintln(("\nNN OFF : " + String(netTime) + "us per block").c_str());
+  }
+}
+
+// Binary frames : state of the decoder every second
+void onStatus(void *) { statusDue = true; }
+Timer statusTimer(onStatus);
+// Statistics of the last second : heap allocations, sampled time
+bool secondDue = true;
+void onSecond(void *) { secondDue = true; }
+Timer secondTimer(onSecond);
+uint32_t heapLast = 0;
+
+// 4 chars (264..312) : "Volume:" starts at x=312
+void showDuty()
+{
+  TextBuf<8> text;
+  text.add((int) (acqMon.dutyPermil / 10)).add('%');
+  while (text.length() < 4)
+    text.add(' ');
+  tft.setTextColor(acqMon.overruns ? TFT_RED : TFT_WHITE, TFT_BLACK);
+  tftDrawString(264, 280, text.c_str(), true);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+}
+void sendStatus()
+{
+  FrameStatus f;
+  f.ms = millis();
+  f.freq = measuredFreq;
+  f.samplingFreq = sampling_freq;
+  f.nbSamples = nbSamples;
+  f.wpm = constrain(decoder.wpm, 0, 255);
+  f.flags = ((decoder.model == TIMING_ADAPTIVE) ? STATUS_ADAPTIVE : 0) | (afc ? STATUS_AFC : 0) | (bScan ? STATUS_SCAN : 0)
+            | (netOn ? STATUS_NET : 0) | (treeOn ? STATUS_TREE : 0) | (dictOn ? STATUS_DICT : 0);
+  f.dropped = frameTx.dropped;
+  f.allocs = (heapPerSec > 65535) ? 65535 : heapPerSec;
+  f.dutyPermil = acqMon.dutyPermil;
+  f.gapMax = acqMon.gapMax;
+  f.overruns = acqMon.totalOverruns;
+  frameTx.send(FRAME_STATUS, &f, sizeof(f));
+}
+
+// ADC rate measured on the acquisitions (as the 4s of the cold boot), then saved for the next boot
+void refineRate(int nbAdcSamples, uint32_t us)
+{
+  rateSamples += nbAdcSamples;
+  rateUs += us;
+  if (rateUs < 4000000)
+    return;
+  rateRefined = true;
+  float rate = rateSamples * 1e6 / rateUs;
+  if (rate > 2 * PROCESSING_FREQ)
+    rate = 2 * PROCESSING_FREQ; // adcData[] size
+  if (fabs(rate - sampling_freq) > sampling_freq / 500) // 0.2%
+  {
+    sampling_freq = rate;
+    resampler.setRates(sampling_freq, PROCESSING_FREQ);
+    tftDrawString(420, 300, String(sampling_freq, 0) + " ", true);
+    warm.samplingFreq = sampling_freq;
+    saveWarm(); // Not written at each boot when the rate did not move
+  }
+}
+
+// Lock state, at most once a minute, when characters were decoded and something moved
+void updateWarm()
+{
+  warmDue = false;
+  decoder.timers.schedule(warmTimer, millis() + 60000);
+  if (bScan || (decoder.wpm <= 0) || (warmChars == 0))
+    return;
+  warmChars = 0;
+  if ((abs(decoder.wpm - warm.wpm) < 2) && (fabs(measuredFreq - warm.freq) < 5) && (abs(potVal - warm.potVal) < 8)
+      && (abs(decoder.magnitudelimit - warm.magnitudelimit) < warm.magnitudelimit / 4))
+    return;
+  warm.wpm = decoder.wpm;
+  warm.freq = measuredFreq;
+  warm.potVal = potVal;
+  warm.magnitudelimit = decoder.magnitudelimit;
+  saveWarm();
+}
 
 void loop() {
+  PROF_SCOPE(PROF_LOOP);
   cptLoop++;
+
+  // Parameters of this block : a change is never taken in the middle of a block
+  DspParams dsp;
+  if (dspParams.read(dsp))
+    applyDsp(dsp);
   if(cptLoop == 1)
   {
     tStartLoop = millis();
@@ -829,9 +1330,25 @@ Acq:
   /* */
 
   // Acquisition
-  for (int i = 0; i < nbSamples; i++) 
+  int nbAdcSamples = resampler.inputCount(nbSamples);
+  unsigned long acqStart = millis();
+  unsigned long acqStartUs = micros();
+  {
+    PROF_SCOPE(PROF_ACQ);
+    for (int i = 0; i < nbAdcSamples; i++) 
+    {
+      adcData[i] = analogRead(A0);
+    }
+  }
+  uint32_t acqEndUs = micros();
+  acqMon.block(acqStartUs, acqEndUs);
+  if (!rateRefined)
+    refineRate(nbAdcSamples, acqEndUs - acqStartUs);
+  if (binOut && audioOut)
+    sendAudio(adcData, nbAdcSamples, acqStart);
   {
-    testData[i] = analogRead(A0);
+    PROF_SCOPE(PROF_RESAMPLE);
+    resampler.process(adcData, testData, nbSamples);
   }
 
   if (cptLoop == 1)
@@ -841,168 +1358,58 @@ Acq:
   }
 
   // Compute magniture using Goertzel algorithm
-  Q2 = 0;
-  Q1 = 0;
-  for (int index = 0; index < nbSamples; index++) {
-    int curValue = testData[index] - adcMidpoint;
-    float Q0 = (float)curValue + (goertzelCoeff * Q1) - Q2;
-    Q2 = Q1;
-    Q1 = Q0;
-  }
-  magnitude = sqrt( (Q1 * Q1) + (Q2 * Q2) - Q1 * Q2 * goertzelCoeff);
-
-  // Adjust magnitudelimit
-  if (magnitude > magnitudelimit_low) { magnitudelimit = (magnitudelimit + ((magnitude - magnitudelimit) / magReactivity)); } /// moving average filter
-  if (magnitudelimit < magnitudelimit_low) magnitudelimit = magnitudelimit_low;
-
-  // Now check the magnitude //
-  if (magnitude > magnitudelimit * 0.3) // just to have some space up
-    realstate = HIGH;
-  else
-    realstate = LOW;
-
-  // Clean up the state with a noise blanker //  
-  if (realstate != realstatebefore) 
   {
-    laststarttime = millis();
-  }
-  if ((millis() - laststarttime) > nbTime) 
-  {
-    if (realstate != filteredstate) 
-    {
-      filteredstate = realstate;
-    }
+    PROF_SCOPE(PROF_GOERTZEL);
+    magnitude = goertzel.magnitude(testData, nbSamples, adcMidpoint);
   }
 
-  if (filteredstate != filteredstatebefore) 
+  // Decode : states HIGH / LOW, . / - and characters
+  unsigned long now = millis();
   {
-    if (filteredstate == HIGH) 
-    {
-      // front montant
-      starttimehigh = millis();
-      lowduration = (starttimehigh - starttimelow);
-    }
-
-    if (filteredstate == LOW) 
+    PROF_SCOPE(PROF_DECODE);
+    capture.process(decoder, magnitude, now, !bScan, nbSamples);
+  }
+  if (netOn)
+    netBlock(magnitude, now);
+  else
+    for (int i = 0; i < decoder.nbDecoded; i++)
     {
-      // front descendant
-      starttimelow = millis();
-      highduration = (starttimelow - starttimehigh);
-
-      // Strange cumputation of hightimesavg (very low compared to average of highduration )
-      if ( (highduration < (2 * hightimesavg)) || (hightimesavg == 0) ) 
+      DecodedChar &d = decoder.decoded[i];
+      if (d.c != ' ')
       {
-        hightimesavg = (highduration + hightimesavg + hightimesavg) / 3; // now we know avg dit time ( rolling 3 avg)
-      }
-      if (highduration > (5 * hightimesavg) ) 
-      {
-        hightimesavg = highduration + hightimesavg;   // if speed decrease fast ..
+        if (treeOn && (treeUnit.value() > 0))
+          d.c = cwTreeClassify(d.times, treeUnit.value());
+        treeUnit.add(d.times);
       }
+      printDecoded(d);
     }
-  }
+  if (decoder.nbDecoded > 0)
+    showTiming();
+  warmChars += decoder.nbDecoded;
+  endOfWordIfSilent();
+
+  // AFC : follow the tone while it is clearly present
+  if (afc && !bScan && (decoder.realstate == HIGH) && (decoder.filteredstate == HIGH))
+    afcTrack(magnitude);
 
   if (!bScan) // Not in search frequency mode
   {
-    // Now check the baud rate based on dit or dah duration either 1, 3 or 7 pauses
-    if (filteredstate != filteredstatebefore) {
-      stop = LOW;
-      if (filteredstate == LOW) { // we did end on a HIGH
-        if (highduration < (hightimesavg * 2) && highduration > (hightimesavg * 0.6)) { /// 0.6 filter out false dits
-          strcat(CodeBuffer, ".");
-          addTime(highduration); // Dot duration
-          bufLen++;
-          //Serial.print(".");
-
-          // if ( (highduration > 10)  // Ignore too short highduration caused by noise
-          //      && 
-          //      (highduration < 200) // Ignore too long highduration caused by silent
-          //    )
-          // {
-          //   // Compute WPM based on Dot
-          //   wpm = (wpm + (1200 / highduration )) / 2; //// the most precise we can do ;o)
-
-          //   // Now, adjust NBSAMPLES according to WPM
-          //   newNbSamples = map(wpm, 15, 33, 110, 70);  // Mesuré OK: 110samples pour 15WPM, 70samples pour 33WPM       
-          //   if (abs(newNbSamples - sNewNbSamples) > 2) 
-          //   {
-          //     nbSamples = newNbSamples;
-          //     setBandWidth(nbSamples);
-          //   }
-          //   sNewNbSamples = newNbSamples;
-          // }
-        }
-        
-        if (highduration > (hightimesavg * 2) && highduration < (hightimesavg * 6)) {
-          strcat(CodeBuffer, "-");
-          addTime(highduration); // Dash duration
-          bufLen++;
-          //Serial.print("-");
-
-          if ( (highduration > 66) // Ignore too short highduration caused by silent
-               && 
-               (highduration < 500) // Ignore too long highduration caused by silent
-             )
-          {
-            // Compute WPM based on Dash
-            wpm = (wpm + (1200 / ((highduration) / 3))) / 2; //// the most precise we can do ;o)
-
-            // Now, adjust NBSAMPLES according to WPM
-            newNbSamples = map(wpm, 15, 33, 110, 70);  // Mesuré OK: 110samples pour 15WPM, 70samples pour 33WPM       
-            if (abs(newNbSamples - sNewNbSamples) > 2) 
-            {
-              nbSamples = newNbSamples;
-              setBandWidth(nbSamples);
-            }
-            sNewNbSamples = newNbSamples;
-          }
-        }
-      }
-
-      if (filteredstate == HIGH) { // we did end a LOW
-        float lacktime = 1;
-        if (wpm > 25) lacktime = 1.0; ///  when high speeds we have to have a little more pause before new letter or new word
-        if (wpm > 30) lacktime = 1.2;
-        if (wpm > 35) lacktime = 1.5;
-
-        bool storeTime = true;
-        if (lowduration > (hightimesavg * (2 * lacktime)) && lowduration < hightimesavg * (5 * lacktime)) { // letter space
-            storeTime = false;
-            CodeToChar();
-        }
-
-        if (lowduration >= hightimesavg * (spaceDetector * lacktime)) { // word space
-          storeTime = false;
-          CodeToChar();        
-          AddCharacter(' ');
-          if (!graph && !dataSet)
-          {
-            Serial.print(" ");
-            if ( (lastChar == 'b') and (curChar == 'k') ) // EOL
-            {
-              Serial.println("<===");
-              CRRequested = false;
-              cptCharPrinted = 0;
-            }
-          }
-        }
+    if (autoNbSamples && (decoder.wpm != sDecoderWpm))
+    {
+      sDecoderWpm = decoder.wpm;
 
-        if (storeTime) 
-          addTime(lowduration); // Silent inside char
+      // Now, adjust NBSAMPLES according to WPM
+      newNbSamples = map(decoder.wpm, 15, 33, 110, 70);  // Mesuré OK: 110samples pour 15WPM, 70samples pour 33WPM       
+      newNbSamples = constrain(newNbSamples, NBSAMPLEMIN, NBSAMPLEMAX);
+      if (abs(newNbSamples - sNewNbSamples) > 2) 
+      {
+        dspEdit.nbSamples = newNbSamples;
+        publishDsp();
       }
-    } // filteredstate != filteredstatebefore
-
-    if ((millis() - starttimelow) > (highduration * 6) && stop == LOW) {
-      CodeToChar();
-      stop = HIGH;
+      sNewNbSamples = newNbSamples;
     }
 
     clearIfNotChanged();
-
-    // Sécurité buffer overflow
-    if (strlen(CodeBuffer) == bufSize - 1) {
-      // On a reçu des . et -, mais pas de silence...
-      clearCodeBuffer(false);
-    }
   } // !bScan
 
   if (graph)
@@ -1010,29 +1417,39 @@ Acq:
     if (magnitude < vMin) vMin = magnitude;
     if (magnitude > vMax) vMax = magnitude;
     int drawFilteredState;
-    if (filteredstate == HIGH)
+    if (decoder.filteredstate == HIGH)
       drawFilteredState = vMax + 1000;
     else
       drawFilteredState = vMin - 1000;
-    Serial.println(String(magnitude) + " " + String(drawFilteredState) + " " + String(magnitudelimit));
+    if (binOut)
+    {
+      FrameMag f = { (uint32_t) millis(), (int32_t) magnitude, (int32_t) decoder.magnitudelimit,
+                     (uint8_t) (((decoder.filteredstate == HIGH) ? FRAME_HIGH : 0) | ((decoder.realstate == HIGH) ? FRAME_REAL : 0)) };
+      frameTx.send(FRAME_MAG, &f, sizeof(f));
+    }
+    else
+    {
+      TextBuf<48> line;
+      line.add(magnitude, 2).add(' ').add(drawFilteredState).add(' ').add(decoder.magnitudelimit).add("\r\n");
+      frameTx.write(line.c_str(), line.length());
+    }
   }
 
   if (!bScan)
   {
+    PROF_SCOPE(PROF_TFT);
     // Update display
     // Decoded CW  
-    int posRow = 60 + (iRow * 20);
-    tft.fillRect(394, posRow, 72, 20, TFT_BLACK); // Clear CodeBuffer
-    tft.setTextColor(TFT_CYAN, TFT_BLACK);
-    tftDrawString(0, posRow, DisplayLine, display); // Affiche aussi CodeBuffer (qui suit DisplayLine en mémmoire et contient le \0)
+    displayLine.clearCode();
+    displayLine.draw(TFT_CYAN, decoder.CodeBuffer);
     tft.setTextColor(TFT_WHITE, TFT_BLACK);
     
     // WPM
-    if (abs(sWpm - wpm) >= 5)
+    if (abs(sWpm - decoder.wpm) >= 5)
     {
-      sWpm = wpm;
+      sWpm = decoder.wpm;
       tft.fillRect(302, 20, 24, 20, TFT_BLACK);
-      tftDrawString(302, 20, String(wpm));
+      tftDrawString(302, 20, String(decoder.wpm));
     }
   }
 
@@ -1043,7 +1460,7 @@ Acq:
   if (barGraph > silent) 
   {
     // Sound detected
-    startLowSound = 0;
+    decoder.timers.cancel(lowSoundTimer);
     silentDuringSound = false;
     stopScan();
     bMoy = ( ( (bMoy * cptMoy) + barGraph ) / (cptMoy + 1) );
@@ -1062,20 +1479,16 @@ Acq:
     // Silence
     if (moyComputed)
       silentDuringSound = true;
-    if (startLowSound == 0)
-      startLowSound = millis();
-    else if ((millis() - startLowSound) > 10000) // 10s with low sound
-    {
-      startLowSound = 0;
-      silentDuringSound = false;
-      moyComputed = false;
-    }
+    if (!lowSoundTimer.pending())
+      decoder.timers.schedule(lowSoundTimer, millis() + 10001);
   }
   
   if (trace)
   {
     // Affichage valeurs barGraph et bMoy
-    tftDrawString(0, 260, "bMoy=" + String(bMoy) + "    barG=" + String(barGraph) + "   ");
+    TextBuf<48> text;
+    text.add("bMoy=").add(bMoy, 2).add("    barG=").add(barGraph).add(" Alloc/s=").add((long) heapPerSec).add("   ");
+    tftDrawString(0, 260, text.c_str());
   }
 
   if (moyChanged || bScan)
@@ -1137,18 +1550,16 @@ Acq:
       // Very weak signal heard : Try to find better frequency tune
       if (autoTune)
       {
-        if (startLowSignal == 0)
-          startLowSignal = millis();
-        else if ((millis() - startLowSignal) > 5000) // 5s without audible signal
+        if (!lowSignalTimeout && !lowSignalTimer.pending())
+          decoder.timers.schedule(lowSignalTimer, millis() + 5001);
+        else if (lowSignalTimeout)
         {
           bScan = true;
           setVolume(POTMIDVALUE); // Middle value
           cptMoy = 0;
           moyComputed = false;
-          starttimehigh = 0;
-          starttimelow = 0;
-          lowduration = 0;         
-          highduration = 0;         
+          decoder.resetTiming();
+          capture.event(CAP_RESET);
 
           // Search for a better iFreq
           iFreq += sensFreq;
@@ -1161,23 +1572,44 @@ Acq:
           if (iFreq == 0)
             sensFreq = 1;
           setFreq(iFreq);
+          eventTrace.add(millis(), EV_TUNE, EV_TUNE_SCAN, 0, freqs[iFreq] * 10);
         }
       }
     }
   }
 
-  // the end of main loop clean up//
-  realstatebefore     = realstate;
-  lasthighduration    = highduration;
-  filteredstatebefore = filteredstate;
-
   if (cptLoop == 1)
   {
     int loopTime = millis() - tStartLoop;
     tftDrawString(176, 280, String(loopTime) + " ", true);  
   }
 
-  manageRotaryButton();
+  {
+    PROF_SCOPE(PROF_ROTARY);
+    manageRotaryButton();
+  }
+  readCommands();
+  saveParams();
+  if (warmDue)
+    updateWarm();
+
+  if (secondDue)
+  {
+    secondDue = false;
+    heapPerSec = heapAllocs - heapLast;
+    heapLast = heapAllocs;
+    acqMon.window();
+    acqMon.maxGap = AcqMonitor::gapForWpm(decoder.wpm);
+    showDuty();
+    decoder.timers.schedule(secondTimer, millis() + 1000);
+  }
+  if (binOut && statusDue)
+  {
+    statusDue = false;
+    sendStatus();
+    decoder.timers.schedule(statusTimer, millis() + 1000);
+  }
+  drainFrames();
 
  // EndOfLoop
 }
\ No newline at end of file
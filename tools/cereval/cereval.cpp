@@ -0,0 +1,189 @@
+/*
+ F4LAA : Évaluation du décodeur (CER / WER) sur les fichiers WAV de référence, avec balayage des paramètres
+
+   Usage : cereval [dir] [-j threads] [-top n] [-n list] [-r list] [-b list] [-s list] [-f list] [-m list]
+     dir   : répertoire des WAV (test/ par défaut), chacun avec sa transcription de référence <nom>.txt
+             (première ligne "# freq 640" facultative, sinon la fréquence du signal est cherchée sur le spectre)
+     -n nbTime, -r magReactivity, -b spaceDetector, -s nbSamples (0 : suit le WPM comme loop()),
+     -f écart de fréquence en Hz, -m modèle de temps : listes séparées par des virgules, chaque combinaison est évaluée
+   Affiche le classement des combinaisons (CER total pondéré par la longueur des références, WER, CER par fichier)
+   et la vitesse de décodage en facteur temps réel (secondes d'audio par seconde de calcul, par thread).
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Cer.h"
+#include "Corpus.h"
+#include "HostDecoder.h"
+
+struct Setting
+{
+  int nbTime, magReactivity, spaceDetector, nbSamples;
+  float freqOffset;
+  int model;
+};
+
+struct Score
+{
+  Setting s;
+  double cer = 0, wer = 0;     // Weighted by the reference lengths
+  std::vector<double> cers;    // Per file
+  double seconds = 0;          // Decode time
+};
+
+static std::vector<int> parseList(const char *s)
+{
+  std::vector<int> v;
+  for (const char *p = s; *p; )
+  {
+    v.push_back(atoi(p));
+    p = strchr(p, ',');
+    if (!p)
+      break;
+    p++;
+  }
+  return v;
+}
+
+static std::string label(const Setting &s)
+{
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%2d %2d %2d %4s %+4.0f %s", s.nbTime, s.magReactivity, s.spaceDetector,
+           s.nbSamples ? std::to_string(s.nbSamples).c_str() : "wpm", s.freqOffset,
+           (s.model == TIMING_ADAPTIVE) ? "adapt" : "g6ejd");
+  return buf;
+}
+
+int main(int argc, char **argv)
+{
+  std::string dir = "test";
+  int nbThreads = std::thread::hardware_concurrency();
+  size_t top = 20;
+  HostDecoderParams def;
+  std::vector<int> nbTimes = { 2, 4, 6, 8 }, reactivities = { 2, 4, 6, 8 }, detectors = { 3, 5, 7 };
+  std::vector<int> samples = { 0, 60, 100, 140 }, offsets = { -10, 0, 10 };
+  std::vector<int> models = { def.model };
+  for (int i = 1; i < argc; i++)
+  {
+    if ((argv[i][0] != '-') || (i + 1 >= argc))
+      dir = argv[i];
+    else
+    {
+      const char *v = argv[++i];
+      if (!strcmp(argv[i - 1], "-j")) nbThreads = atoi(v);
+      else if (!strcmp(argv[i - 1], "-top")) top = atoi(v);
+      else if (!strcmp(argv[i - 1], "-n")) nbTimes = parseList(v);
+      else if (!strcmp(argv[i - 1], "-r")) reactivities = parseList(v);
+      else if (!strcmp(argv[i - 1], "-b")) detectors = parseList(v);
+      else if (!strcmp(argv[i - 1], "-s")) samples = parseList(v);
+      else if (!strcmp(argv[i - 1], "-f")) offsets = parseList(v);
+      else if (!strcmp(argv[i - 1], "-m")) models = parseList(v);
+    }
+  }
+  if (nbThreads < 1)
+    nbThreads = 1;
+
+  // WAV files with a reference
+  std::vector<std::string> skipped;
+  std::vector<RefFile> files = loadCorpus(dir, &skipped);
+  double audioSeconds = 0;
+  size_t refChars = 0;
+  for (const RefFile &r : files)
+  {
+    audioSeconds += r.seconds();
+    refChars += r.reference.size();
+    printf("%s : %.1f s, %.1f Hz, %zu characters\n", r.name.c_str(), r.seconds(), r.freq, r.reference.size());
+  }
+  if (files.empty())
+  {
+    fprintf(stderr, "No WAV file with a reference in %s\n", dir.c_str());
+    return 1;
+  }
+
+  std::vector<Score> scores;
+  for (int m : models)
+    for (int n : nbTimes)
+      for (int r : reactivities)
+        for (int b : detectors)
+          for (int s : samples)
+            for (int o : offsets)
+            {
+              Score sc;
+              sc.s = { n, r, b, s, (float) o, m };
+              scores.push_back(sc);
+            }
+
+  // Each setting on every file, settings spread across the threads
+  std::atomic<size_t> next(0);
+  auto t0 = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (int t = 0; t < nbThreads; t++)
+    threads.emplace_back([&]() {
+      for (size_t i = next++; i < scores.size(); i = next++)
+      {
+        Score &sc = scores[i];
+        auto t1 = std::chrono::steady_clock::now();
+        for (const RefFile &f : files)
+        {
+          HostDecoderParams hp;
+          hp.freq = f.freq + sc.s.freqOffset;
+          hp.model = sc.s.model;
+          hp.nbTime = sc.s.nbTime;
+          hp.magReactivity = sc.s.magReactivity;
+          hp.spaceDetector = sc.s.spaceDetector;
+          if (sc.s.nbSamples)
+          {
+            hp.nbSamples = sc.s.nbSamples;
+            hp.adaptNbSamples = false;
+          }
+          HostDecoder hd(hp);
+          std::string decoded = hd.decode(f.wav.samples, f.wav.rate);
+          double c = cer(f.reference, decoded);
+          sc.cers.push_back(c);
+          sc.cer += c * f.reference.size() / refChars;
+          sc.wer += wer(f.reference, decoded) * f.reference.size() / refChars;
+        }
+        sc.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t1).count();
+      }
+    });
+  for (std::thread &t : threads)
+    t.join();
+  double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+  std::stable_sort(scores.begin(), scores.end(), [](const Score &a, const Score &b) {
+    return (a.cer < b.cer) || ((a.cer == b.cer) && (a.wer < b.wer));
+  });
+  printf("\nrank nbTime magReact spaceDet nbSamples freq model    CER    WER ");
+  for (size_t k = 0; k < files.size(); k++)
+    printf(" file%-2zu", k + 1);
+  printf("\n");
+  double decodeSeconds = 0;
+  for (const Score &sc : scores)
+    decodeSeconds += sc.seconds;
+  for (size_t i = 0; i < scores.size(); i++)
+  {
+    const Setting &s = scores[i].s;
+    bool isDefault = (s.nbTime == def.nbTime) && (s.magReactivity == def.magReactivity) && (s.spaceDetector == def.spaceDetector)
+                     && (s.nbSamples == 0) && (s.freqOffset == 0) && (s.model == def.model);
+    if ((i >= top) && !isDefault)
+      continue;
+    printf("%4zu %s %5.1f%% %5.1f%%", i + 1, label(s).c_str(), 100 * scores[i].cer, 100 * scores[i].wer);
+    for (double c : scores[i].cers)
+      printf(" %5.1f%%", 100 * c);
+    printf("%s\n", isDefault ? "  <== defaults" : "");
+  }
+  for (size_t k = 0; k < files.size(); k++)
+    printf("file%zu : %s\n", k + 1, files[k].name.c_str());
+  for (const std::string &name : skipped)
+    printf("NOT EVALUATED : %s (no reference transcript or unreadable)\n", name.c_str());
+  printf("%zu settings x %.1f s of audio in %.1f s (%d threads) : realtime x%.0f per thread, x%.0f total\n",
+         scores.size(), audioSeconds, wall, nbThreads, scores.size() * audioSeconds / decodeSeconds,
+         scores.size() * audioSeconds / wall);
+  return 0;
+}
@@ -0,0 +1,165 @@
+/*
+ F4LAA : Audio brut de l'ADC du décodeur (commande 'L', trames FRAME_AUDIO) ==> fichier WAV
+
+   Usage : cwaudio /dev/ttyUSB0 out.wav [-b baud] [-r record.bin] [-g gain]   Ctrl-C pour finir
+           cwaudio record.bin out.wav [-g gain]
+   Les blocs sont mis bout à bout, à la vitesse de l'ADC (sampling_freq) : c'est ce que le décodeur a vu
+   (le temps entre 2 blocs n'est pas échantillonné, le taux d'acquisition est affiché).
+   Une trame perdue (numéro manquant) est remplacée par du silence de la longueur de la trame précédente.
+   -g : ADC - midpoint ==> WAV, 2048 par défaut (pleine échelle) ; 1500 redonne dans tools/host/HostDecoder.h
+        les valeurs de l'ADC (adcGain), les pointes au-delà sont écrêtées.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <vector>
+#include "Wav.h"
+#include "SerialPort.h"
+#include "SerialFrame.h"
+#include "Adpcm.h"
+
+static volatile bool stop = false;
+static void onSignal(int) { stop = true; }
+
+int main(int argc, char **argv)
+{
+  const char *source = 0;
+  const char *wavName = 0;
+  const char *record = 0;
+  int baud = 115200;
+  float gain = 2048;
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-b") && (i + 1 < argc))
+      baud = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-r") && (i + 1 < argc))
+      record = argv[++i];
+    else if (!strcmp(argv[i], "-g") && (i + 1 < argc))
+      gain = atof(argv[++i]);
+    else if (!source)
+      source = argv[i];
+    else
+      wavName = argv[i];
+  }
+  if (!source || !wavName)
+  {
+    fprintf(stderr, "Usage : cwaudio /dev/ttyUSB0 out.wav [-b baud] [-r record.bin] [-g gain]\n"
+                    "        cwaudio record.bin out.wav [-g gain]\n");
+    return 1;
+  }
+  if (serialIsPort(source) && !serialBaud(baud))
+  {
+    fprintf(stderr, "%d : unsupported baud rate\n", baud);
+    return 1;
+  }
+  int fd = serialOpen(source, baud);
+  if (fd < 0)
+  {
+    perror(source);
+    return 1;
+  }
+  FILE *rec = record ? fopen(record, "wb") : 0;
+  if (record && !rec)
+  {
+    perror(record);
+    return 1;
+  }
+  signal(SIGINT, onSignal);
+
+  FrameRx rx;
+  std::vector<float> samples;
+  int16_t pcm[AUDIO_MAXSAMPLES];
+  int rate = 0;
+  uint16_t nextSeq = 0;
+  int lastLen = 0;
+  long nbFrames = 0, nbLost = 0, nbBadSize = 0;
+  uint32_t firstMs = 0, lastMs = 0;
+  uint32_t dropped = 0;
+
+  uint8_t buf[4096];
+  ssize_t n;
+  while (!stop && ((n = read(fd, buf, sizeof(buf))) > 0))
+  {
+    if (rec)
+      fwrite(buf, 1, n, rec);
+    for (ssize_t i = 0; i < n; i++)
+    {
+      if (!rx.push(buf[i]))
+        continue;
+      if (rx.type == FRAME_STATUS)
+      {
+        FrameStatus s;
+        if (rx.len == sizeof(s))
+        {
+          memcpy(&s, rx.payload, sizeof(s));
+          dropped = s.dropped;
+        }
+        continue;
+      }
+      if (rx.type != FRAME_AUDIO)
+        continue;
+      FrameAudio h;
+      memcpy(&h, rx.payload, (rx.len < sizeof(h)) ? rx.len : sizeof(h));
+      if ((rx.len < sizeof(h)) || (rx.len != sizeof(h) + (h.nbSamples + 1) / 2) || (h.nbSamples > AUDIO_MAXSAMPLES))
+      {
+        nbBadSize++;
+        continue;
+      }
+      if (!rate)
+      {
+        rate = h.rate;
+        firstMs = h.ms;
+      }
+      else
+      {
+        if (h.rate != rate)
+          fprintf(stderr, "Frame %u : ADC rate %u Hz instead of %d Hz\n", h.seq, h.rate, rate);
+        // Lost frames : silence, so that the following ones keep their place in time
+        uint16_t gap = h.seq - nextSeq;
+        if (gap && (gap < 0x8000))
+        {
+          nbLost += gap;
+          fprintf(stderr, "%u frames lost before frame %u (%.3f s)\n", gap, h.seq, samples.size() / (float) rate);
+          samples.insert(samples.end(), (size_t) gap * lastLen, 0.0f);
+        }
+      }
+      nextSeq = h.seq + 1;
+      lastLen = h.nbSamples;
+      lastMs = h.ms;
+      nbFrames++;
+
+      AdpcmState state;
+      state.predictor = h.predictor;
+      state.index = (h.index > 88) ? 88 : h.index;
+      adpcmDecode(state, rx.payload + sizeof(h), h.nbSamples, pcm);
+      for (int k = 0; k < h.nbSamples; k++)
+      {
+        float v = pcm[k] / 16.0f / gain;
+        samples.push_back((v > 1) ? 1 : ((v < -1) ? -1 : v));
+      }
+    }
+  }
+  close(fd);
+  if (rec)
+    fclose(rec);
+
+  if (!rate)
+  {
+    fprintf(stderr, "%s : no audio frame (%u frames, %u CRC errors)\n", source, rx.frames, rx.crcErrors);
+    return 1;
+  }
+  if (!writeWav(wavName, samples, rate))
+  {
+    perror(wavName);
+    return 1;
+  }
+  float seconds = samples.size() / (float) rate;
+  float wall = (lastMs - firstMs) / 1000.0f;
+  printf("%s : %zu samples at %d Hz, %.1f s", wavName, samples.size(), rate, seconds);
+  if (wall > 0)
+    printf(" (%.0f%% of %.1f s sampled)", 100 * seconds / wall, wall);
+  printf("\n%ld audio frames, %ld lost, %ld size errors, %u CRC errors, %u bytes skipped, %u frames dropped by the firmware\n",
+         nbFrames, nbLost, nbBadSize, rx.crcErrors, rx.skipped, dropped);
+  return 0;
+}
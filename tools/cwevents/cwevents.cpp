@@ -0,0 +1,296 @@
+/*
+ F4LAA : Journal d'événements de l'étage de décision (EventTrace), en texte ou en ligne de temps SVG
+
+   Usage : cwevents events.bin [-svg out.svg] [-from ms] [-to ms] [-s px/ms]
+           cwevents -w file.wav [-f freq] [...]       journal d'un fichier WAV (chaîne de loop() sur PC)
+   Le journal est le dump binaire de la commande 'J', seul ou au milieu d'un log série (après "EVENTS;").
+   Sans -svg, un événement par ligne. La ligne de temps a une piste par signal : état avant et après
+   le noise blanker, seuil (magnitudelimit), hightimesavg, éléments et caractères ; les pas de
+   l'autotune / AFC et les resetTiming() sont des traits verticaux.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "Wav.h"
+#include "HostDecoder.h"
+#include "EventTrace.h"
+
+static std::vector<TraceEvent> events;
+static EventTraceHeader header;
+
+static bool parse(const std::vector<char> &data, const char *name)
+{
+  // Raw dump, or the dump in a serial log
+  size_t pos = 0;
+  if ((data.size() < 4) || memcmp(data.data(), "CWEV", 4))
+  {
+    std::string s(data.begin(), data.end());
+    size_t p = s.rfind("EVENTS;");
+    if (p == std::string::npos)
+      return false;
+    pos = s.find('\n', p);
+    if (pos == std::string::npos)
+      return false;
+    pos++;
+  }
+  if (data.size() < pos + sizeof(EventTraceHeader))
+    return false;
+  memcpy(&header, &data[pos], sizeof(EventTraceHeader));
+  if (memcmp(header.magic, "CWEV", 4) || (header.version != EVT_VERSION) || (header.eventSize != sizeof(TraceEvent)))
+  {
+    fprintf(stderr, "%s : not an event trace version %d\n", name, EVT_VERSION);
+    return false;
+  }
+  pos += sizeof(EventTraceHeader);
+  size_t nb = (data.size() - pos) / sizeof(TraceEvent);
+  if (nb < header.nbEvents)
+    fprintf(stderr, "%s : %u events, %zu read (truncated)\n", name, header.nbEvents, nb);
+  else
+    nb = header.nbEvents;
+  events.resize(nb);
+  memcpy(events.data(), &data[pos], nb * sizeof(TraceEvent));
+  return true;
+}
+
+static bool readEvents(const char *fileName)
+{
+  FILE *f = fopen(fileName, "rb");
+  if (!f)
+    return false;
+  std::vector<char> data;
+  char buf[65536];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+    data.insert(data.end(), buf, buf + n);
+  fclose(f);
+  return parse(data, fileName);
+}
+
+static EventTrace eventTrace; // Of the decoder of -w
+static std::vector<char> dumped;
+static void writeMem(const void *data, int len)
+{
+  dumped.insert(dumped.end(), (const char *) data, (const char *) data + len);
+}
+
+static bool traceWav(const char *wavName, float freq)
+{
+  Wav wav;
+  if (!readWav(wavName, wav))
+  {
+    fprintf(stderr, "Can't read %s\n", wavName);
+    return false;
+  }
+  HostDecoderParams hp;
+  hp.freq = freq;
+  HostDecoder hd(hp);
+  hd.events = &eventTrace;
+  eventTrace.clear();
+  printf("%s\n", hd.decode(wav.samples, wav.rate).c_str());
+  eventTrace.dump(writeMem);
+  return parse(dumped, wavName);
+}
+
+static std::string code(const TraceEvent &e)
+{
+  std::string s;
+  for (int i = e.b - 1; i >= 0; i--)
+    s += ((e.value >> i) & 1) ? '-' : '.';
+  return s;
+}
+
+static void printEvent(const TraceEvent &e)
+{
+  printf("%8u ", e.t);
+  switch (e.type)
+  {
+    case EV_EDGE:      printf("edge      %s after %d ms\n", e.a ? "HIGH" : "LOW ", e.value); break;
+    case EV_REAL:      printf("real      %s\n", e.a ? "HIGH" : "LOW"); break;
+    case EV_HIGHAVG:   printf("highavg   %d ms (dot %d ms)\n", e.value, e.b); break;
+    case EV_THRESHOLD: printf("threshold %d\n", e.value); break;
+    case EV_ELEMENT:   printf("element   %c %d ms, margin %d %%\n", e.a, e.value, e.b); break;
+    case EV_CHAR:      printf("char      %c %s\n", (e.a == '{') ? '?' : e.a, code(e).c_str()); break;
+    case EV_TUNE:      printf("%s %.1f Hz\n", (e.a == EV_TUNE_AFC) ? "afc      " : "scan     ", e.value / 10.0); break;
+    case EV_RESET:     printf("reset\n"); break;
+    default:           printf("? type %d\n", e.type); break;
+  }
+}
+
+// SVG timeline : one lane per signal, x in ms
+#define LANE_H 40
+#define LANE_GAP 20
+#define LEFT 90
+
+enum { LANE_REAL, LANE_STATE, LANE_THRESHOLD, LANE_HIGHAVG, LANE_ELEMENTS, LANE_CHARS, NB_LANES };
+static const char *laneNames[NB_LANES] = { "real", "filtered", "threshold", "highavg", "elements", "chars" };
+
+static FILE *svg;
+static uint32_t t0, t1;
+static double scale;
+
+static double X(uint32_t t) { return LEFT + (double) ((t < t0) ? 0 : (t > t1) ? t1 - t0 : t - t0) * scale; }
+static double laneTop(int lane) { return LANE_GAP + lane * (LANE_H + LANE_GAP); }
+static double laneY(int lane, double v) { return laneTop(lane) + LANE_H * (1 - v); } // v in [0..1]
+
+static const char *esc(char c)
+{
+  static char s[2];
+  switch (c)
+  {
+    case '<': return "&lt;";
+    case '>': return "&gt;";
+    case '&': return "&amp;";
+    case '{': return "?";
+  }
+  s[0] = c;
+  s[1] = 0;
+  return s;
+}
+
+// Step curve of the events of a type, value ==> [0..1] by norm
+template <class V>
+static void step(int lane, int type, const char *color, V value)
+{
+  std::string path;
+  char buf[64];
+  bool first = true;
+  for (const TraceEvent &e : events)
+  {
+    if (e.type != type)
+      continue;
+    double v = value(e);
+    if (first)
+      snprintf(buf, sizeof(buf), "M%.1f %.1f", X(t0), laneY(lane, v));
+    else
+      snprintf(buf, sizeof(buf), " H%.1f V%.1f", X(e.t), laneY(lane, v));
+    path += buf;
+    first = false;
+  }
+  if (first)
+    return;
+  snprintf(buf, sizeof(buf), " H%.1f", X(t1));
+  path += buf;
+  fprintf(svg, "<path d=\"%s\" fill=\"none\" stroke=\"%s\"/>\n", path.c_str(), color);
+}
+
+static int writeSvg(const char *name, double pxPerMs)
+{
+  svg = fopen(name, "w");
+  if (!svg)
+  {
+    fprintf(stderr, "Can't write %s\n", name);
+    return 1;
+  }
+  scale = pxPerMs;
+  int32_t maxThreshold = 1, maxHighAvg = 1;
+  for (const TraceEvent &e : events)
+  {
+    if ((e.type == EV_THRESHOLD) && (e.value > maxThreshold))
+      maxThreshold = e.value;
+    if ((e.type == EV_HIGHAVG) && (e.value > maxHighAvg))
+      maxHighAvg = e.value;
+  }
+  double width = X(t1) + 20;
+  double height = laneTop(NB_LANES) + 20;
+  fprintf(svg, "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%.0f\" height=\"%.0f\" font-family=\"monospace\" font-size=\"11\">\n",
+          width, height);
+  fprintf(svg, "<rect width=\"100%%\" height=\"100%%\" fill=\"white\"/>\n");
+
+  // Lanes and time axis (1 tick / 100 ms, label / s)
+  for (int l = 0; l < NB_LANES; l++)
+  {
+    fprintf(svg, "<text x=\"4\" y=\"%.0f\">%s</text>\n", laneTop(l) + LANE_H / 2 + 4, laneNames[l]);
+    fprintf(svg, "<line x1=\"%d\" y1=\"%.0f\" x2=\"%.0f\" y2=\"%.0f\" stroke=\"#ddd\"/>\n", LEFT, laneTop(l) + LANE_H,
+            X(t1), laneTop(l) + LANE_H);
+  }
+  double axis = laneTop(NB_LANES) - LANE_GAP / 2;
+  for (uint32_t t = (t0 + 99) / 100 * 100; t <= t1; t += 100)
+  {
+    bool second = (t % 1000) == 0;
+    fprintf(svg, "<line x1=\"%.1f\" y1=\"%.0f\" x2=\"%.1f\" y2=\"%.0f\" stroke=\"#999\"/>\n", X(t), axis,
+            X(t), axis + (second ? 8 : 4));
+    if (second)
+      fprintf(svg, "<text x=\"%.1f\" y=\"%.0f\">%u s</text>\n", X(t) + 2, axis + 18, t / 1000);
+  }
+
+  step(LANE_REAL, EV_REAL, "#888", [](const TraceEvent &e) { return e.a ? 0.9 : 0.1; });
+  step(LANE_STATE, EV_EDGE, "black", [](const TraceEvent &e) { return e.a ? 0.9 : 0.1; });
+  step(LANE_THRESHOLD, EV_THRESHOLD, "red", [&](const TraceEvent &e) { return (double) e.value / maxThreshold; });
+  step(LANE_HIGHAVG, EV_HIGHAVG, "blue", [&](const TraceEvent &e) { return (double) e.value / maxHighAvg; });
+  fprintf(svg, "<text x=\"%d\" y=\"%.0f\" fill=\"red\">max %d</text>\n", LEFT, laneTop(LANE_THRESHOLD) - 2, maxThreshold);
+  fprintf(svg, "<text x=\"%d\" y=\"%.0f\" fill=\"blue\">max %d ms</text>\n", LEFT, laneTop(LANE_HIGHAVG) - 2, maxHighAvg);
+
+  for (const TraceEvent &e : events)
+  {
+    if ((e.t < t0) || (e.t > t1))
+      continue;
+    switch (e.type)
+    {
+      case EV_ELEMENT:
+        // The element ends at e.t
+        fprintf(svg, "<rect x=\"%.1f\" y=\"%.0f\" width=\"%.1f\" height=\"%d\" fill=\"%s\"><title>%c %d ms %d %%</title></rect>\n",
+                X(e.t - e.value), laneTop(LANE_ELEMENTS) + 10, e.value * scale, LANE_H - 20,
+                (e.b < 20) ? "orange" : "green", e.a, e.value, e.b);
+        break;
+      case EV_CHAR:
+        fprintf(svg, "<text x=\"%.1f\" y=\"%.0f\" font-size=\"16\"><title>%s</title>%s</text>\n", X(e.t),
+                laneTop(LANE_CHARS) + LANE_H / 2 + 6, code(e).c_str(), esc(e.a));
+        break;
+      case EV_TUNE:
+        fprintf(svg, "<line x1=\"%.1f\" y1=\"%d\" x2=\"%.1f\" y2=\"%.0f\" stroke=\"purple\" stroke-dasharray=\"2,2\"/>\n",
+                X(e.t), LANE_GAP, X(e.t), laneTop(NB_LANES));
+        fprintf(svg, "<text x=\"%.1f\" y=\"%d\" fill=\"purple\">%s %.1f</text>\n", X(e.t) + 2, LANE_GAP - 4,
+                (e.a == EV_TUNE_AFC) ? "afc" : "scan", e.value / 10.0);
+        break;
+      case EV_RESET:
+        fprintf(svg, "<line x1=\"%.1f\" y1=\"%d\" x2=\"%.1f\" y2=\"%.0f\" stroke=\"gray\" stroke-dasharray=\"6,3\"/>\n",
+                X(e.t), LANE_GAP, X(e.t), laneTop(NB_LANES));
+        break;
+    }
+  }
+  fprintf(svg, "</svg>\n");
+  fclose(svg);
+  printf("%.0f x %.0f px ==> %s\n", width, height, name);
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  const char *wavName = 0, *svgName = 0;
+  const char *fileName = 0;
+  float freq = 640;
+  long from = -1, to = -1;
+  double pxPerMs = 0.5;
+  for (int i = 1; i < argc; i++)
+  {
+    bool arg = i + 1 < argc;
+    if (!strcmp(argv[i], "-w") && arg) wavName = argv[++i];
+    else if (!strcmp(argv[i], "-f") && arg) freq = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-svg") && arg) svgName = argv[++i];
+    else if (!strcmp(argv[i], "-from") && arg) from = atol(argv[++i]);
+    else if (!strcmp(argv[i], "-to") && arg) to = atol(argv[++i]);
+    else if (!strcmp(argv[i], "-s") && arg) pxPerMs = atof(argv[++i]);
+    else fileName = argv[i];
+  }
+  bool ok = wavName ? traceWav(wavName, freq) : (fileName && readEvents(fileName));
+  if (!ok)
+  {
+    fprintf(stderr, "Usage : cwevents events.bin [-svg out.svg] [-from ms] [-to ms] [-s px/ms]\n"
+                    "        cwevents -w file.wav [-f freq] [-svg out.svg] [-from ms] [-to ms] [-s px/ms]\n");
+    return 1;
+  }
+  printf("%zu events (%u since boot)\n", events.size(), header.nbTotal);
+  if (events.empty())
+    return 0;
+
+  t0 = (from >= 0) ? from : events.front().t;
+  t1 = (to >= 0) ? to : events.back().t;
+  if (svgName)
+    return writeSvg(svgName, pxPerMs);
+  for (const TraceEvent &e : events)
+    if ((e.t >= t0) && (e.t <= t1))
+      printEvent(e);
+  return 0;
+}
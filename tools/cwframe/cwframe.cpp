@@ -0,0 +1,211 @@
+/*
+ F4LAA : Lecture des trames binaires du décodeur (commande 'U', SerialFrame) : décodeur de référence pour CWDecoder-UI
+
+   Usage : cwframe /dev/ttyUSB0 [-b baud] [-r record.bin] [-q]   port série (115200 par défaut), Ctrl-C pour finir
+           cwframe record.bin [-q]                                 flux enregistré
+           cwframe -t [nbFrames] [errorRate]                       boucle FrameTx -> octets corrompus -> FrameRx
+   -r : les octets reçus sont enregistrés tels quels (rejouables ensuite)
+   -q : seulement le texte décodé et les compteurs, pas le détail des trames
+   A la fin : trames reçues, erreurs de CRC, octets hors trames, trames perdues par le firmware (anneau plein).
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <random>
+#include <vector>
+#include "SerialPort.h"
+#include "SerialFrame.h"
+
+static volatile bool stop = false;
+static void onSignal(int) { stop = true; }
+
+static FrameRx rx;
+static bool quiet = false;
+static uint32_t dropped = 0;     // Last FrameStatus.dropped
+static uint32_t sizeErrors = 0;  // Valid CRC, unexpected len for the type
+
+template <class T> static bool payloadIs(T &f)
+{
+  if (rx.len != sizeof(T))
+  {
+    sizeErrors++;
+    return false;
+  }
+  memcpy(&f, rx.payload, sizeof(T));
+  return true;
+}
+
+static void printFrame()
+{
+  switch (rx.type)
+  {
+    case FRAME_CHAR:
+    {
+      FrameChar f;
+      if (!payloadIs(f))
+        break;
+      if (quiet)
+        putchar(f.c);
+      else
+        printf("%10u CHAR   '%c' %3u%%\n", f.ms, f.c, f.confidence);
+      break;
+    }
+    case FRAME_TIMES:
+    {
+      FrameTimes f;
+      if (!payloadIs(f) || quiet)
+        break;
+      printf("           TIMES  '%c'", f.c);
+      for (int i = 0; i < MAXTIMES; i++)
+        printf(" %d", f.times[i]);
+      printf("\n");
+      break;
+    }
+    case FRAME_MAG:
+    {
+      FrameMag f;
+      if (!payloadIs(f) || quiet)
+        break;
+      printf("%10u MAG    %8d %8d %s%s\n", f.ms, f.magnitude, f.threshold,
+             (f.state & FRAME_HIGH) ? "H" : "L", (f.state & FRAME_REAL) ? "h" : "l");
+      break;
+    }
+    case FRAME_STATUS:
+    {
+      FrameStatus f;
+      if (!payloadIs(f))
+        break;
+      dropped = f.dropped;
+      if (!quiet)
+        printf("%10u STATUS %.1f Hz, ADC %.0f Hz, nbSamples %u, %u WPM,%s%s%s%s%s%s dropped %u, %u allocs/s, %.1f%% sampled, gap max %.1f ms, %u overruns\n", f.ms, f.freq,
+               f.samplingFreq, f.nbSamples, f.wpm, (f.flags & STATUS_ADAPTIVE) ? " adaptive" : " g6ejd",
+               (f.flags & STATUS_AFC) ? " afc" : "", (f.flags & STATUS_SCAN) ? " scan" : "",
+               (f.flags & STATUS_NET) ? " net" : "", (f.flags & STATUS_TREE) ? " tree" : "",
+               (f.flags & STATUS_DICT) ? " dict" : "", f.dropped, f.allocs, f.dutyPermil / 10.0, f.gapMax / 1000.0,
+               f.overruns);
+      break;
+    }
+    case FRAME_SPOT:
+      printf(quiet ? "\nSPOT;%s\n" : "           SPOT   %s\n", (const char *) rx.payload);
+      break;
+    case FRAME_TEXT:
+      printf(quiet ? "\n%s\n" : "           TEXT   %s\n", (const char *) rx.payload);
+      break;
+    default:
+      if (!quiet)
+        printf("           type %u, %u bytes\n", rx.type, rx.len);
+  }
+  fflush(stdout);
+}
+
+static void printCounters()
+{
+  fprintf(stderr, "\n%u frames, %u CRC errors, %u size errors, %u bytes skipped, %u frames dropped by the firmware\n",
+          rx.frames, rx.crcErrors, sizeErrors, rx.skipped, dropped);
+}
+
+// Frames through the ring, bytes randomly corrupted : every frame is received or detected
+static int selfTest(int nbFrames, double errorRate)
+{
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<double> u(0, 1);
+  FrameTx tx;
+  std::vector<uint8_t> link;
+  int nbSent = 0, nbOk = 0, nbBad = 0;
+  quiet = true;
+  for (int i = 0; i < nbFrames; i++)
+  {
+    FrameChar f = { (uint32_t) i, (char) ('a' + i % 26), (uint8_t) (i % 101) };
+    if (tx.send(FRAME_CHAR, &f, sizeof(f)))
+      nbSent++;
+    // Drained by small chunks, as with Serial.availableForWrite()
+    const uint8_t *data;
+    int n;
+    while ((n = tx.contiguous(&data)) > 0)
+    {
+      n = (n > 13) ? 13 : n;
+      for (int k = 0; k < n; k++)
+        link.push_back((u(rng) < errorRate) ? data[k] ^ (1 << (rng() % 8)) : data[k]);
+      tx.consume(n);
+    }
+  }
+  int expected = 0;
+  for (uint8_t b : link)
+    if (rx.push(b))
+    {
+      FrameChar f;
+      if (payloadIs(f) && (f.ms >= (uint32_t) expected) && (f.c == (char) ('a' + f.ms % 26)))
+      {
+        nbOk++;
+        expected = f.ms + 1;
+      }
+      else
+        nbBad++;
+    }
+  printf("%d frames sent, %d received, %d wrong (undetected errors), %u CRC errors, %u bytes skipped\n",
+         nbSent, nbOk, nbBad, rx.crcErrors, rx.skipped);
+  return nbBad ? 1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+  const char *source = 0;
+  const char *record = 0;
+  int baud = 115200;
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-t"))
+      return selfTest((i + 1 < argc) ? atoi(argv[i + 1]) : 100000, (i + 2 < argc) ? atof(argv[i + 2]) : 0.001);
+    else if (!strcmp(argv[i], "-b") && (i + 1 < argc))
+      baud = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-r") && (i + 1 < argc))
+      record = argv[++i];
+    else if (!strcmp(argv[i], "-q"))
+      quiet = true;
+    else
+      source = argv[i];
+  }
+  if (!source)
+  {
+    fprintf(stderr, "Usage : cwframe /dev/ttyUSB0 [-b baud] [-r record.bin] [-q]\n"
+                    "        cwframe record.bin [-q]\n"
+                    "        cwframe -t [nbFrames] [errorRate]\n");
+    return 1;
+  }
+
+  if (serialIsPort(source) && !serialBaud(baud))
+  {
+    fprintf(stderr, "%d : unsupported baud rate\n", baud);
+    return 1;
+  }
+  int fd = serialOpen(source, baud);
+  if (fd < 0)
+  {
+    perror(source);
+    return 1;
+  }
+  FILE *rec = record ? fopen(record, "wb") : 0;
+  if (record && !rec)
+  {
+    perror(record);
+    return 1;
+  }
+  signal(SIGINT, onSignal);
+
+  uint8_t buf[4096];
+  ssize_t n;
+  while (!stop && ((n = read(fd, buf, sizeof(buf))) > 0))
+  {
+    if (rec)
+      fwrite(buf, 1, n, rec);
+    for (ssize_t i = 0; i < n; i++)
+      if (rx.push(buf[i]))
+        printFrame();
+  }
+  close(fd);
+  if (rec)
+    fclose(rec);
+  printCounters();
+  return 0;
+}
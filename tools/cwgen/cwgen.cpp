@@ -0,0 +1,333 @@
+/*
+ F4LAA : Génération d'un jeu de données CW synthétique étiqueté (multithread)
+
+   Usage : cwgen outdir [-n files] [-d seconds] [-j threads] [-s seed] [-x words.txt] [-nowav]
+   Chaque fichier a ses propres conditions tirées au hasard (reproductibles par seed) :
+   WPM, Farnsworth, pondération, jitter, chirp, QSB, bruit blanc, parasites, QRM (un autre signal CW proche).
+   Le texte est équilibré : les caractères sont tirés d'un paquet mélangé (a-z 0-9 ? . , /),
+   ou les mots d'un fichier texte (-x).
+
+   Écrit dans outdir :
+     cw_NNNNN.wav / cw_NNNNN.txt  l'audio (8000 Hz) et sa transcription
+     dataSet.csv                  lignes printTimes (c;t0;...;t10) mesurées par le décodeur sur l'audio,
+                                  étiquetées par le texte envoyé (caractères alignés, même nombre d'éléments)
+     truth.csv                    les mêmes lignes avec les durées réellement envoyées
+     conditions.csv               les conditions de chaque fichier et le CER du décodeur
+     dataSet.cwds / truth.cwds    les mêmes lignes au format binaire en colonnes (DataSet.h, tools/dsconv)
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "CWSynth.h"
+#include "Cer.h"
+#include "DataSet.h"
+#include "HostDecoder.h"
+#include "Wav.h"
+
+#define GEN_RATE 8000
+#define GEN_CHARSET "abcdefghijklmnopqrstuvwxyz0123456789?.,/"
+
+struct Condition
+{
+  CWSynthParams sp;
+  float qrmOffset = 0; // Hz, 0 : no QRM
+  float qrmLevel = 0;  // Relative to the signal
+  float qrmWpm = 0;
+};
+
+struct Result
+{
+  std::string text;
+  std::string dataSet;
+  std::string truth;
+  std::string condition;
+  double seconds = 0;
+  double cer = 0;
+};
+
+static std::vector<std::string> words; // -x
+static std::string outDir;
+static double duration = 60;
+static bool writeWavs = true;
+
+static float between(CWNoise &r, float a, float b)
+{
+  return a + (b - a) * r.uniform();
+}
+
+static Condition drawCondition(CWNoise &r)
+{
+  Condition c;
+  CWSynthParams &p = c.sp;
+  p.rate = GEN_RATE;
+  p.freq = between(r, 500, 900);
+  p.wpm = between(r, 12, 35);
+  if (r.uniform() < 0.3)
+    p.farnsworthWpm = p.wpm * between(r, 0.4, 0.8);
+  p.dashRatio = between(r, 2.5, 4);
+  p.jitter = between(r, 0, 0.15);
+  p.amplitude = between(r, 0.2, 0.6);
+  p.noise = p.amplitude * between(r, 0, 0.6);
+  if (r.uniform() < 0.2)
+    p.chirp = between(r, -40, 40);
+  if (r.uniform() < 0.3)
+  {
+    p.qsbDepth = between(r, 0.3, 0.9);
+    p.qsbPeriod = between(r, 2000, 10000);
+  }
+  if (r.uniform() < 0.2)
+  {
+    p.impulseRate = between(r, 0.5, 5);
+    p.impulseAmplitude = p.amplitude * between(r, 1, 4);
+  }
+  if (r.uniform() < 0.3)
+  {
+    c.qrmOffset = between(r, 80, 300) * ((r.uniform() < 0.5) ? -1 : 1);
+    c.qrmLevel = between(r, 0.2, 1);
+    c.qrmWpm = between(r, 12, 35);
+  }
+  return c;
+}
+
+// Balanced text : each character once per shuffled deck, words of 1 to 6 characters
+static std::string drawText(CWNoise &r, const CWSynthParams &p)
+{
+  std::string text, deck;
+  size_t iDeck = 0;
+  for (;;)
+  {
+    std::string word;
+    if (!words.empty())
+      word = words[(size_t) (r.uniform() * words.size()) % words.size()];
+    else
+    {
+      int len = 1 + (int) (r.uniform() * 6);
+      for (int k = 0; k < len; k++)
+      {
+        if (iDeck == deck.size())
+        {
+          deck = GEN_CHARSET;
+          for (size_t i = deck.size() - 1; i > 0; i--)
+            std::swap(deck[i], deck[(size_t) (r.uniform() * (i + 1)) % (i + 1)]);
+          iDeck = 0;
+        }
+        word += deck[iDeck++];
+      }
+    }
+    text += (text.empty() ? "" : " ") + word;
+    if ((text.size() % 16) < word.size() + 1)
+    {
+      // Long enough ?
+      std::vector<float> t = cwTiming(text, p);
+      float ms = 2 * p.leadIn;
+      for (float d : t)
+        ms += d;
+      if (ms >= duration * 1000)
+        return text;
+    }
+  }
+}
+
+static void addRow(std::string &rows, char c, const int *times)
+{
+  rows += c;
+  for (int i = 0; i < MAXTIMES; i++)
+    rows += ";" + std::to_string(times[i]);
+  rows += "\n";
+}
+
+static Result generate(int index, uint32_t seed)
+{
+  CWNoise r;
+  r.seed = seed * 1000003 + index * 7919 + 1;
+  Condition c = drawCondition(r);
+  Result res;
+  res.text = drawText(r, c.sp);
+
+  std::vector<float> keying;
+  std::vector<float> audio = cwSynth(res.text, c.sp, r.seed, &keying);
+  if (c.qrmOffset != 0)
+  {
+    CWSynthParams q = c.sp;
+    q.freq += c.qrmOffset;
+    q.wpm = c.qrmWpm;
+    q.farnsworthWpm = 0;
+    q.amplitude *= c.qrmLevel;
+    q.noise = 0;
+    q.chirp = 0;
+    q.impulseRate = 0;
+    q.leadIn = between(r, 0, 2000);
+    std::vector<float> qrm = cwSynth(drawText(r, q), q, r.seed ^ 0xABCD);
+    for (size_t i = 0; (i < audio.size()) && (i < qrm.size()); i++)
+      audio[i] += qrm[i];
+  }
+  res.seconds = audio.size() / (double) GEN_RATE;
+
+  char name[32];
+  snprintf(name, sizeof(name), "cw_%05d", index);
+  if (writeWavs)
+  {
+    writeWav(outDir + "/" + name + ".wav", audio, GEN_RATE);
+    std::ofstream(outDir + "/" + name + ".txt") << res.text << "\n";
+  }
+
+  // Truth : the durations sent, character by character (marks and spaces between them)
+  size_t k = 0;
+  for (char ch : res.text)
+  {
+    const char *code = morseCode(ch);
+    if (!code)
+      continue;
+    int times[MAXTIMES] = { 0 };
+    int n = 2 * strlen(code) - 1;
+    for (int i = 0; (i < n) && (k + i < keying.size()); i++)
+      if (i < MAXTIMES)
+        times[i] = (int) (keying[k + i] + 0.5);
+    k += n + 1;
+    addRow(res.truth, ch, times);
+  }
+
+  // Measured : the characters decoded, labelled with the character sent when aligned on it
+  HostDecoderParams hp;
+  hp.freq = c.sp.freq;
+  HostDecoder hd(hp);
+  std::string decoded = hd.decode(audio, GEN_RATE);
+  res.cer = cer(res.text, decoded);
+  std::vector<int> match = align(std::vector<char>(res.text.begin(), res.text.end()),
+                                 std::vector<char>(decoded.begin(), decoded.end()));
+  for (size_t i = 0; i < res.text.size(); i++)
+  {
+    const char *code = morseCode(res.text[i]);
+    if (!code || (match[i] < 0))
+      continue;
+    const DecodedChar &d = hd.chars[match[i]];
+    if ((d.c != ' ') && (strlen(d.code) == strlen(code)))
+      addRow(res.dataSet, res.text[i], d.times);
+  }
+
+  char line[256];
+  snprintf(line, sizeof(line), "%s;%.1f;%.1f;%.1f;%.2f;%.3f;%.1f;%.2f;%.0f;%.3f;%.2f;%.0f;%.2f;%.1f;%.4f\n",
+           name, c.sp.freq, c.sp.wpm, c.sp.farnsworthWpm, c.sp.dashRatio, c.sp.jitter, c.sp.chirp,
+           c.sp.qsbDepth, c.sp.qsbPeriod, c.sp.noise / c.sp.amplitude, c.sp.impulseRate,
+           c.qrmOffset, c.qrmLevel, res.seconds, res.cer);
+  res.condition = line;
+  return res;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc < 2)
+  {
+    fprintf(stderr, "Usage : cwgen outdir [-n files] [-d seconds] [-j threads] [-s seed] [-x words.txt] [-nowav]\n");
+    return 1;
+  }
+  outDir = argv[1];
+  int nbFiles = 100;
+  int nbThreads = std::thread::hardware_concurrency();
+  uint32_t seed = 1;
+  for (int i = 2; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-nowav"))
+      writeWavs = false;
+    else if (i + 1 < argc)
+    {
+      if (!strcmp(argv[i], "-n")) nbFiles = atoi(argv[++i]);
+      else if (!strcmp(argv[i], "-d")) duration = atof(argv[++i]);
+      else if (!strcmp(argv[i], "-j")) nbThreads = atoi(argv[++i]);
+      else if (!strcmp(argv[i], "-s")) seed = atoi(argv[++i]);
+      else if (!strcmp(argv[i], "-x"))
+      {
+        std::ifstream f(argv[++i]);
+        std::string w;
+        while (f >> w)
+          words.push_back(normalizeText(w));
+      }
+    }
+  }
+  if (nbThreads < 1)
+    nbThreads = 1;
+  std::filesystem::create_directories(outDir);
+
+  // Each file only depends on (seed, index) : the same dataset with any number of threads
+  std::vector<Result> results(nbFiles);
+  std::atomic<int> next(0);
+  auto t0 = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (int t = 0; t < nbThreads; t++)
+    threads.emplace_back([&]() {
+      for (int i = next++; i < nbFiles; i = next++)
+        results[i] = generate(i, seed);
+    });
+  for (std::thread &t : threads)
+    t.join();
+  double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+  std::ofstream dataSet(outDir + "/dataSet.csv"), truth(outDir + "/truth.csv"), conditions(outDir + "/conditions.csv");
+  conditions << "file;freq;wpm;farnsworth;dashRatio;jitter;chirp;qsbDepth;qsbPeriod;noise;impulses;qrmOffset;qrmLevel;seconds;cer\n";
+  double seconds = 0, cerSum = 0;
+  for (const Result &r : results)
+  {
+    dataSet << r.dataSet;
+    truth << r.truth;
+    conditions << r.condition;
+    seconds += r.seconds;
+    cerSum += r.cer * r.seconds;
+  }
+
+  // Binary copies : the rows of every file, parsed back
+  auto toBinary = [&](std::string Result::*rows, const char *fileName) {
+    std::vector<DataSetRow> v;
+    DataSetRow row;
+    for (const Result &r : results)
+    {
+      const std::string &s = r.*rows;
+      for (size_t i = 0; i < s.size(); i = s.find('\n', i) + 1)
+        if (parseTimesLine(s.substr(i, s.find('\n', i) - i).c_str(), row))
+          v.push_back(row);
+    }
+    writeDataSet(outDir + "/" + fileName, v, "cwgen", GEN_RATE, 0);
+  };
+  toBinary(&Result::dataSet, "dataSet.cwds");
+  toBinary(&Result::truth, "truth.cwds");
+
+  // Rows per character : smallest and largest count
+  auto balance = [&](std::string Result::*rows, long &nbRows, int &cMin, int &cMax) {
+    int counts[128] = { 0 };
+    nbRows = 0;
+    for (const Result &r : results)
+    {
+      const std::string &s = r.*rows;
+      for (size_t i = 0; i < s.size(); i++)
+        if ((i == 0) || (s[i - 1] == '\n'))
+        {
+          counts[(unsigned char) s[i] & 127]++;
+          nbRows++;
+        }
+    }
+    cMin = 1 << 30;
+    cMax = 0;
+    for (const char *c = GEN_CHARSET; *c; c++)
+    {
+      if (counts[(int) *c] < cMin) cMin = counts[(int) *c];
+      if (counts[(int) *c] > cMax) cMax = counts[(int) *c];
+    }
+  };
+  long nbMeasured, nbTruth;
+  int mMin, mMax, tMin, tMax;
+  balance(&Result::dataSet, nbMeasured, mMin, mMax);
+  balance(&Result::truth, nbTruth, tMin, tMax);
+
+  printf("%d files, %.2f h of audio in %.1f s (%d threads) : %.0f h per minute\n",
+         nbFiles, seconds / 3600, wall, nbThreads, seconds / 3600 / (wall / 60));
+  printf("truth.csv : %ld rows, %d to %d per character\n", nbTruth, tMin, tMax);
+  printf("dataSet.csv : %ld rows, %d to %d per character ; decoder CER %.1f%%\n",
+         nbMeasured, mMin, mMax, 100 * cerSum / (seconds > 0 ? seconds : 1));
+  return 0;
+}
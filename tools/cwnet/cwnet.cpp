@@ -0,0 +1,699 @@
+/*
+ F4LAA : Apprentissage du décodeur neuronal de l'enveloppe (CWNet : GRU + CTC)
+
+   Usage : cwnet train [sequences] [-j threads] [-s seed] [-i cwnet.bin] [-ctc]   apprend, écrit cwnet.bin et include/CWNetWeights.h
+           cwnet eval [cwnet.bin] [file.wav freq ...]                              CER float / int8 / CWDecoder, temps par bloc
+
+   Séquences synthétiques (CWSynth) de quelques mots, conditions au hasard (WPM, Farnsworth, pondération,
+   jitter, bruit, QSB, erreur d'accord), passées par la chaîne de loop() (ADC 12 bits, Resampler, Goertzel,
+   nbSamples et temps perdu entre 2 blocs variables) : le réseau voit les mêmes magnitudes que sur l'ESP32.
+   Apprentissage float (BPTT, Adam) avec une perte par bloc (alignement connu par la synthèse) ou CTC (-ctc),
+   puis quantification int8 par ligne pour le firmware.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "CWNet.h"
+#include "CWSynth.h"
+#include "Cer.h"
+#include "Goertzel.h"
+#include "HostDecoder.h"
+#include "Resampler.h"
+#include "Wav.h"
+
+#define I CWNET_INPUTS
+#define H CWNET_HIDDEN
+#define G CWNET_GATES
+#define C CWNET_CLASSES
+
+#define BATCH 16
+#define LEARNRATE 0.01f
+#define CLIPNORM 5.0f
+#define FRAMEWEIGHT 10 // Frame loss : weight of the frames of a character against the blank ones
+#define FRAMESPAN 2    // Frames labelled with the character
+
+static bool useCtc = false; // Frame loss (alignment known from the synthesis), or CTC
+// Parameters, flat : wx bx wh bh wo bo
+#define P_WX 0
+#define P_BX (P_WX + G * I)
+#define P_WH (P_BX + G)
+#define P_BH (P_WH + G * H)
+#define P_WO (P_BH + G)
+#define P_BO (P_WO + C * H)
+#define NBPARAMS (P_BO + C)
+
+struct Sequence
+{
+  std::vector<float> magnitude;
+  std::vector<float> dt; // ms
+  std::string text;
+  std::vector<float> audio;
+  float freq;
+  std::vector<float> blockEnd;  // ms
+  std::vector<float> emitAt;    // ms : when each character of text is known (alignment target)
+};
+
+// ===== Data =====
+
+static float between(CWNoise &r, float a, float b)
+{
+  return a + (b - a) * r.uniform();
+}
+
+static int classOf(char c)
+{
+  const char *p = strchr(CWNET_ALPHABET + 1, c);
+  return p ? (int) (p - CWNET_ALPHABET) : -1;
+}
+
+// Blocks as in loop() : ADC, Resampler, Goertzel, and some time lost between 2 blocks
+static void toBlocks(Sequence &s, float rate, int nbSamples, float lost, float freqError)
+{
+  Resampler resampler;
+  resampler.setRates(rate, PROCESSING_FREQ);
+  Goertzel goertzel;
+  goertzel.setFreq(s.freq + freqError, PROCESSING_FREQ);
+  int need = resampler.inputCount(nbSamples);
+  std::vector<int> adc(need);
+  std::vector<int> data(nbSamples);
+  float blockMs = 1000.0 * nbSamples / PROCESSING_FREQ;
+  size_t skip = (size_t) (lost * need);
+  for (size_t pos = 0; pos + need <= s.audio.size(); pos += need + skip)
+  {
+    for (int i = 0; i < need; i++)
+    {
+      int v = HOST_ADCMIDPOINT + (int) (s.audio[pos + i] * 1500);
+      adc[i] = v < 0 ? 0 : (v > 4095 ? 4095 : v);
+    }
+    resampler.process(adc.data(), data.data(), nbSamples);
+    s.magnitude.push_back(goertzel.magnitude(data.data(), nbSamples, HOST_ADCMIDPOINT));
+    s.dt.push_back(blockMs * (1 + lost));
+    s.blockEnd.push_back(1000.0 * (pos + need) / rate);
+  }
+}
+
+static Sequence makeSequence(uint32_t seed)
+{
+  CWNoise r;
+  r.seed = seed * 2654435761u + 12345;
+  CWSynthParams p;
+  p.rate = 8000;
+  p.freq = between(r, 500, 900);
+  p.wpm = between(r, 12, 35);
+  if (r.uniform() < 0.25)
+    p.farnsworthWpm = p.wpm * between(r, 0.5, 0.8);
+  p.dashRatio = between(r, 2.6, 3.8);
+  p.jitter = between(r, 0, 0.1);
+  p.amplitude = between(r, 0.1, 0.6);
+  p.noise = p.amplitude * ((r.uniform() < 0.3) ? 0 : between(r, 0, 0.5));
+  if (r.uniform() < 0.3)
+  {
+    p.qsbDepth = between(r, 0.2, 0.8);
+    p.qsbPeriod = between(r, 2000, 8000);
+  }
+  float unit = 1200 / p.wpm;
+  float spaceUnit = (p.farnsworthWpm > 0) ? 1200 / p.farnsworthWpm : unit;
+  p.leadIn = between(r, 8, 12) * spaceUnit; // The last character is known after the silence
+
+  Sequence s;
+  const char *charset = CWNET_ALPHABET + 2;
+  int nbChars = strlen(charset);
+  int nbWords = 1 + (int) (r.uniform() * 3);
+  for (int w = 0; w < nbWords; w++)
+  {
+    if (w)
+      s.text += ' ';
+    int len = 1 + (int) (r.uniform() * 5);
+    for (int k = 0; k < len; k++)
+      s.text += charset[(int) (r.uniform() * nbChars) % nbChars];
+  }
+  s.freq = p.freq;
+  std::vector<float> keying;
+  s.audio = cwSynth(s.text, p, r.seed, &keying);
+
+  // A character is known 2 units after its last element (more than an element space),
+  // a word space 5 space units after the last character (more than a letter space)
+  float t = p.leadIn;
+  size_t k = 0;
+  float lastEnd = 0;
+  for (char c : s.text)
+  {
+    if (c == ' ')
+    {
+      s.emitAt.push_back(lastEnd + 5 * spaceUnit);
+      continue;
+    }
+    int n = 2 * strlen(morseCode(c)) - 1;
+    if (k > 0)
+      t += keying[k - 1]; // Space before
+    for (int i = 0; i < n; i++)
+      t += keying[k + i];
+    k += n + 1;
+    lastEnd = t;
+    s.emitAt.push_back(t + 2 * unit);
+  }
+  toBlocks(s, p.rate, 60 + (int) (r.uniform() * 60), between(r, 0, 0.3), between(r, -15, 15));
+  return s;
+}
+
+// ===== Float model =====
+
+static float sigmoid(float x) { return 1 / (1 + exp(-x)); }
+
+struct Trace
+{
+  std::vector<float> x, h, z, r, n, ghn, prob;
+};
+
+static void features(const Sequence &s, std::vector<float> &x)
+{
+  CWNetFeatures f;
+  x.resize(s.magnitude.size() * I);
+  for (size_t t = 0; t < s.magnitude.size(); t++)
+    f.compute(s.magnitude[t], s.dt[t], &x[t * I]);
+}
+
+static void forward(const std::vector<float> &w, const Sequence &s, Trace &tr)
+{
+  size_t T = s.magnitude.size();
+  features(s, tr.x);
+  tr.h.assign((T + 1) * H, 0);
+  tr.z.resize(T * H);
+  tr.r.resize(T * H);
+  tr.n.resize(T * H);
+  tr.ghn.resize(T * H);
+  tr.prob.resize(T * C);
+  for (size_t t = 0; t < T; t++)
+  {
+    const float *x = &tr.x[t * I];
+    const float *hp = &tr.h[t * H];
+    float *hn = &tr.h[(t + 1) * H];
+    float gx[G], gh[G];
+    for (int g = 0; g < G; g++)
+    {
+      float a = w[P_BX + g], b = w[P_BH + g];
+      for (int i = 0; i < I; i++)
+        a += w[P_WX + g * I + i] * x[i];
+      for (int j = 0; j < H; j++)
+        b += w[P_WH + g * H + j] * hp[j];
+      gx[g] = a;
+      gh[g] = b;
+    }
+    for (int j = 0; j < H; j++)
+    {
+      float z = sigmoid(gx[j] + gh[j]);
+      float r = sigmoid(gx[H + j] + gh[H + j]);
+      float n = tanh(gx[2 * H + j] + r * gh[2 * H + j]);
+      tr.z[t * H + j] = z;
+      tr.r[t * H + j] = r;
+      tr.n[t * H + j] = n;
+      tr.ghn[t * H + j] = gh[2 * H + j];
+      hn[j] = n + z * (hp[j] - n);
+    }
+    float *p = &tr.prob[t * C];
+    float mx = -1e30;
+    for (int c = 0; c < C; c++)
+    {
+      float a = w[P_BO + c];
+      for (int j = 0; j < H; j++)
+        a += w[P_WO + c * H + j] * hn[j];
+      p[c] = a;
+      if (a > mx)
+        mx = a;
+    }
+    float sum = 0;
+    for (int c = 0; c < C; c++)
+      sum += (p[c] = exp(p[c] - mx));
+    for (int c = 0; c < C; c++)
+      p[c] /= sum;
+  }
+}
+
+static std::string greedy(const std::vector<float> &prob)
+{
+  std::string out;
+  int last = 0;
+  for (size_t t = 0; t < prob.size() / C; t++)
+  {
+    int best = 0;
+    for (int c = 1; c < C; c++)
+      if (prob[t * C + c] > prob[t * C + best])
+        best = c;
+    if (best && (best != last))
+      out += CWNET_ALPHABET[best];
+    last = best;
+  }
+  return out;
+}
+
+static inline double logAdd(double a, double b)
+{
+  if (a < b) std::swap(a, b);
+  if (b == -INFINITY) return a;
+  return a + log1p(exp(b - a));
+}
+
+// CTC loss, and its gradient on the logits (prob - posterior)
+static double ctc(const std::vector<float> &prob, const std::vector<int> &label, std::vector<float> &dLogits)
+{
+  int T = prob.size() / C;
+  int S = 2 * label.size() + 1;
+  auto lab = [&](int s) { return (s & 1) ? label[s / 2] : 0; };
+  std::vector<double> alpha(T * S, -INFINITY), beta(T * S, -INFINITY);
+  auto lp = [&](int t, int s) { return log(std::max(prob[t * C + lab(s)], 1e-30f)); };
+  alpha[0] = lp(0, 0);
+  if (S > 1)
+    alpha[1] = lp(0, 1);
+  for (int t = 1; t < T; t++)
+    for (int s = 0; s < S; s++)
+    {
+      double a = alpha[(t - 1) * S + s];
+      if (s > 0) a = logAdd(a, alpha[(t - 1) * S + s - 1]);
+      if ((s > 1) && (lab(s) != 0) && (lab(s) != lab(s - 2))) a = logAdd(a, alpha[(t - 1) * S + s - 2]);
+      alpha[t * S + s] = a + lp(t, s);
+    }
+  beta[(T - 1) * S + S - 1] = lp(T - 1, S - 1);
+  if (S > 1)
+    beta[(T - 1) * S + S - 2] = lp(T - 1, S - 2);
+  for (int t = T - 2; t >= 0; t--)
+    for (int s = 0; s < S; s++)
+    {
+      double b = beta[(t + 1) * S + s];
+      if (s < S - 1) b = logAdd(b, beta[(t + 1) * S + s + 1]);
+      if ((s < S - 2) && (lab(s) != 0) && (lab(s) != lab(s + 2))) b = logAdd(b, beta[(t + 1) * S + s + 2]);
+      beta[t * S + s] = b + lp(t, s);
+    }
+  double logP = logAdd(alpha[(T - 1) * S + S - 1], (S > 1) ? alpha[(T - 1) * S + S - 2] : -INFINITY);
+  if (!std::isfinite(logP))
+  {
+    dLogits.assign(T * C, 0);
+    return 0; // Too short for the label
+  }
+
+  dLogits.assign(prob.begin(), prob.end());
+  std::vector<double> post(C);
+  for (int t = 0; t < T; t++)
+  {
+    std::fill(post.begin(), post.end(), -INFINITY);
+    for (int s = 0; s < S; s++)
+    {
+      // alpha and beta both include prob(t, s)
+      double v = alpha[t * S + s] + beta[t * S + s] - lp(t, s);
+      post[lab(s)] = logAdd(post[lab(s)], v);
+    }
+    for (int c = 0; c < C; c++)
+      if (post[c] != -INFINITY)
+        dLogits[t * C + c] -= exp(post[c] - logP);
+  }
+  return -logP;
+}
+
+// Cross entropy of each frame : blank, or the character known at that time
+static double frameLoss(const std::vector<float> &prob, const Sequence &s, std::vector<float> &dLogits)
+{
+  int T = prob.size() / C;
+  std::vector<int> target(T, 0);
+  int t = 0;
+  for (size_t i = 0; i < s.text.size(); i++)
+  {
+    while ((t < T) && (s.blockEnd[t] < s.emitAt[i]))
+      t++;
+    for (int k = t; (k < t + FRAMESPAN) && (k < T); k++)
+      target[k] = classOf(s.text[i]);
+  }
+  double loss = 0;
+  dLogits.assign(prob.begin(), prob.end());
+  for (t = 0; t < T; t++)
+  {
+    float weight = target[t] ? FRAMEWEIGHT : 1;
+    loss -= weight * log(std::max(prob[t * C + target[t]], 1e-30f));
+    dLogits[t * C + target[t]] -= 1;
+    for (int c = 0; c < C; c++)
+      dLogits[t * C + c] *= weight;
+  }
+  return loss;
+}
+
+static double backward(const std::vector<float> &w, const Sequence &s, const Trace &tr, std::vector<float> &grad)
+{
+  std::vector<float> dLogits;
+  double loss;
+  if (useCtc)
+  {
+    std::vector<int> label;
+    for (char c : s.text)
+      label.push_back(classOf(c));
+    loss = ctc(tr.prob, label, dLogits);
+  }
+  else
+    loss = frameLoss(tr.prob, s, dLogits);
+  if (loss == 0)
+    return 0;
+
+  size_t T = s.magnitude.size();
+  std::vector<float> dh(H, 0);
+  for (size_t t = T; t-- > 0;)
+  {
+    const float *hn = &tr.h[(t + 1) * H];
+    const float *hp = &tr.h[t * H];
+    const float *dl = &dLogits[t * C];
+    for (int c = 0; c < C; c++)
+    {
+      grad[P_BO + c] += dl[c];
+      for (int j = 0; j < H; j++)
+      {
+        grad[P_WO + c * H + j] += dl[c] * hn[j];
+        dh[j] += dl[c] * w[P_WO + c * H + j];
+      }
+    }
+
+    float dgx[G], dgh[G];
+    std::vector<float> dhp(H);
+    for (int j = 0; j < H; j++)
+    {
+      float z = tr.z[t * H + j], r = tr.r[t * H + j], n = tr.n[t * H + j];
+      float dn = dh[j] * (1 - z);
+      float dz = dh[j] * (hp[j] - n);
+      dhp[j] = dh[j] * z;
+      float dan = dn * (1 - n * n);
+      float dr = dan * tr.ghn[t * H + j];
+      dgx[j] = dgh[j] = dz * z * (1 - z);
+      dgx[H + j] = dgh[H + j] = dr * r * (1 - r);
+      dgx[2 * H + j] = dan;
+      dgh[2 * H + j] = dan * r;
+    }
+    const float *x = &tr.x[t * I];
+    for (int g = 0; g < G; g++)
+    {
+      grad[P_BX + g] += dgx[g];
+      grad[P_BH + g] += dgh[g];
+      for (int i = 0; i < I; i++)
+        grad[P_WX + g * I + i] += dgx[g] * x[i];
+      for (int j = 0; j < H; j++)
+      {
+        grad[P_WH + g * H + j] += dgh[g] * hp[j];
+        dhp[j] += dgh[g] * w[P_WH + g * H + j];
+      }
+    }
+    dh = dhp;
+  }
+  return loss;
+}
+
+// ===== Quantization =====
+
+struct Quantized
+{
+  int8_t wx[G * I], wh[G * H], wo[C * H];
+  int32_t mx[G], bx[G], mh[G], bh[G], mo[C], bo[C];
+  CWNetModel model() const { return { wx, mx, bx, wh, mh, bh, wo, mo, bo }; }
+};
+
+static void quantizeRows(const float *w, const float *b, int nbRows, int nbCols, int8_t *q, int32_t *mul, int32_t *bias)
+{
+  for (int r = 0; r < nbRows; r++)
+  {
+    float mx = 1e-6;
+    for (int c = 0; c < nbCols; c++)
+      mx = std::max(mx, fabsf(w[r * nbCols + c]));
+    float scale = mx / 127;
+    for (int c = 0; c < nbCols; c++)
+      q[r * nbCols + c] = (int8_t) lrintf(w[r * nbCols + c] / scale);
+    mul[r] = lrintf(scale * 8 * 65536); // acc * scale / 128 * 1024
+    bias[r] = lrintf(b[r] * 1024);
+  }
+}
+
+static void quantize(const std::vector<float> &w, Quantized &q)
+{
+  quantizeRows(&w[P_WX], &w[P_BX], G, I, q.wx, q.mx, q.bx);
+  quantizeRows(&w[P_WH], &w[P_BH], G, H, q.wh, q.mh, q.bh);
+  quantizeRows(&w[P_WO], &w[P_BO], C, H, q.wo, q.mo, q.bo);
+}
+
+template <class T>
+static void writeArray(FILE *f, const char *type, const char *name, const T *v, int n, int perLine)
+{
+  fprintf(f, "static const %s %s[%d] = {", type, name, n);
+  for (int i = 0; i < n; i++)
+    fprintf(f, "%s%ld%s", (i % perLine) ? " " : "\n  ", (long) v[i], (i < n - 1) ? "," : "");
+  fprintf(f, "\n};\n\n");
+}
+
+static bool writeHeader(const char *fileName, const Quantized &q, long nbSequences, double cerFloat, double cerInt8)
+{
+  FILE *f = fopen(fileName, "w");
+  if (!f)
+    return false;
+  fprintf(f, "/*\n F4LAA : Poids du décodeur neuronal (CWNet)\n\n"
+             "   Généré par tools/cwnet : ne pas modifier.\n"
+             "   %d paramètres int8, %ld séquences d'apprentissage, CER de validation %.1f%% (float) / %.1f%% (int8)\n*/\n",
+          G * I + G * H + C * H, nbSequences, 100 * cerFloat, 100 * cerInt8);
+  fprintf(f, "#ifndef CWNetWeights_h\n#define CWNetWeights_h\n\n#include \"CWNet.h\"\n\n");
+  writeArray(f, "int8_t", "cwnetWx", q.wx, G * I, I);
+  writeArray(f, "int32_t", "cwnetMx", q.mx, G, 8);
+  writeArray(f, "int32_t", "cwnetBx", q.bx, G, 8);
+  writeArray(f, "int8_t", "cwnetWh", q.wh, G * H, H);
+  writeArray(f, "int32_t", "cwnetMh", q.mh, G, 8);
+  writeArray(f, "int32_t", "cwnetBh", q.bh, G, 8);
+  writeArray(f, "int8_t", "cwnetWo", q.wo, C * H, H);
+  writeArray(f, "int32_t", "cwnetMo", q.mo, C, 8);
+  writeArray(f, "int32_t", "cwnetBo", q.bo, C, 8);
+  fprintf(f, "const CWNetModel cwnetModel = { cwnetWx, cwnetMx, cwnetBx, cwnetWh, cwnetMh, cwnetBh, cwnetWo, cwnetMo, cwnetBo };\n\n#endif\n");
+  return fclose(f) == 0;
+}
+
+// ===== Evaluation =====
+
+static std::string decodeInt8(const CWNetModel &m, const Sequence &s, double *usPerBlock = 0)
+{
+  CWNet net(m);
+  std::string out;
+  auto t0 = std::chrono::steady_clock::now();
+  for (size_t t = 0; t < s.magnitude.size(); t++)
+  {
+    char c = net.process(s.magnitude[t], s.dt[t]);
+    if (c)
+      out += c;
+  }
+  if (usPerBlock)
+    *usPerBlock = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / s.magnitude.size();
+  return out;
+}
+
+#define NBVALID 200
+
+static void evaluate(const std::vector<float> &w, double &cerFloat, double &cerInt8, double *cerDecoder = 0)
+{
+  Quantized q;
+  quantize(w, q);
+  CWNetModel m = q.model();
+  double sf = 0, si = 0, sd = 0;
+  for (int k = 0; k < NBVALID; k++)
+  {
+    Sequence s = makeSequence(1000000000u + k);
+    Trace tr;
+    forward(w, s, tr);
+    sf += cer(s.text, greedy(tr.prob));
+    si += cer(s.text, decodeInt8(m, s));
+    if (cerDecoder)
+    {
+      HostDecoderParams hp;
+      hp.freq = s.freq;
+      HostDecoder hd(hp);
+      sd += cer(s.text, hd.decode(s.audio, 8000));
+    }
+  }
+  cerFloat = sf / NBVALID;
+  cerInt8 = si / NBVALID;
+  if (cerDecoder)
+    *cerDecoder = sd / NBVALID;
+}
+
+static bool load(const char *fileName, std::vector<float> &w, long &nbSequences)
+{
+  FILE *f = fopen(fileName, "rb");
+  if (!f)
+    return false;
+  w.resize(NBPARAMS);
+  bool ok = (fread(&nbSequences, sizeof(nbSequences), 1, f) == 1) && (fread(w.data(), sizeof(float), NBPARAMS, f) == NBPARAMS);
+  fclose(f);
+  return ok;
+}
+
+static void save(const char *fileName, const std::vector<float> &w, long nbSequences)
+{
+  FILE *f = fopen(fileName, "wb");
+  if (!f)
+    return;
+  fwrite(&nbSequences, sizeof(nbSequences), 1, f);
+  fwrite(w.data(), sizeof(float), NBPARAMS, f);
+  fclose(f);
+}
+
+static int train(long nbSequences, int nbThreads, uint32_t seed, const char *initFile)
+{
+  std::vector<float> w(NBPARAMS);
+  long done = 0;
+  if (!initFile || !load(initFile, w, done))
+  {
+    CWNoise r;
+    r.seed = seed;
+    float sx = 1 / sqrt((float) I), sh = 1 / sqrt((float) H);
+    for (int k = 0; k < NBPARAMS; k++)
+      w[k] = ((k < P_BX) ? sx : sh) * (2 * r.uniform() - 1);
+    for (int k = P_BX; k < P_WH; k++)
+      w[k] = 0;
+    for (int k = P_BH; k < P_WO; k++)
+      w[k] = 0;
+    for (int k = P_BO; k < NBPARAMS; k++)
+      w[k] = 0;
+  }
+
+  std::vector<float> m(NBPARAMS, 0), v(NBPARAMS, 0);
+  std::vector<std::vector<float>> grads(nbThreads, std::vector<float>(NBPARAMS));
+  std::vector<double> losses(nbThreads);
+  auto t0 = std::chrono::steady_clock::now();
+  double lossAvg = 0;
+  for (long step = 1; done < nbSequences; step++)
+  {
+    for (int k = 0; k < nbThreads; k++)
+    {
+      std::fill(grads[k].begin(), grads[k].end(), 0);
+      losses[k] = 0;
+    }
+    std::vector<std::thread> threads;
+    for (int k = 0; k < nbThreads; k++)
+      threads.emplace_back([&, k]() {
+        for (int b = k; b < BATCH; b += nbThreads)
+        {
+          Sequence s = makeSequence(seed * 100000000u + done + b);
+          Trace tr;
+          forward(w, s, tr);
+          losses[k] += backward(w, s, tr, grads[k]);
+        }
+      });
+    for (std::thread &t : threads)
+      t.join();
+    done += BATCH;
+
+    // Adam, gradient clipped
+    double loss = 0, norm = 0;
+    for (int k = 1; k < nbThreads; k++)
+      for (int i = 0; i < NBPARAMS; i++)
+        grads[0][i] += grads[k][i];
+    for (int k = 0; k < nbThreads; k++)
+      loss += losses[k];
+    for (int i = 0; i < NBPARAMS; i++)
+    {
+      grads[0][i] /= BATCH;
+      norm += grads[0][i] * grads[0][i];
+    }
+    norm = sqrt(norm);
+    float clip = (norm > CLIPNORM) ? CLIPNORM / norm : 1;
+    float lr = LEARNRATE * ((done > nbSequences * 3 / 4) ? 0.3f : 1.0f);
+    for (int i = 0; i < NBPARAMS; i++)
+    {
+      float g = grads[0][i] * clip;
+      m[i] = 0.9f * m[i] + 0.1f * g;
+      v[i] = 0.999f * v[i] + 0.001f * g * g;
+      float mh = m[i] / (1 - pow(0.9, step)), vh = v[i] / (1 - pow(0.999, step));
+      w[i] -= lr * mh / (sqrt(vh) + 1e-8f);
+    }
+    lossAvg = (step == 1) ? loss / BATCH : 0.98 * lossAvg + 0.02 * loss / BATCH;
+    if ((done % (BATCH * 250)) == 0)
+    {
+      double cf, ci;
+      evaluate(w, cf, ci);
+      double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+      printf("%7ld sequences  loss %6.2f  CER float %5.1f%%  int8 %5.1f%%  (%.0f s)\n", done, lossAvg, 100 * cf, 100 * ci, s);
+      fflush(stdout);
+      save("cwnet.bin", w, done);
+    }
+  }
+  save("cwnet.bin", w, done);
+
+  double cf, ci, cd;
+  evaluate(w, cf, ci, &cd);
+  printf("validation CER : float %.1f%%, int8 %.1f%%, CWDecoder %.1f%%\n", 100 * cf, 100 * ci, 100 * cd);
+  Quantized q;
+  quantize(w, q);
+  if (!writeHeader("include/CWNetWeights.h", q, done, cf, ci))
+  {
+    fprintf(stderr, "Can't write include/CWNetWeights.h (run from the repository root)\n");
+    return 1;
+  }
+  printf("include/CWNetWeights.h written\n");
+  return 0;
+}
+
+static int eval(int argc, char **argv)
+{
+  std::vector<float> w;
+  long done = 0;
+  int a = 2;
+  if ((argc > 2) && strstr(argv[2], ".bin"))
+  {
+    if (!load(argv[2], w, done))
+    {
+      fprintf(stderr, "Can't read %s\n", argv[2]);
+      return 1;
+    }
+    a = 3;
+    double cf, ci, cd;
+    evaluate(w, cf, ci, &cd);
+    printf("%ld sequences : validation CER float %.1f%%, int8 %.1f%%, CWDecoder %.1f%%\n", done, 100 * cf, 100 * ci, 100 * cd);
+  }
+
+  // The compiled weights (include/CWNetWeights.h) on WAV files
+  for (; a + 1 < argc; a += 2)
+  {
+    Wav wav;
+    if (!readWav(argv[a], wav))
+    {
+      fprintf(stderr, "Can't read %s\n", argv[a]);
+      continue;
+    }
+    Sequence s;
+    s.audio = wav.samples;
+    s.freq = atof(argv[a + 1]);
+    toBlocks(s, wav.rate, 100, 0, 0);
+    double us;
+    std::string text = decodeInt8(cwnetModel, s, &us);
+    printf("%s : %zu blocks, %.2f us per block\n%s\n", argv[a], s.magnitude.size(), us, text.c_str());
+  }
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  if ((argc > 1) && !strcmp(argv[1], "train"))
+  {
+    long nb = 200000;
+    int nbThreads = std::thread::hardware_concurrency();
+    uint32_t seed = 1;
+    const char *init = 0;
+    for (int a = 2; a < argc; a++)
+    {
+      if (!strcmp(argv[a], "-j") && (a + 1 < argc)) nbThreads = atoi(argv[++a]);
+      else if (!strcmp(argv[a], "-s") && (a + 1 < argc)) seed = atoi(argv[++a]);
+      else if (!strcmp(argv[a], "-i") && (a + 1 < argc)) init = argv[++a];
+      else if (!strcmp(argv[a], "-ctc")) useCtc = true;
+      else nb = atol(argv[a]);
+    }
+    if (nbThreads < 1)
+      nbThreads = 1;
+    if (nbThreads > BATCH)
+      nbThreads = BATCH;
+    return train(nb, nbThreads, seed, init);
+  }
+  if ((argc > 1) && !strcmp(argv[1], "eval"))
+    return eval(argc, argv);
+  fprintf(stderr, "Usage : cwnet train [sequences] [-j threads] [-s seed] [-i cwnet.bin]\n"
+                  "        cwnet eval [cwnet.bin] [file.wav freq ...]\n");
+  return 1;
+}
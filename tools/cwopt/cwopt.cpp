@@ -0,0 +1,341 @@
+/*
+ F4LAA : Optimisation des paramètres du décodeur par conditions de réception (descente par coordonnées)
+
+   Usage : cwopt [-c corpus] [-n files] [-d seconds] [-j threads] [-s seed] [-o include/DecoderPresets.h]
+   Pour chaque condition (clean, noisy, fast), le corpus est corpus/<condition>/ (WAV + transcription, voir Corpus.h)
+   s'il existe, sinon n fichiers synthétiques de d secondes tirés dans la condition.
+   Partant des défauts du firmware, chaque paramètre (nbTime, magReactivity, spaceDetector, nbSamples, modèle)
+   est essayé sur toutes ses valeurs, en parallèle, tant que le CER baisse. Les plages vont au-delà des
+   optimums trouvés (aucun préréglage ne doit tomber sur une borne) ; les bornes des commandes N, R, B et S
+   du firmware les contiennent. nbSamples 0 (suit le WPM) est essayé pour chaque condition, et son CER est
+   donné à côté du préréglage quand celui-ci fixe nbSamples (commande "autonbs" pour y revenir).
+   Les magnitudes (Resampler + Goertzel) ne dépendent que du fichier et de nbSamples : elles sont calculées
+   une fois par nbSamples fixe et seul l'étage de décision est rejoué. nbSamples 0 (suit le WPM) refait tout.
+   Écrit la table des préréglages chargée par le firmware (commande 'O').
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+#include "CWSynth.h"
+#include "Cer.h"
+#include "Corpus.h"
+#include "HostDecoder.h"
+
+#define OPT_RATE 8000
+#define OPT_CHARSET "abcdefghijklmnopqrstuvwxyz0123456789?.,/"
+#define OPT_MAXPASSES 5
+
+struct Condition
+{
+  const char *name;
+  float wpmMin, wpmMax;
+  float noiseMin, noiseMax; // Relative to the amplitude
+  float qsb;                // Probability of QSB
+  float impulses;           // Probability of clicks
+};
+
+static const Condition conditions[] = {
+  { "clean", 12, 25, 0, 0.15, 0, 0 },
+  { "noisy", 12, 25, 0.25, 0.6, 0.5, 0.3 },
+  { "fast", 25, 40, 0, 0.3, 0.2, 0 },
+};
+#define NBCONDITIONS (int) (sizeof(conditions) / sizeof(conditions[0]))
+
+// A point of the search : nbSamples 0 follows the WPM as in loop(). Ranges within the firmware bounds
+#define NBPARAMS 5 // nbTime, magReactivity, spaceDetector, nbSamples, model
+static const std::vector<int> paramValues[NBPARAMS] = {
+  { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 14, 16, 18, 20, 25, 30, 35, 40, 50 },
+  { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 14, 16, 18, 20, 25, 30, 40, 50, 60, 80, 100, 120, 150, 200, 250 },
+  { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 14, 16, 20 },
+  { 0, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120, 140, 160, 180, 200, 220, 250 },
+  { TIMING_G6EJD, TIMING_ADAPTIVE },
+};
+typedef std::array<int, NBPARAMS> Point;
+
+struct Corpus
+{
+  std::vector<RefFile> files;
+  size_t refChars = 0;
+  std::map<int, std::vector<std::vector<HostBlock>>> blocks; // nbSamples ==> blocks of each file
+};
+
+static int nbThreads = 1;
+static std::atomic<long> nbReplays(0), nbFullDecodes(0);
+
+static void parallelFor(size_t n, const std::function<void(size_t)> &job)
+{
+  std::atomic<size_t> next(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < nbThreads; t++)
+    threads.emplace_back([&]() {
+      for (size_t i = next++; i < n; i = next++)
+        job(i);
+    });
+  for (std::thread &t : threads)
+    t.join();
+}
+
+static float between(CWNoise &r, float a, float b)
+{
+  return a + (b - a) * r.uniform();
+}
+
+static RefFile synthesize(const Condition &c, int index, uint32_t seed, double seconds)
+{
+  CWNoise r;
+  r.seed = seed * 1000003 + index * 7919 + 1;
+  CWSynthParams p;
+  p.rate = OPT_RATE;
+  p.freq = between(r, 500, 900);
+  p.wpm = between(r, c.wpmMin, c.wpmMax);
+  p.dashRatio = between(r, 2.7, 3.5);
+  p.jitter = between(r, 0, 0.08);
+  p.amplitude = between(r, 0.2, 0.6);
+  p.noise = p.amplitude * between(r, c.noiseMin, c.noiseMax);
+  if (r.uniform() < c.qsb)
+  {
+    p.qsbDepth = between(r, 0.3, 0.8);
+    p.qsbPeriod = between(r, 2000, 10000);
+  }
+  if (r.uniform() < c.impulses)
+  {
+    p.impulseRate = between(r, 0.5, 3);
+    p.impulseAmplitude = p.amplitude * between(r, 1, 3);
+  }
+
+  // Random words, until long enough (PARIS : 50 units per word)
+  std::string text;
+  int nbWords = seconds * p.wpm / 60;
+  for (int w = 0; w < nbWords; w++)
+  {
+    int len = 1 + (int) (r.uniform() * 6);
+    if (w)
+      text += ' ';
+    for (int k = 0; k < len; k++)
+      text += OPT_CHARSET[(int) (r.uniform() * strlen(OPT_CHARSET)) % strlen(OPT_CHARSET)];
+  }
+
+  RefFile f;
+  f.name = std::string(c.name) + "_" + std::to_string(index);
+  f.wav.rate = OPT_RATE;
+  f.wav.samples = cwSynth(text, p, r.seed);
+  f.reference = text;
+  f.freq = p.freq;
+  return f;
+}
+
+static HostDecoderParams params(const Point &pt, float freq)
+{
+  HostDecoderParams hp;
+  hp.freq = freq;
+  hp.nbTime = pt[0];
+  hp.magReactivity = pt[1];
+  hp.spaceDetector = pt[2];
+  if (pt[3])
+  {
+    hp.nbSamples = pt[3];
+    hp.adaptNbSamples = false;
+  }
+  hp.model = pt[4];
+  return hp;
+}
+
+// Edit distance of one file : the decision stage only when the blocks are known
+static size_t errors(const Corpus &corpus, size_t k, const Point &pt)
+{
+  const RefFile &f = corpus.files[k];
+  HostDecoder hd(params(pt, f.freq));
+  std::string decoded;
+  auto b = corpus.blocks.find(pt[3]);
+  if (b != corpus.blocks.end())
+  {
+    decoded = hd.decodeBlocks(b->second[k]);
+    nbReplays++;
+  }
+  else
+  {
+    decoded = hd.decode(f.wav.samples, f.wav.rate);
+    nbFullDecodes++;
+  }
+  std::string d = normalizeText(decoded);
+  return editDistance(std::vector<char>(f.reference.begin(), f.reference.end()), std::vector<char>(d.begin(), d.end()));
+}
+
+// CER of each point, every (point, file) in parallel ; already known points are not decoded again
+static std::vector<double> evaluate(const Corpus &corpus, const std::vector<Point> &points, std::map<Point, double> &known)
+{
+  std::vector<Point> todo;
+  for (const Point &pt : points)
+    if (!known.count(pt) && (std::find(todo.begin(), todo.end(), pt) == todo.end()))
+      todo.push_back(pt);
+  size_t nbFiles = corpus.files.size();
+  std::vector<size_t> errs(todo.size() * nbFiles);
+  parallelFor(errs.size(), [&](size_t i) { errs[i] = errors(corpus, i % nbFiles, todo[i / nbFiles]); });
+  for (size_t t = 0; t < todo.size(); t++)
+  {
+    size_t sum = 0;
+    for (size_t k = 0; k < nbFiles; k++)
+      sum += errs[t * nbFiles + k];
+    known[todo[t]] = (double) sum / corpus.refChars;
+  }
+  std::vector<double> cers;
+  for (const Point &pt : points)
+    cers.push_back(known[pt]);
+  return cers;
+}
+
+static std::string pointText(const Point &pt)
+{
+  char buf[96];
+  snprintf(buf, sizeof(buf), "nbTime %d, magReactivity %d, spaceDetector %d, nbSamples %s, %s", pt[0], pt[1], pt[2],
+           pt[3] ? std::to_string(pt[3]).c_str() : "wpm", (pt[4] == TIMING_ADAPTIVE) ? "adaptive" : "G6EJD");
+  return buf;
+}
+
+int main(int argc, char **argv)
+{
+  std::string corpusDir, outName = "include/DecoderPresets.h";
+  int nbFiles = 12;
+  double seconds = 40;
+  uint32_t seed = 1;
+  nbThreads = std::thread::hardware_concurrency();
+  for (int i = 1; i + 1 < argc; i += 2)
+  {
+    if (!strcmp(argv[i], "-c")) corpusDir = argv[i + 1];
+    else if (!strcmp(argv[i], "-n")) nbFiles = atoi(argv[i + 1]);
+    else if (!strcmp(argv[i], "-d")) seconds = atof(argv[i + 1]);
+    else if (!strcmp(argv[i], "-j")) nbThreads = atoi(argv[i + 1]);
+    else if (!strcmp(argv[i], "-s")) seed = atoi(argv[i + 1]);
+    else if (!strcmp(argv[i], "-o")) outName = argv[i + 1];
+  }
+  if (nbThreads < 1)
+    nbThreads = 1;
+
+  HostDecoderParams def;
+  Point defaults = { def.nbTime, def.magReactivity, def.spaceDetector, 0, def.model };
+  Point best[NBCONDITIONS];
+  double bestCer[NBCONDITIONS], defaultCer[NBCONDITIONS], autoCer[NBCONDITIONS];
+  auto t0 = std::chrono::steady_clock::now();
+
+  for (int c = 0; c < NBCONDITIONS; c++)
+  {
+    Corpus corpus;
+    if (!corpusDir.empty())
+      corpus.files = loadCorpus(corpusDir + "/" + conditions[c].name);
+    bool synthetic = corpus.files.empty();
+    if (synthetic)
+    {
+      corpus.files.resize(nbFiles);
+      parallelFor(nbFiles, [&](size_t k) { corpus.files[k] = synthesize(conditions[c], k, seed, seconds); });
+    }
+    double audio = 0;
+    for (const RefFile &f : corpus.files)
+    {
+      corpus.refChars += f.reference.size();
+      audio += f.seconds();
+    }
+
+    // DSP stage once per fixed nbSamples
+    auto t1 = std::chrono::steady_clock::now();
+    std::vector<int> fixed;
+    for (int n : paramValues[3])
+      if (n)
+      {
+        fixed.push_back(n);
+        corpus.blocks[n].resize(corpus.files.size());
+      }
+    size_t nbFiles = corpus.files.size();
+    parallelFor(fixed.size() * nbFiles, [&](size_t i) {
+      const RefFile &f = corpus.files[i % nbFiles];
+      Point pt = defaults;
+      pt[3] = fixed[i / nbFiles];
+      HostDecoder hd(params(pt, f.freq));
+      corpus.blocks[pt[3]][i % nbFiles] = hd.blocks(f.wav.samples, f.wav.rate);
+    });
+    double dspMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t1).count();
+    printf("%s : %zu %s files, %.0f s of audio, %zu characters ; DSP stage for %zu nbSamples in %.0f ms\n",
+           conditions[c].name, nbFiles, synthetic ? "synthetic" : "recorded", audio, corpus.refChars, fixed.size(), dspMs);
+
+    // Coordinate descent
+    std::map<Point, double> known;
+    Point pt = defaults;
+    double cer = evaluate(corpus, { pt }, known)[0];
+    defaultCer[c] = cer;
+    printf("  defaults %5.1f%%  %s\n", 100 * cer, pointText(pt).c_str());
+    for (int pass = 0; pass < OPT_MAXPASSES; pass++)
+    {
+      bool improved = false;
+      for (int k = 0; k < NBPARAMS; k++)
+      {
+        std::vector<Point> candidates;
+        for (int v : paramValues[k])
+        {
+          Point q = pt;
+          q[k] = v;
+          candidates.push_back(q);
+        }
+        std::vector<double> cers = evaluate(corpus, candidates, known);
+        for (size_t i = 0; i < candidates.size(); i++)
+          if (cers[i] < cer - 1e-9)
+          {
+            cer = cers[i];
+            pt = candidates[i];
+            improved = true;
+          }
+      }
+      printf("  pass %d   %5.1f%%  %s\n", pass + 1, 100 * cer, pointText(pt).c_str());
+      if (!improved)
+        break;
+    }
+    Point autoPt = pt;
+    autoPt[3] = 0;
+    autoCer[c] = evaluate(corpus, { autoPt }, known)[0];
+    printf("  nbSamples wpm %5.1f%%\n", 100 * autoCer[c]);
+    printf("  %zu points evaluated\n", known.size());
+    best[c] = pt;
+    bestCer[c] = cer;
+  }
+  double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+  printf("%ld decision stage replays, %ld full decodes, in %.1f s (%d threads)\n",
+         nbReplays.load(), nbFullDecodes.load(), wall, nbThreads);
+
+  std::ofstream out(outName);
+  if (!out)
+  {
+    fprintf(stderr, "Can't write %s\n", outName.c_str());
+    return 1;
+  }
+  out << "/*\n F4LAA : Préréglages du décodeur par conditions de réception (commande 'O')\n\n"
+      << "   Généré par tools/cwopt : ne pas modifier.\n";
+  for (int c = 0; c < NBCONDITIONS; c++)
+  {
+    char line[128];
+    snprintf(line, sizeof(line), "   %-6s : CER %.1f%% (défauts %.1f%%, nbSamples wpm %.1f%%)\n", conditions[c].name,
+             100 * bestCer[c], 100 * defaultCer[c], 100 * autoCer[c]);
+    out << line;
+  }
+  out << "*/\n#ifndef DecoderPresets_h\n#define DecoderPresets_h\n\n#include <stdint.h>\n\n"
+      << "struct DecoderPreset\n{\n  const char *name;\n  uint8_t nbTime;\n  uint8_t magReactivity;\n"
+      << "  uint8_t spaceDetector;\n  uint8_t model;\n  int16_t nbSamples; // 0 : follows WPM\n};\n\n"
+      << "#define NBPRESETS " << NBCONDITIONS << "\nstatic const DecoderPreset decoderPresets[NBPRESETS] = {\n";
+  for (int c = 0; c < NBCONDITIONS; c++)
+  {
+    char line[128];
+    snprintf(line, sizeof(line), "  { \"%s\", %d, %d, %d, %s, %d },\n", conditions[c].name, best[c][0], best[c][1], best[c][2],
+             (best[c][4] == TIMING_ADAPTIVE) ? "1" : "0", best[c][3]);
+    out << line;
+  }
+  out << "};\n\n#endif\n";
+  printf("%s written\n", outName.c_str());
+  return 0;
+}
@@ -0,0 +1,168 @@
+/*
+ F4LAA : Temps de chaque étage du décodeur (Profiler) : sur PC, ou relevé sur l'ESP32 (commande 'H')
+
+   Usage : cwprof file.wav... [-f freq]     décode les fichiers (HostDecoder) et affiche le profil PC
+           cwprof -l serial.log              affiche le dernier relevé PROF; / HIST; d'un log série
+   Compilé avec -DPROFILER (ainsi que src/CWDecoder.cpp) : sans lui, le profil PC est vide.
+   Pour chaque étage : nombre, min, moyenne, p99, max (us), et l'histogramme log2 en barres.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "Wav.h"
+#include "Corpus.h"
+#include "HostDecoder.h"
+#include "Profiler.h"
+
+struct StageLine
+{
+  std::string prof;              // PROF;stage;count;min;avg;p99;max
+  std::vector<std::string> hist; // HIST;stage;first;counts...
+};
+
+static std::vector<std::string> split(const std::string &s)
+{
+  std::vector<std::string> f;
+  size_t p = 0, q;
+  while ((q = s.find(';', p)) != std::string::npos)
+  {
+    f.push_back(s.substr(p, q - p));
+    p = q + 1;
+  }
+  f.push_back(s.substr(p));
+  return f;
+}
+
+static std::vector<StageLine> stages;
+
+static void addLine(const char *text)
+{
+  std::string s(text);
+  while (!s.empty() && ((s.back() == '\r') || (s.back() == '\n')))
+    s.pop_back();
+  if (s.rfind("PROF;stage", 0) == 0)
+    stages.clear(); // A new dump
+  else if (s.rfind("PROF;", 0) == 0)
+    stages.push_back({ s, {} });
+  else if ((s.rfind("HIST;", 0) == 0) && !stages.empty())
+    stages.back().hist = split(s);
+}
+
+// Bucket b : [2^(b-1), 2^b[ ticks ; ticks in us : ticksPerUs
+static std::string bucketLabel(int b, float ticksPerUs)
+{
+  char text[32];
+  double us = (b == 0) ? 0 : (double) (1ull << (b - 1)) / ticksPerUs;
+  if (us < 1)
+    snprintf(text, sizeof(text), "%7.0f ns", us * 1000);
+  else if (us < 1000)
+    snprintf(text, sizeof(text), "%7.1f us", us);
+  else
+    snprintf(text, sizeof(text), "%7.1f ms", us / 1000);
+  return text;
+}
+
+static void print(float ticksPerUs)
+{
+  printf("%-11s %9s %9s %9s %9s %9s   (us)\n", "stage", "count", "min", "avg", "p99", "max");
+  for (const StageLine &s : stages)
+  {
+    std::vector<std::string> f = split(s.prof);
+    if (f.size() < 7)
+      continue;
+    printf("%-11s %9s %9s %9s %9s %9s\n", f[1].c_str(), f[2].c_str(), f[3].c_str(), f[4].c_str(), f[5].c_str(), f[6].c_str());
+    if (s.hist.size() < 4)
+      continue;
+    int first = atoi(s.hist[2].c_str());
+    long maxCount = 1;
+    for (size_t i = 3; i < s.hist.size(); i++)
+      maxCount = std::max(maxCount, atol(s.hist[i].c_str()));
+    for (size_t i = 3; i < s.hist.size(); i++)
+    {
+      long n = atol(s.hist[i].c_str());
+      int bar = (n * 50 + maxCount - 1) / maxCount;
+      printf("   >= %s %9ld %s\n", bucketLabel(first + (int) (i - 3), ticksPerUs).c_str(), n, std::string(bar, '#').c_str());
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  std::vector<std::string> files;
+  const char *log = 0;
+  float freq = 0;
+  float ticksPerUs = 240; // ESP32 at 240 MHz
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-l") && (i + 1 < argc))
+      log = argv[++i];
+    else if (!strcmp(argv[i], "-f") && (i + 1 < argc))
+      freq = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-mhz") && (i + 1 < argc))
+      ticksPerUs = atof(argv[++i]);
+    else
+      files.push_back(argv[i]);
+  }
+  if (!log && files.empty())
+  {
+    fprintf(stderr, "Usage : cwprof file.wav... [-f freq]\n"
+                    "        cwprof -l serial.log [-mhz cpuMHz]\n");
+    return 1;
+  }
+
+  if (log)
+  {
+    FILE *f = fopen(log, "rb");
+    if (!f)
+    {
+      perror(log);
+      return 1;
+    }
+    char line[1024];
+    while (fgets(line, sizeof(line), f))
+    {
+      // The dump may follow decoded text on the same line
+      char *p = strstr(line, "PROF;");
+      if (!p)
+        p = strstr(line, "HIST;");
+      if (p)
+        addLine(p);
+    }
+    fclose(f);
+    if (stages.empty())
+    {
+      fprintf(stderr, "%s : no PROF; lines (command 'H', firmware built with -DPROFILER)\n", log);
+      return 1;
+    }
+    print(ticksPerUs);
+    return 0;
+  }
+
+#ifndef PROFILER
+  (void) freq;
+  fprintf(stderr, "Built without -DPROFILER : nothing measured\n");
+  return 1;
+#else
+  double seconds = 0;
+  for (const std::string &name : files)
+  {
+    Wav wav;
+    if (!readWav(name, wav))
+    {
+      fprintf(stderr, "%s : not a WAV file\n", name.c_str());
+      continue;
+    }
+    HostDecoderParams p;
+    p.freq = freq ? freq : findFreq(wav);
+    HostDecoder decoder(p);
+    decoder.decode(wav.samples, wav.rate);
+    seconds += wav.samples.size() / wav.rate;
+  }
+  printf("%.1f s of audio\n", seconds);
+  profiler.dump(addLine);
+  print(profiler.ticksPerUs);
+  return 0;
+#endif
+}
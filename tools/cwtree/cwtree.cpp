@@ -0,0 +1,413 @@
+/*
+ F4LAA : Apprentissage d'un ensemble d'arbres de décision sur les durées des caractères, compilé en code C++
+
+   Usage : cwtree train data.cwds|dataSet.csv [-t trees] [-d depth] [-s seed] [-o include/CWTreeCode.h]
+           cwtree bench data.cwds|dataSet.csv     le code généré (compilé dans cwtree) contre CodeToChar()
+   Les lignes sont au format printTimes (c;t0;...;t10), à étiquettes vraies : dataSet.csv de tools/cwgen.
+   L'unité de temps de chaque ligne suit les silences entre éléments des lignes précédentes (CWTreeUnit, la même
+   que dans le firmware). Une ligne sur 5 sert au test.
+   Forêt aléatoire (arbres CART, indice de Gini, échantillons bootstrap) : train affiche d'abord le compromis
+   précision / taille (nœuds) / nombre de comparaisons pour plusieurs tailles, puis écrit l'ensemble demandé.
+   La référence CodeToChar() classe chaque son en . ou - (seuil 2 unités) puis appelle CWDecoder::toChar().
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "CWSynth.h"
+#include "CWTree.h"
+#include "DataSet.h"
+#ifdef CWTREE_BENCH
+#include "CWTreeCode.h"
+#endif
+
+#define TREE_TESTEVERY 5
+#define TREE_MINLEAF 2
+
+struct Sample
+{
+  uint8_t x[MAXTIMES];
+  int times[MAXTIMES];
+  int unit;
+  int label; // Index in labels
+};
+
+struct Node
+{
+  int feature = -1; // -1 : leaf
+  int threshold = 0;
+  int left = 0, right = 0;
+  int label = 0;
+};
+
+struct Tree
+{
+  std::vector<Node> nodes;
+  int depth = 0;
+};
+
+static std::string labels;
+
+static bool loadRows(const char *fileName, std::vector<DataSetRow> &rows)
+{
+  DataSetFile ds;
+  if (ds.open(fileName))
+  {
+    for (uint32_t r = 0; r < ds.nbRows(); r++)
+    {
+      DataSetRow row;
+      row.c = ds.label(r);
+      for (int i = 0; i < MAXTIMES; i++)
+        row.times[i] = ds.times(i)[r];
+      rows.push_back(row);
+    }
+    return true;
+  }
+  std::ifstream f(fileName);
+  if (!f)
+    return false;
+  std::string line;
+  DataSetRow row;
+  while (std::getline(f, line))
+    if (parseTimesLine(line.c_str(), row))
+      rows.push_back(row);
+  return true;
+}
+
+// Unit of each row : rolling average of the spaces inside the previous characters
+static std::vector<Sample> makeSamples(const std::vector<DataSetRow> &rows)
+{
+  std::vector<Sample> samples;
+  CWTreeUnit unit;
+  for (const DataSetRow &row : rows)
+  {
+    if (row.c == ' ')
+      continue;
+    Sample s;
+    for (int i = 0; i < MAXTIMES; i++)
+      s.times[i] = row.times[i];
+    s.unit = unit.value();
+    cwTreeFeatures(s.times, s.unit, s.x);
+    size_t l = labels.find(row.c);
+    if (l == std::string::npos)
+    {
+      labels += row.c;
+      l = labels.size() - 1;
+    }
+    s.label = l;
+    if (s.unit > 0)
+      samples.push_back(s); // Not before the first unit
+    unit.add(s.times);
+  }
+  return samples;
+}
+
+static int majority(const std::vector<int> &counts)
+{
+  return std::max_element(counts.begin(), counts.end()) - counts.begin();
+}
+
+static int build(Tree &t, const std::vector<Sample> &data, std::vector<int> &idx, int depth, int maxDepth,
+                 int nbFeatures, CWNoise &rnd)
+{
+  int K = labels.size();
+  std::vector<int> counts(K, 0);
+  for (int i : idx)
+    counts[data[i].label]++;
+  int node = t.nodes.size();
+  t.nodes.push_back(Node());
+  t.nodes[node].label = majority(counts);
+  if (depth > t.depth)
+    t.depth = depth;
+  if ((depth == maxDepth) || ((int) idx.size() < 2 * TREE_MINLEAF) || (counts[t.nodes[node].label] == (int) idx.size()))
+    return node;
+
+  // Features tried at this node
+  int order[MAXTIMES];
+  for (int f = 0; f < MAXTIMES; f++)
+    order[f] = f;
+  for (int f = MAXTIMES - 1; f > 0; f--)
+    std::swap(order[f], order[(int) (rnd.uniform() * (f + 1)) % (f + 1)]);
+
+  // Best Gini split, by histograms of the uint8 features
+  double bestScore = 1e30;
+  int bestFeature = -1, bestThreshold = 0;
+  std::vector<int> hist(256 * K);
+  for (int k = 0; k < nbFeatures; k++)
+  {
+    int f = order[k];
+    std::fill(hist.begin(), hist.end(), 0);
+    for (int i : idx)
+      hist[data[i].x[f] * K + data[i].label]++;
+    std::vector<int> left(K, 0);
+    int nLeft = 0, n = idx.size();
+    for (int v = 0; v < 255; v++)
+    {
+      int added = 0;
+      for (int c = 0; c < K; c++)
+      {
+        left[c] += hist[v * K + c];
+        added += hist[v * K + c];
+      }
+      nLeft += added;
+      if (!added || (nLeft < TREE_MINLEAF) || (n - nLeft < TREE_MINLEAF))
+        continue;
+      double gl = 0, gr = 0;
+      for (int c = 0; c < K; c++)
+      {
+        gl += (double) left[c] * left[c];
+        gr += (double) (counts[c] - left[c]) * (counts[c] - left[c]);
+      }
+      double score = nLeft - gl / nLeft + (n - nLeft) - gr / (n - nLeft); // Weighted Gini impurity
+      if (score < bestScore)
+      {
+        bestScore = score;
+        bestFeature = f;
+        bestThreshold = v;
+      }
+    }
+  }
+  if (bestFeature < 0)
+    return node;
+
+  std::vector<int> l, r;
+  for (int i : idx)
+    (data[i].x[bestFeature] <= bestThreshold ? l : r).push_back(i);
+  idx.clear();
+  idx.shrink_to_fit();
+  int a = build(t, data, l, depth + 1, maxDepth, nbFeatures, rnd);
+  int b = build(t, data, r, depth + 1, maxDepth, nbFeatures, rnd);
+  if ((t.nodes[a].feature < 0) && (t.nodes[b].feature < 0) && (t.nodes[a].label == t.nodes[b].label))
+  {
+    t.nodes[node].label = t.nodes[a].label; // Same answer on both sides : no comparison (a and b are the last nodes)
+    t.nodes.resize(node + 1);
+    return node;
+  }
+  t.nodes[node].feature = bestFeature;
+  t.nodes[node].threshold = bestThreshold;
+  t.nodes[node].left = a;
+  t.nodes[node].right = b;
+  return node;
+}
+
+static std::vector<Tree> train(const std::vector<Sample> &data, int nbTrees, int maxDepth, uint32_t seed)
+{
+  std::vector<Tree> forest(nbTrees);
+  CWNoise rnd;
+  rnd.seed = seed;
+  for (Tree &t : forest)
+  {
+    std::vector<int> idx(data.size());
+    for (size_t i = 0; i < data.size(); i++)
+      idx[i] = (nbTrees == 1) ? i : (size_t) (rnd.uniform() * data.size()) % data.size(); // Bootstrap
+    build(t, data, idx, 0, maxDepth, (nbTrees == 1) ? MAXTIMES : 4, rnd);
+  }
+  return forest;
+}
+
+static int predict(const std::vector<Tree> &forest, const uint8_t *x)
+{
+  int votes[256] = { 0 };
+  int best = 0;
+  for (const Tree &t : forest)
+  {
+    int n = 0;
+    while (t.nodes[n].feature >= 0)
+      n = (x[t.nodes[n].feature] <= t.nodes[n].threshold) ? t.nodes[n].left : t.nodes[n].right;
+    int l = t.nodes[n].label;
+    if ((++votes[l] > votes[best]) || ((votes[l] == votes[best]) && (l < best)))
+      best = l;
+  }
+  return best;
+}
+
+// CodeToChar() reference : . or - by a 2 units threshold, then the code table of the decoder
+static char baseline(const Sample &s)
+{
+  char code[bufSize];
+  int n = 0;
+  for (int i = 0; (i < MAXTIMES) && (s.times[i] > 0) && (n < bufSize - 1); i += 2)
+    code[n++] = (s.times[i] < 2 * s.unit) ? '.' : '-';
+  code[n] = 0;
+  return CWDecoder::toChar(code);
+}
+
+static double accuracy(const std::vector<Sample> &test, const std::vector<Tree> &forest)
+{
+  size_t ok = 0;
+  for (const Sample &s : test)
+    if (predict(forest, s.x) == s.label)
+      ok++;
+  return test.empty() ? 0 : (double) ok / test.size();
+}
+
+static size_t nbNodes(const std::vector<Tree> &forest)
+{
+  size_t n = 0;
+  for (const Tree &t : forest)
+    n += t.nodes.size();
+  return n;
+}
+
+// Comparisons per classification : average path length on the test rows
+static double comparisons(const std::vector<Sample> &test, const std::vector<Tree> &forest)
+{
+  size_t sum = 0;
+  for (const Sample &s : test)
+    for (const Tree &t : forest)
+      for (int n = 0; t.nodes[n].feature >= 0; sum++)
+        n = (s.x[t.nodes[n].feature] <= t.nodes[n].threshold) ? t.nodes[n].left : t.nodes[n].right;
+  return test.empty() ? 0 : (double) sum / test.size();
+}
+
+static void emitNode(std::string &out, const Tree &t, int n, int indent, bool single)
+{
+  std::string pad(indent, ' ');
+  const Node &node = t.nodes[n];
+  if (node.feature < 0)
+  {
+    char c = labels[node.label];
+    if (single)
+      out += pad + "return '" + std::string((c == '\'') || (c == '\\') ? "\\" : "") + c + "';\n";
+    else
+      out += pad + "return " + std::to_string(node.label) + ";\n";
+    return;
+  }
+  out += pad + "if (x[" + std::to_string(node.feature) + "] <= " + std::to_string(node.threshold) + ")\n";
+  bool leafLeft = t.nodes[node.left].feature < 0;
+  out += leafLeft ? "" : pad + "{\n";
+  emitNode(out, t, node.left, indent + 2, single);
+  out += leafLeft ? "" : pad + "}\n";
+  out += pad + "else\n";
+  bool leafRight = t.nodes[node.right].feature < 0;
+  out += leafRight ? "" : pad + "{\n";
+  emitNode(out, t, node.right, indent + 2, single);
+  out += leafRight ? "" : pad + "}\n";
+}
+
+static bool writeCode(const char *fileName, const std::vector<Tree> &forest, double acc, double accBaseline, size_t nbRows)
+{
+  std::string out;
+  char line[256];
+  out += "/*\n F4LAA : Classification des caractères (voir CWTree.h)\n\n   Généré par tools/cwtree : ne pas modifier.\n";
+  snprintf(line, sizeof(line), "   %zu arbre(s), %zu nœuds, %zu lignes d'apprentissage : %.1f%% de bons caractères (CodeToChar %.1f%%)\n*/\n",
+           forest.size(), nbNodes(forest), nbRows, 100 * acc, 100 * accBaseline);
+  out += line;
+  out += "#ifndef CWTreeCode_h\n#define CWTreeCode_h\n\n#include \"CWTree.h\"\n\n";
+  bool single = forest.size() == 1;
+  for (size_t k = 0; k < forest.size(); k++)
+  {
+    out += "static inline " + std::string(single ? "char" : "int") + " cwTree" + std::to_string(k) + "(const uint8_t *x)\n{\n";
+    emitNode(out, forest[k], 0, 2, single);
+    out += "}\n\n";
+  }
+  out += "inline char cwTreeClassify(const int times[MAXTIMES], int unit)\n{\n  uint8_t x[MAXTIMES];\n  cwTreeFeatures(times, unit, x);\n";
+  if (single)
+    out += "  return cwTree0(x);\n}\n";
+  else
+  {
+    // Majority vote, ties to the lowest class as in the trainer
+    std::string escaped;
+    for (char c : labels)
+      escaped += std::string((c == '"') || (c == '\\') ? "\\" : "") + c;
+    out += "  uint8_t votes[" + std::to_string(labels.size()) + "] = { 0 };\n  int best = 0, l;\n";
+    for (size_t k = 0; k < forest.size(); k++)
+      out += "  l = cwTree" + std::to_string(k) + "(x);\n"
+             "  if ((++votes[l] > votes[best]) || ((votes[l] == votes[best]) && (l < best)))\n    best = l;\n";
+    out += "  return \"" + escaped + "\"[best];\n}\n";
+  }
+  out += "\n#endif\n";
+  std::ofstream f(fileName);
+  f << out;
+  return (bool) f;
+}
+
+int main(int argc, char **argv)
+{
+  if ((argc < 3) || (strcmp(argv[1], "train") && strcmp(argv[1], "bench")))
+  {
+    fprintf(stderr, "Usage : cwtree train data.cwds|dataSet.csv [-t trees] [-d depth] [-s seed] [-o include/CWTreeCode.h]\n"
+                    "        cwtree bench data.cwds|dataSet.csv\n");
+    return 1;
+  }
+  int nbTrees = 1, depth = 10;
+  uint32_t seed = 1;
+  const char *outName = "include/CWTreeCode.h";
+  for (int i = 3; i + 1 < argc; i += 2)
+  {
+    if (!strcmp(argv[i], "-t")) nbTrees = atoi(argv[i + 1]);
+    if (!strcmp(argv[i], "-d")) depth = atoi(argv[i + 1]);
+    if (!strcmp(argv[i], "-s")) seed = atoi(argv[i + 1]);
+    if (!strcmp(argv[i], "-o")) outName = argv[i + 1];
+  }
+
+  std::vector<DataSetRow> rows;
+  if (!loadRows(argv[2], rows))
+  {
+    fprintf(stderr, "Can't read %s\n", argv[2]);
+    return 1;
+  }
+  std::vector<Sample> all = makeSamples(rows), trainSet, test;
+  for (size_t i = 0; i < all.size(); i++)
+    (i % TREE_TESTEVERY ? trainSet : test).push_back(all[i]);
+  size_t okBaseline = 0;
+  for (const Sample &s : test)
+    if (baseline(s) == labels[s.label])
+      okBaseline++;
+  double accBaseline = test.empty() ? 0 : (double) okBaseline / test.size();
+  printf("%zu rows, %zu labels : %zu for training, %zu for test ; CodeToChar %.1f%%\n",
+         all.size(), labels.size(), trainSet.size(), test.size(), 100 * accBaseline);
+
+  if (!strcmp(argv[1], "bench"))
+  {
+#ifdef CWTREE_BENCH
+    // The generated code against the code table, on the same rows
+    size_t okTree = 0;
+    volatile char sink;
+    auto t0 = std::chrono::steady_clock::now();
+    for (const Sample &s : all)
+      sink = baseline(s);
+    auto t1 = std::chrono::steady_clock::now();
+    for (const Sample &s : all)
+      sink = cwTreeClassify(s.times, s.unit);
+    auto t2 = std::chrono::steady_clock::now();
+    (void) sink;
+    for (const Sample &s : test)
+      if (cwTreeClassify(s.times, s.unit) == labels[s.label])
+        okTree++;
+    double n = all.empty() ? 1 : all.size();
+    printf("CWTreeCode.h : %.1f%% on the test rows, %.0f ns per character (CodeToChar %.0f ns)\n",
+           100.0 * okTree / (test.empty() ? 1 : test.size()),
+           std::chrono::duration<double, std::nano>(t2 - t1).count() / n,
+           std::chrono::duration<double, std::nano>(t1 - t0).count() / n);
+    return 0;
+#else
+    fprintf(stderr, "Build with -DCWTREE_BENCH to include include/CWTreeCode.h\n");
+    return 1;
+#endif
+  }
+
+  // Trade-offs
+  printf("trees depth  accuracy   nodes  comparisons\n");
+  for (int t : { 1, 5, 15 })
+    for (int d : { 6, 9, 12, 16 })
+    {
+      std::vector<Tree> f = train(trainSet, t, d, seed);
+      printf("%5d %5d    %5.1f%%  %6zu  %11.1f\n", t, d, 100 * accuracy(test, f), nbNodes(f), comparisons(test, f));
+    }
+
+  std::vector<Tree> forest = train(trainSet, nbTrees, depth, seed);
+  double acc = accuracy(test, forest);
+  printf("%d tree(s), depth %d : %.1f%% (CodeToChar %.1f%%), %zu nodes\n", nbTrees, depth, 100 * acc, 100 * accBaseline, nbNodes(forest));
+  if (!writeCode(outName, forest, acc, accBaseline, trainSet.size()))
+  {
+    fprintf(stderr, "Can't write %s\n", outName);
+    return 1;
+  }
+  printf("%s written\n", outName);
+  return 0;
+}
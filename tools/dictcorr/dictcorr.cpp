@@ -0,0 +1,112 @@
+/*
+ F4LAA : Mesure du WordCorrector sur de l'audio synthétique manipulé irrégulièrement
+
+   Usage : dictcorr [noise]
+   Pour chaque irrégularité de manipulation (jitter) : CER sans et avec correction,
+   mots corrigés à tort / à raison, et temps de correction par mot (moyen et max).
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "CWSynth.h"
+#include "Cer.h"
+#include "HostDecoder.h"
+#include "WordCorrector.h"
+
+struct Condition
+{
+  const char *name;
+  float wpm;
+  float jitter;
+};
+
+int main(int argc, char **argv)
+{
+  float noise = (argc > 1) ? atof(argv[1]) : 0;
+  const char *text = "cq cq de f4laa f4laa k f4laa de hb9f ga om tnx fer call ur rst 599 5nn "
+                     "qth paris name jean hw? f4laa de hb9f r r tnx fer rprt ur rst 579 "
+                     "wx sunny temp 20 c rig ic7300 pwr 100 w ant dipole "
+                     "qsl via bureau tnx fer qso 73 es gl f4laa de hb9f sk";
+  const Condition conditions[] = {
+    { "20 wpm, jitter  0%", 20, 0 },
+    { "20 wpm, jitter 10%", 20, 0.10 },
+    { "20 wpm, jitter 20%", 20, 0.20 },
+    { "20 wpm, jitter 25%", 20, 0.25 },
+    { "25 wpm, jitter 20%", 25, 0.20 },
+    { "15 wpm, jitter 25%", 15, 0.25 },
+  };
+
+  printf("WordCorrector : %zu bytes RAM (budget %d), beam %d\n\n", sizeof(WordCorrector), CORR_RAMBUDGET, CORR_BEAM);
+  printf("%-20s %8s %8s %8s %8s %10s %10s\n", "condition", "CER raw", "CER dict", "fixed", "broken", "us/word", "max us");
+  for (const Condition &c : conditions)
+  {
+    CWSynthParams sp;
+    sp.wpm = c.wpm;
+    sp.jitter = c.jitter;
+    sp.noise = noise;
+    std::string reference = std::string(text) + " " + text;
+    double cerRaw = 0, cerDict = 0;
+    int fixed = 0, broken = 0;
+    double totalUs = 0, maxUs = 0;
+    long nbWords = 0;
+    const int nbRuns = 10;
+    for (int run = 0; run < nbRuns; run++)
+    {
+      std::vector<float> audio = cwSynth(reference, sp, 1 + run);
+      HostDecoderParams hp;
+      hp.freq = sp.freq;
+      HostDecoder hd(hp);
+      std::string raw = hd.decode(audio, sp.rate);
+
+      // Same as the firmware : the word is corrected at the word space
+      WordCorrector corrector;
+      std::string corrected;
+      std::string rawWord;
+      auto flush = [&]() {
+        char word[CORR_MAXCHARS + 1];
+        uint8_t conf[CORR_MAXCHARS];
+        auto t0 = std::chrono::steady_clock::now();
+        int n = corrector.correct(word, conf);
+        double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+        totalUs += us;
+        if (us > maxUs)
+          maxUs = us;
+        nbWords++;
+        std::string w(word, n);
+        if (corrector.changed)
+        {
+          // Right or wrong : is the word in the reference ?
+          if ((" " + reference + " ").find(" " + w + " ") != std::string::npos)
+            fixed++;
+          else
+            broken++;
+        }
+        corrected += w;
+        rawWord.clear();
+      };
+      for (const DecodedChar &d : hd.chars)
+      {
+        if (d.c == ' ')
+        {
+          if (corrector.wordLen > 0)
+            flush();
+          corrected += ' ';
+          continue;
+        }
+        if (!corrector.add(d))
+        {
+          flush();
+          corrector.add(d);
+        }
+        rawWord += d.c;
+      }
+      if (corrector.wordLen > 0)
+        flush();
+      cerRaw += cer(reference, raw);
+      cerDict += cer(reference, corrected);
+    }
+    printf("%-20s %7.1f%% %7.1f%% %8d %8d %10.2f %10.2f\n", c.name, 100 * cerRaw / nbRuns, 100 * cerDict / nbRuns,
+           fixed, broken, totalUs / nbWords, maxUs);
+  }
+  return 0;
+}
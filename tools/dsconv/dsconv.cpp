@@ -0,0 +1,175 @@
+/*
+ F4LAA : Conversion des jeux de données printTimes (texte) <==> format binaire en colonnes (DataSet.h)
+
+   Usage : dsconv in.csv|in.txt|serial.log out.cwds [-r sampleRate] [-w wpm] [-s source]
+           dsconv in.cwds out.csv                   retour au texte (c;t0;...;t10)
+           dsconv in.cwds                           entête, lignes par étiquette, temps de chargement
+   Les lignes qui ne sont pas au format printTimes (log série : graph, trace, SPOT, ...) sont ignorées.
+   Sans -w, le WPM est estimé sur les durées (point = quartile bas des durées de son).
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "DataSet.h"
+
+static bool isDataSet(const char *fileName)
+{
+  FILE *f = fopen(fileName, "rb");
+  if (!f)
+    return false;
+  char magic[4] = { 0 };
+  size_t n = fread(magic, 1, 4, f);
+  fclose(f);
+  return (n == 4) && !memcmp(magic, "CWDS", 4);
+}
+
+// Dot = first quartile of the marks (about half of the marks are dots)
+static float estimateWpm(const std::vector<DataSetRow> &rows)
+{
+  std::vector<int16_t> marks;
+  for (const DataSetRow &r : rows)
+    for (int i = 0; i < MAXTIMES; i += 2)
+      if (r.times[i] > 0)
+        marks.push_back(r.times[i]);
+  if (marks.empty())
+    return 0;
+  std::nth_element(marks.begin(), marks.begin() + marks.size() / 4, marks.end());
+  int dot = marks[marks.size() / 4];
+  return (dot > 0) ? 1200.0f / dot : 0;
+}
+
+static int toBinary(const char *inName, const char *outName, float sampleRate, float wpm, const char *source)
+{
+  FILE *f = fopen(inName, "rb");
+  if (!f)
+  {
+    fprintf(stderr, "Can't read %s\n", inName);
+    return 1;
+  }
+  auto t0 = std::chrono::steady_clock::now();
+  std::vector<DataSetRow> rows;
+  long nbLines = 0;
+  char line[1024];
+  DataSetRow row;
+  while (fgets(line, sizeof(line), f))
+  {
+    nbLines++;
+    if (parseTimesLine(line, row))
+      rows.push_back(row);
+  }
+  fclose(f);
+  if (wpm == 0)
+    wpm = estimateWpm(rows);
+  if (!source)
+  {
+    source = strrchr(inName, '/');
+    source = source ? source + 1 : inName;
+  }
+  long n = writeDataSet(outName, rows, source, sampleRate, wpm);
+  double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+  if (n < 0)
+  {
+    fprintf(stderr, "Can't write %s\n", outName);
+    return 1;
+  }
+  printf("%ld lines, %zu rows, %ld written (%zu unknown labels), %.1f WPM ==> %s in %.1f ms\n",
+         nbLines, rows.size(), n, rows.size() - n, wpm, outName, ms);
+  return 0;
+}
+
+static int toText(const DataSetFile &ds, const char *outName)
+{
+  FILE *f = fopen(outName, "wb");
+  if (!f)
+  {
+    fprintf(stderr, "Can't write %s\n", outName);
+    return 1;
+  }
+  const int16_t *times[MAXTIMES];
+  for (int i = 0; i < MAXTIMES; i++)
+    times[i] = ds.times(i);
+  for (uint32_t r = 0; r < ds.nbRows(); r++)
+  {
+    fputc(ds.label(r), f);
+    for (int i = 0; i < MAXTIMES; i++)
+      fprintf(f, ";%d", times[i][r]);
+    fputc('\n', f);
+  }
+  fclose(f);
+  printf("%u rows ==> %s\n", ds.nbRows(), outName);
+  return 0;
+}
+
+static void info(const DataSetFile &ds, double openMs)
+{
+  const DataSetHeader &h = ds.header();
+  printf("CWDS version %d : %u rows x %d durations, %d labels \"%.*s\"\n",
+         h.version, h.nbRows, h.nbTimes, h.nbLabels, h.nbLabels, h.labels);
+  printf("source %s, ADC %.0f Hz, %.1f WPM\n", h.source, h.sampleRate, h.wpm);
+
+  // One pass over every column, as a training loop would
+  auto t0 = std::chrono::steady_clock::now();
+  long counts[256] = { 0 };
+  const uint8_t *labels = ds.labels();
+  for (uint32_t r = 0; r < h.nbRows; r++)
+    counts[labels[r]]++;
+  int64_t sums[MAXTIMES] = { 0 };
+  for (int i = 0; i < MAXTIMES; i++)
+  {
+    const int16_t *t = ds.times(i);
+    for (uint32_t r = 0; r < h.nbRows; r++)
+      sums[i] += t[r];
+  }
+  double passMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+  for (int l = 0; l < h.nbLabels; l++)
+    if (counts[l])
+      printf("%c %ld  ", h.labels[l], counts[l]);
+  printf("\nmean durations (ms) :");
+  for (int i = 0; i < MAXTIMES; i++)
+    printf(" %.0f", h.nbRows ? (double) sums[i] / h.nbRows : 0.0);
+  printf("\nopen %.3f ms, pass over all columns %.3f ms\n", openMs, passMs);
+}
+
+int main(int argc, char **argv)
+{
+  if (argc < 2)
+  {
+    fprintf(stderr, "Usage : dsconv in.csv|in.txt|serial.log out.cwds [-r sampleRate] [-w wpm] [-s source]\n"
+                    "        dsconv in.cwds [out.csv]\n");
+    return 1;
+  }
+  if (isDataSet(argv[1]))
+  {
+    auto t0 = std::chrono::steady_clock::now();
+    DataSetFile ds;
+    if (!ds.open(argv[1]))
+    {
+      fprintf(stderr, "%s : not a dataset version %d\n", argv[1], DS_VERSION);
+      return 1;
+    }
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    if (argc > 2)
+      return toText(ds, argv[2]);
+    info(ds, ms);
+    return 0;
+  }
+  if (argc < 3)
+  {
+    fprintf(stderr, "%s : not a dataset, give the output file\n", argv[1]);
+    return 1;
+  }
+  float sampleRate = 0, wpm = 0;
+  const char *source = 0;
+  for (int i = 3; i + 1 < argc; i += 2)
+  {
+    if (!strcmp(argv[i], "-r")) sampleRate = atof(argv[i + 1]);
+    if (!strcmp(argv[i], "-w")) wpm = atof(argv[i + 1]);
+    if (!strcmp(argv[i], "-s")) source = argv[i + 1];
+  }
+  return toBinary(argv[1], argv[2], sampleRate, wpm, source);
+}
@@ -0,0 +1,71 @@
+/*
+ F4LAA : Comparaison des modèles de temps TIMING_G6EJD et TIMING_ADAPTIVE
+         sur de l'audio synthétique (Farnsworth, pondération, vitesse)
+
+   Usage : farnsworth [noise]
+   Affiche le CER de chaque modèle, et les rapports mesurés par le modèle adaptatif.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include "CWSynth.h"
+#include "Cer.h"
+#include "HostDecoder.h"
+
+struct Condition
+{
+  const char *name;
+  float wpm;
+  float farnsworthWpm;
+  float dashRatio;
+};
+
+int main(int argc, char **argv)
+{
+  float noise = (argc > 1) ? atof(argv[1]) : 0;
+  const char *text = "cq cq de f4laa f4laa k the quick brown fox jumps over the lazy dog 0123456789 "
+                     "qrz? de hb9f hb9f ur rst 599 5nn bk tu 73 sk";
+  const Condition conditions[] = {
+    { "standard 15", 15, 0, 3 },
+    { "standard 25", 25, 0, 3 },
+    { "standard 30", 30, 0, 3 },
+    { "farnsworth 18/10", 18, 10, 3 },
+    { "farnsworth 25/12", 25, 12, 3 },
+    { "farnsworth 30/15", 30, 15, 3 },
+    { "weight 20 x2.5", 20, 0, 2.5 },
+    { "weight 20 x4.0", 20, 0, 4.0 },
+    { "weight 20 x4.5", 20, 0, 4.5 },
+    { "farns+weight 25/12 x4", 25, 12, 4.0 },
+  };
+
+  printf("%-24s %10s %10s   %9s %9s %9s\n", "condition", "CER G6EJD", "CER adapt", "dash/dot", "letterSp", "wordSp");
+  for (const Condition &c : conditions)
+  {
+    CWSynthParams sp;
+    sp.wpm = c.wpm;
+    sp.farnsworthWpm = c.farnsworthWpm;
+    sp.dashRatio = c.dashRatio;
+    sp.noise = noise;
+    // The text twice : the first pass lets the models learn the timing
+    std::string reference = std::string(text) + " " + text;
+    std::vector<float> audio = cwSynth(reference, sp);
+
+    double result[2];
+    HostDecoder *adaptive = 0;
+    for (int model = TIMING_G6EJD; model <= TIMING_ADAPTIVE; model++)
+    {
+      HostDecoderParams hp;
+      hp.freq = sp.freq;
+      hp.model = model;
+      HostDecoder *hd = new HostDecoder(hp);
+      result[model] = cer(reference, hd->decode(audio, sp.rate));
+      if (model == TIMING_ADAPTIVE)
+        adaptive = hd;
+      else
+        delete hd;
+    }
+    printf("%-24s %9.1f%% %9.1f%%   %9.2f %9.2f %9.2f\n", c.name, 100 * result[0], 100 * result[1],
+           adaptive->decoder.dashDotRatio(), adaptive->decoder.charSpaceScale(), adaptive->decoder.wordSpaceScale());
+    delete adaptive;
+  }
+  return 0;
+}
@@ -0,0 +1,199 @@
+/*
+ F4LAA : Recherche des glyphes des polices lissées (.vlw) de TFT_eSPI : index direct / trié contre recherche linéaire
+
+   Usage : glyphs [nbRepeats]
+   Polices .vlw générées en mémoire de 100, 1000 et 5000 glyphes (ASCII, Latin-1, puis CJK), dans l'ordre
+   de Processing (trié par code) ou avec l'ASCII à la fin (liste de caractères donnée à createFont()).
+   Pour chaque police :
+   - vérifie que getUnicodeIndex() donne le même résultat que la recherche linéaire pour les 65536 codes ;
+   - temps d'une recherche et nombre de comparaisons de la recherche linéaire pour une ligne de 33 caractères
+     comme DisplayLine ;
+   - temps du rendu de cette ligne (drawString, écran simulé TFT_LINUX_FB) avec l'index et sans (linéaire).
+   Code de retour non nul si une recherche diffère.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "TFT_eSPI.h"
+
+TFT_eSPI tft = TFT_eSPI();
+
+#define nbChars 33
+static const char line[nbChars + 1] = "CQ CQ DE F4LAA F4LAA PSE K 5NN BK";
+
+#define GLYPH_W 11
+#define GLYPH_H 16
+
+static void put32(std::vector<uint8_t> &v, uint32_t x)
+{
+  v.push_back(x >> 24);
+  v.push_back(x >> 16);
+  v.push_back(x >> 8);
+  v.push_back(x);
+}
+
+// .vlw : header, 28 bytes of metrics per glyph, then the bitmaps (1 byte alpha per pixel)
+static std::vector<uint8_t> makeFont(int nbGlyphs, bool asciiLast)
+{
+  std::vector<uint16_t> codes;
+  for (uint16_t c = 0x21; c < 0x7F && (int) codes.size() < nbGlyphs; c++)
+    codes.push_back(c);
+  for (uint16_t c = 0xA1; c <= 0xFF && (int) codes.size() < nbGlyphs; c++)
+    codes.push_back(c);
+  for (uint16_t c = 0x4E00; (int) codes.size() < nbGlyphs; c++)
+    codes.push_back(c);
+  if (asciiLast)
+  {
+    std::vector<uint16_t> reordered;
+    for (uint16_t c : codes)
+      if (c > 0xFF)
+        reordered.push_back(c);
+    for (uint16_t c : codes)
+      if (c <= 0xFF)
+        reordered.push_back(c);
+    codes = reordered;
+  }
+
+  std::vector<uint8_t> v;
+  put32(v, codes.size());
+  put32(v, 11);      // Version
+  put32(v, GLYPH_H); // Size
+  put32(v, 0);
+  put32(v, 13);      // Ascent
+  put32(v, 3);       // Descent
+  for (uint16_t c : codes)
+  {
+    put32(v, c);
+    put32(v, GLYPH_H);
+    put32(v, GLYPH_W);
+    put32(v, GLYPH_W + 2); // xAdvance
+    put32(v, 13);          // dY
+    put32(v, 1);           // dX
+    put32(v, 0);
+  }
+  for (uint16_t c : codes)
+    for (int y = 0; y < GLYPH_H; y++)
+      for (int x = 0; x < GLYPH_W; x++)
+        v.push_back(((x * 37 + y * 11 + c) % 5) ? 0 : 255 - ((x + y) * 8)); // Some alpha values
+  return v;
+}
+
+static bool linearIndex(uint16_t unicode, uint16_t *index)
+{
+  for (uint16_t i = 0; i < tft.gFont.gCount; i++)
+    if (tft.gUnicode[i] == unicode)
+    {
+      *index = i;
+      return true;
+    }
+  return false;
+}
+
+static double us(std::chrono::steady_clock::time_point t0)
+{
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+}
+
+// Best of 5 (at least 1 line each)
+static double renderLine(int nbRepeats)
+{
+  int perPass = std::max(1, nbRepeats / 5);
+  double best = 1e30;
+  for (int n = 0; n < 5; n++)
+  {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < perPass; r++)
+      tft.drawString(line, 0, 60 + (r % 10) * 20);
+    best = std::min(best, us(t0) / perPass);
+  }
+  return best;
+}
+
+static long nbErrors = 0;
+
+static void bench(int nbGlyphs, bool asciiLast, int nbRepeats)
+{
+  std::vector<uint8_t> font = makeFont(nbGlyphs, asciiLast);
+  tft.loadFont(font.data());
+
+  // Same results as the linear search for all the codes
+  long wrong = 0;
+  for (uint32_t c = 0; c <= 0xFFFF; c++)
+  {
+    uint16_t i1 = 0, i2 = 0;
+    bool f1 = tft.getUnicodeIndex(c, &i1);
+    bool f2 = linearIndex(c, &i2);
+    if ((f1 != f2) || (f1 && (i1 != i2)))
+      wrong++;
+  }
+  nbErrors += wrong;
+
+  // Lookups of the line (not the spaces : drawGlyph() and textWidth() do not search them)
+  char chars[nbChars + 1];
+  int nbLookups = 0;
+  for (int k = 0; k < nbChars; k++)
+    if (line[k] != ' ')
+      chars[nbLookups++] = line[k];
+  long comparisons = 0;
+  for (int k = 0; k < nbLookups; k++)
+  {
+    uint16_t i;
+    comparisons += linearIndex(chars[k], &i) ? i + 1 : tft.gFont.gCount;
+  }
+  volatile uint32_t sum = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < nbRepeats; r++)
+    for (int k = 0; k < nbLookups; k++)
+    {
+      uint16_t i = 0;
+      tft.getUnicodeIndex(chars[k], &i);
+      sum += i;
+    }
+  double indexUs = us(t0) * 1000 / (nbRepeats * nbLookups);
+  t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < nbRepeats; r++)
+    for (int k = 0; k < nbLookups; k++)
+    {
+      uint16_t i = 0;
+      linearIndex(chars[k], &i);
+      sum += i;
+    }
+  double linearUs = us(t0) * 1000 / (nbRepeats * nbLookups);
+
+  // Rendering of the line, with the index then without (the library falls back to the linear search)
+  double renderIndex = renderLine(nbRepeats);
+  uint16_t *latin1 = tft.gLatin1;
+  tft.gLatin1 = NULL;
+  double renderLinear = renderLine(nbRepeats);
+  tft.gLatin1 = latin1;
+
+  printf("%5d glyphs %-10s | lookup %6.1f ns (linear %8.1f ns, %5ld cmp / line) | line %7.1f us (linear %7.1f us) %s\n",
+         nbGlyphs, asciiLast ? "ASCII last" : "sorted", indexUs, linearUs, comparisons, renderIndex, renderLinear,
+         wrong ? "ERROR" : "");
+  tft.unloadFont();
+}
+
+int main(int argc, char **argv)
+{
+  int nbRepeats = (argc > 1) ? atoi(argv[1]) : 2000;
+  if (nbRepeats < 1)
+  {
+    fprintf(stderr, "Usage : glyphs [nbRepeats] (nbRepeats >= 1)\n");
+    return 2;
+  }
+  tft.init();
+  tft.setRotation(1);
+  tft.fillScreen(TFT_BLACK);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+
+  static const int sizes[] = { 100, 1000, 5000 };
+  for (int n : sizes)
+  {
+    bench(n, false, nbRepeats);
+    bench(n, true, nbRepeats);
+  }
+  printf("%ld errors\n", nbErrors);
+  return nbErrors ? 1 : 0;
+}
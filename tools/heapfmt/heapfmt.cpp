@@ -0,0 +1,142 @@
+/*
+ F4LAA : Allocations sur le tas de la télémétrie de loop() : concaténations de String (avant) contre TextBuf
+
+   Usage : heapfmt [file.wav]
+   Le WAV (test/MorseSample-15WPM.wav par défaut) est décodé par HostDecoder (étage DSP, puis étage de décision
+   bloc par bloc). A chaque bloc, la ligne de graph (magnitude, état, seuil) et la ligne de trace (bMoy, barG),
+   et pour chaque caractère la ligne de dataSet (printTimes), la ligne Dash/Dot de showTiming() et le suffixe
+   {conf} sont formatées comme avant (String) puis comme dans le firmware (TextBuf).
+   Les allocations sont comptées comme avec HEAP_STATS : malloc / calloc / realloc enveloppés à l'édition de liens
+   (src/HeapStats.cpp), new / delete passant par malloc / free.
+   Le String de tools/host/arduino (std::string) garde les textes courts sans allouer, comme celui de l'ESP32 :
+   le nombre d'allocations avant n'est qu'un ordre de grandeur, celui de TextBuf doit être 0.
+   Affiche aussi les lignes dont le texte diffère (arrondi des .5 exacts). Code de retour 1 si TextBuf alloue.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <new>
+#include <string>
+#include <vector>
+#include "Arduino.h"
+#include "Corpus.h"
+#include "HeapStats.h"
+#include "HostDecoder.h"
+#include "TextBuf.h"
+
+// new / delete through the wrapped malloc / free, as on the ESP32
+void *operator new(size_t size)
+{
+  void *p = malloc(size ? size : 1);
+  if (!p)
+    throw std::bad_alloc();
+  return p;
+}
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+
+struct Count
+{
+  uint32_t allocs = 0;
+  long lines = 0;
+};
+
+static Count before, after;
+static long nbDiff = 0;
+
+// Formats a line both ways ; the texts are compared outside of the counted sections
+template <class S, class T> static void both(S oldWay, T newWay)
+{
+  uint32_t a0 = heapAllocs;
+  String s = oldWay();
+  uint32_t a1 = heapAllocs;
+  TextBuf<96> t;
+  newWay(t);
+  uint32_t a2 = heapAllocs;
+  before.allocs += a1 - a0;
+  before.lines++;
+  after.allocs += a2 - a1;
+  after.lines++;
+  if (strcmp(s.c_str(), t.c_str()))
+  {
+    if (nbDiff < 5)
+      printf("  String \"%s\"  TextBuf \"%s\"\n", s.c_str(), t.c_str());
+    nbDiff++;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  const char *fileName = (argc > 1) ? argv[1] : "test/MorseSample-15WPM.wav";
+  RefFile ref;
+  if (!loadRefFile(fileName, ref))
+    return 2;
+  HostDecoderParams hp;
+  hp.freq = ref.freq;
+  HostDecoder hd(hp);
+  std::vector<HostBlock> blocks = hd.blocks(ref.wav.samples, ref.wav.rate);
+
+  CWDecoder decoder;
+  float bMoy = 0;
+  long cptMoy = 0;
+  float vMin = 1e9, vMax = -1e9;
+  for (const HostBlock &b : blocks)
+  {
+    decoder.process(b.magnitude, b.now);
+    float magnitude = b.magnitude;
+
+    // Graph line (loop())
+    if (magnitude < vMin) vMin = magnitude;
+    if (magnitude > vMax) vMax = magnitude;
+    int drawFilteredState = (decoder.filteredstate == HIGH) ? vMax + 1000 : vMin - 1000;
+    both([&] { return String(magnitude) + " " + String(drawFilteredState) + " " + String(decoder.magnitudelimit); },
+         [&](TextBuf<96> &t) { t.add(magnitude, 2).add(' ').add(drawFilteredState).add(' ').add(decoder.magnitudelimit); });
+
+    // Trace line (loop())
+    int barGraph = magnitude / 100;
+    if (barGraph > 100)
+      barGraph = 100;
+    bMoy = ((bMoy * cptMoy) + barGraph) / (cptMoy + 1);
+    cptMoy++;
+    both([&] { return "bMoy=" + String(bMoy) + "    barG=" + String(barGraph) + "   "; },
+         [&](TextBuf<96> &t) { t.add("bMoy=").add(bMoy, 2).add("    barG=").add(barGraph).add("   "); });
+
+    for (int i = 0; i < decoder.nbDecoded; i++)
+    {
+      const DecodedChar &d = decoder.decoded[i];
+      // dataSet line (printTimes())
+      both([&] {
+             String s = String(d.c);
+             for (int k = 0; k < MAXTIMES; k++)
+               s += ";" + String(d.times[k]);
+             return s;
+           },
+           [&](TextBuf<96> &t) {
+             t.add(d.c);
+             for (int k = 0; k < MAXTIMES; k++)
+               t.add(';').add(d.times[k]);
+           });
+      // Confidence (printChar())
+      both([&] { return "{" + String((int) d.confidence) + "}"; },
+           [&](TextBuf<96> &t) { t.add('{').add((int) d.confidence).add('}'); });
+      // Timing line (showTiming())
+      if (decoder.dotAvg > 0)
+        both([&] {
+               return "Dash/Dot=" + String(decoder.dashDotRatio(), 1) + " LtrSp=" + String(decoder.charSpaceScale(), 1)
+                      + " WordSp=" + String(decoder.wordSpaceScale(), 1) + "  ";
+             },
+             [&](TextBuf<96> &t) {
+               t.add("Dash/Dot=").add(decoder.dashDotRatio(), 1).add(" LtrSp=").add(decoder.charSpaceScale(), 1)
+                   .add(" WordSp=").add(decoder.wordSpaceScale(), 1).add("  ");
+             });
+    }
+  }
+
+  printf("%s : %zu blocks\n", ref.name.c_str(), blocks.size());
+  printf("String  : %ld lines, %u allocations\n", before.lines, before.allocs);
+  printf("TextBuf : %ld lines, %u allocations\n", after.lines, after.allocs);
+  printf("%ld line(s) with a different text\n", nbDiff);
+  return after.allocs ? 1 : 0;
+}
@@ -0,0 +1,186 @@
+/*
+ F4LAA : Host tools, génération d'audio CW synthétique à partir d'un texte
+
+   Vitesse (WPM), espacement Farnsworth (lettres et mots espacés comme à farnsworthWpm),
+   pondération (rapport dash / dot), irrégularité de manipulation (jitter), bruit blanc gaussien.
+   Défauts de propagation et d'émission : chirp (la fréquence glisse au début de chaque élément),
+   QSB (évanouissement périodique), parasites impulsionnels.
+   Fronts en cosinus surélevé (rise ms) pour éviter les clics.
+*/
+#ifndef CWSynth_h
+#define CWSynth_h
+
+#include <math.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+struct CWSynthParams
+{
+  int rate = 8000;          // samp/s
+  float freq = 640;         // Hz
+  float wpm = 20;
+  float farnsworthWpm = 0;  // 0 : standard spacing
+  float dashRatio = 3;      // dash / dot
+  float jitter = 0;         // Relative random variation of each mark and space (hand keying)
+  float amplitude = 0.5;
+  float noise = 0;          // White noise RMS
+  float rise = 5;           // ms
+  float leadIn = 500;       // ms of silence before and after
+  float chirp = 0;          // Hz : frequency offset at key down, decaying
+  float chirpTime = 10;     // ms : time constant of the chirp
+  float qsbDepth = 0;       // 0..1 : amplitude fading
+  float qsbPeriod = 5000;   // ms
+  float impulseRate = 0;    // Clicks per second
+  float impulseAmplitude = 1;
+};
+
+// Morse code of c, or NULL when c can't be sent
+inline const char *morseCode(char c)
+{
+  static const char *letters[26] = { ".-", "-...", "-.-.", "-..", ".", "..-.", "--.", "....", "..", ".---", "-.-", ".-..", "--",
+                                     "-.", "---", ".--.", "--.-", ".-.", "...", "-", "..-", "...-", ".--", "-..-", "-.--", "--.." };
+  static const char *digits[10] = { "-----", ".----", "..---", "...--", "....-", ".....", "-....", "--...", "---..", "----." };
+  if ((c >= 'A') && (c <= 'Z')) c += 'a' - 'A';
+  if ((c >= 'a') && (c <= 'z')) return letters[c - 'a'];
+  if ((c >= '0') && (c <= '9')) return digits[c - '0'];
+  switch (c)
+  {
+    case '?': return "..--..";
+    case '.': return ".-.-.-";
+    case ',': return "--..--";
+    case '!': return "-.-.--";
+    case '@': return ".--.-.";
+    case ':': return "---...";
+    case '-': return "-....-";
+    case '/': return "-..-.";
+    case '(': return "-.--.";
+    case ')': return "-.--.-";
+    case '_': return ".-...";
+    case '$': return "...-..-";
+    case '>': return "...-.-";
+    case '<': return ".-.-.";
+    case '~': return "...-.";
+  }
+  return 0;
+}
+
+// Key down / key up durations (ms), starting with key down. Characters without code are skipped.
+inline std::vector<float> cwTiming(const std::string &text, const CWSynthParams &p)
+{
+  float unit = 1200.0 / p.wpm;
+  float spaceUnit = unit;
+  if ((p.farnsworthWpm > 0) && (p.farnsworthWpm < p.wpm))
+  {
+    // ARRL Farnsworth : the characters keep their speed, the extra time goes to the 19 space units of "PARIS "
+    float total = (60000.0 / p.farnsworthWpm) - (31 * unit);
+    spaceUnit = total / 19;
+  }
+
+  std::vector<float> t;
+  float space = 0;
+  for (char c : text)
+  {
+    if (c == ' ')
+    {
+      if (!t.empty())
+        space = 7 * spaceUnit;
+      continue;
+    }
+    const char *code = morseCode(c);
+    if (!code)
+      continue;
+    if (!t.empty())
+    {
+      if (space == 0)
+        space = 3 * spaceUnit;
+      t.push_back(space);
+    }
+    for (const char *e = code; *e; e++)
+    {
+      if (e != code)
+        t.push_back(unit);
+      t.push_back((*e == '.') ? unit : unit * p.dashRatio);
+    }
+    space = 0;
+  }
+  return t;
+}
+
+// Simple reproducible gaussian noise (Box-Muller on a 32 bits LCG)
+struct CWNoise
+{
+  uint32_t seed = 1;
+  float uniform() { seed = seed * 1664525 + 1013904223; return ((seed >> 8) + 0.5f) / 16777216.0f; }
+  float gauss() { return sqrt(-2 * log(uniform())) * cos(2 * M_PI * uniform()); }
+};
+
+// keying : the durations really sent (with jitter), as cwTiming()
+inline std::vector<float> cwSynth(const std::string &text, const CWSynthParams &p, uint32_t seed = 1,
+                                  std::vector<float> *keying = 0)
+{
+  std::vector<float> timing = cwTiming(text, p);
+  std::vector<float> out;
+  CWNoise noise;
+  noise.seed = seed;
+  float riseSamples = p.rise * p.rate / 1000;
+  double phase = 0;
+
+  auto silence = [&](float ms) {
+    size_t n = ms * p.rate / 1000;
+    for (size_t i = 0; i < n; i++)
+      out.push_back(p.noise * noise.gauss());
+  };
+
+  silence(p.leadIn);
+  if (p.jitter > 0)
+    for (float &t : timing)
+    {
+      float k = 1 + p.jitter * noise.gauss();
+      t *= (k < 0.3) ? 0.3 : k;
+    }
+  if (keying)
+    *keying = timing;
+  for (size_t k = 0; k < timing.size(); k++)
+  {
+    if (k & 1)
+    {
+      silence(timing[k]);
+      continue;
+    }
+    size_t n = timing[k] * p.rate / 1000;
+    for (size_t i = 0; i < n; i++)
+    {
+      float env = 1;
+      if (i < riseSamples)
+        env = 0.5 - 0.5 * cos(M_PI * i / riseSamples);
+      else if (n - i < riseSamples)
+        env = 0.5 - 0.5 * cos(M_PI * (n - i) / riseSamples);
+      float chirp = (p.chirp != 0) ? p.chirp * exp(-1000.0 * i / (p.chirpTime * p.rate)) : 0;
+      phase += 2 * M_PI * (p.freq + chirp) / p.rate;
+      float qsb = 1;
+      if (p.qsbDepth > 0)
+        qsb -= p.qsbDepth * (0.5 + 0.5 * sin(2 * M_PI * out.size() * 1000.0 / (p.qsbPeriod * p.rate)));
+      out.push_back(p.amplitude * env * sin(phase) * qsb + p.noise * noise.gauss());
+    }
+  }
+  silence(p.leadIn);
+
+  // Clicks : own generator, the audio is the same without them
+  if (p.impulseRate > 0)
+  {
+    CWNoise clicks;
+    clicks.seed = seed ^ 0x5EED;
+    float decay = exp(-1000.0 / (0.5 * p.rate)); // 0.5 ms
+    for (size_t i = 0; i < out.size(); i++)
+      if (clicks.uniform() < p.impulseRate / p.rate)
+      {
+        float a = p.impulseAmplitude * ((clicks.uniform() < 0.5) ? -1 : 1);
+        for (size_t k = i; (k < out.size()) && (fabs(a) > 0.01); k++, a *= -decay)
+          out[k] += a;
+      }
+  }
+  return out;
+}
+
+#endif
@@ -0,0 +1,107 @@
+/*
+ F4LAA : Host tools, taux d'erreur caractères (CER) et mots (WER) par distance d'édition (Levenshtein)
+*/
+#ifndef Cer_h
+#define Cer_h
+
+#include <string>
+#include <vector>
+#include <sstream>
+
+template <class T>
+inline size_t editDistance(const std::vector<T> &a, const std::vector<T> &b)
+{
+  std::vector<size_t> prev(b.size() + 1), cur(b.size() + 1);
+  for (size_t j = 0; j <= b.size(); j++)
+    prev[j] = j;
+  for (size_t i = 1; i <= a.size(); i++)
+  {
+    cur[0] = i;
+    for (size_t j = 1; j <= b.size(); j++)
+    {
+      size_t sub = prev[j - 1] + (a[i - 1] == b[j - 1] ? 0 : 1);
+      size_t del = prev[j] + 1;
+      size_t ins = cur[j - 1] + 1;
+      cur[j] = sub < del ? (sub < ins ? sub : ins) : (del < ins ? del : ins);
+    }
+    prev.swap(cur);
+  }
+  return prev[b.size()];
+}
+
+// Alignment of b on a (edit distance backtrace) : for each a[i], the index of its match or
+// substitution in b, -1 when a[i] is deleted. O(a.size() * b.size()) memory.
+template <class T>
+inline std::vector<int> align(const std::vector<T> &a, const std::vector<T> &b)
+{
+  size_t w = b.size() + 1;
+  std::vector<unsigned> d((a.size() + 1) * w);
+  for (size_t j = 0; j <= b.size(); j++)
+    d[j] = j;
+  for (size_t i = 1; i <= a.size(); i++)
+  {
+    d[i * w] = i;
+    for (size_t j = 1; j <= b.size(); j++)
+    {
+      unsigned sub = d[(i - 1) * w + j - 1] + (a[i - 1] == b[j - 1] ? 0 : 1);
+      unsigned del = d[(i - 1) * w + j] + 1;
+      unsigned ins = d[i * w + j - 1] + 1;
+      d[i * w + j] = sub < del ? (sub < ins ? sub : ins) : (del < ins ? del : ins);
+    }
+  }
+  std::vector<int> match(a.size(), -1);
+  size_t i = a.size(), j = b.size();
+  while ((i > 0) && (j > 0))
+  {
+    if (d[i * w + j] == d[(i - 1) * w + j - 1] + (a[i - 1] == b[j - 1] ? 0 : 1))
+      match[--i] = --j;
+    else if (d[i * w + j] == d[(i - 1) * w + j] + 1)
+      i--;
+    else
+      j--;
+  }
+  return match;
+}
+
+// Lower case, single spaces, no leading / trailing space
+inline std::string normalizeText(const std::string &s)
+{
+  std::string out;
+  for (char c : s)
+  {
+    if ((c == ' ') || (c == '\n') || (c == '\r') || (c == '\t'))
+    {
+      if (!out.empty() && (out.back() != ' '))
+        out += ' ';
+    }
+    else
+      out += (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  }
+  while (!out.empty() && (out.back() == ' '))
+    out.pop_back();
+  return out;
+}
+
+// Character error rate of decoded against reference
+inline double cer(const std::string &reference, const std::string &decoded)
+{
+  std::string r = normalizeText(reference), d = normalizeText(decoded);
+  if (r.empty())
+    return d.empty() ? 0 : 1;
+  return (double) editDistance(std::vector<char>(r.begin(), r.end()), std::vector<char>(d.begin(), d.end())) / r.size();
+}
+
+// Word error rate of decoded against reference
+inline double wer(const std::string &reference, const std::string &decoded)
+{
+  std::vector<std::string> r, d;
+  std::string w;
+  std::istringstream rs(normalizeText(reference)), ds(normalizeText(decoded));
+  while (rs >> w) r.push_back(w);
+  while (ds >> w) d.push_back(w);
+  if (r.empty())
+    return d.empty() ? 0 : 1;
+  return (double) editDistance(r, d) / r.size();
+}
+
+#endif
@@ -0,0 +1,134 @@
+/*
+ F4LAA : Host tools, corpus de fichiers WAV avec leur transcription de référence
+
+   <nom>.wav et <nom>.txt dans un même répertoire. La première ligne "# freq 640" de la transcription
+   est facultative : sans elle, la fréquence du signal est cherchée sur le spectre.
+*/
+#ifndef Corpus_h
+#define Corpus_h
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "Cer.h"
+#include "Wav.h"
+
+#define CORPUS_MINFREQ 300
+#define CORPUS_MAXFREQ 1200
+
+struct RefFile
+{
+  std::string name;
+  Wav wav;
+  std::string reference;
+  float freq = 0;
+
+  double seconds() const { return wav.samples.size() / wav.rate; }
+};
+
+// Power of f over the whole file (Goertzel)
+inline double tonePower(const Wav &wav, float f)
+{
+  double coeff = 2 * cos(2 * M_PI * f / wav.rate);
+  double power = 0;
+  size_t block = wav.rate / 20; // 50 ms
+  for (size_t start = 0; start + block <= wav.samples.size(); start += block)
+  {
+    double q1 = 0, q2 = 0;
+    for (size_t i = start; i < start + block; i++)
+    {
+      double q0 = coeff * q1 - q2 + wav.samples[i];
+      q2 = q1;
+      q1 = q0;
+    }
+    power += q1 * q1 + q2 * q2 - q1 * q2 * coeff;
+  }
+  return power;
+}
+
+// Strongest tone : by 10 Hz, then by 1 Hz around it
+inline float findFreq(const Wav &wav)
+{
+  float best = CORPUS_MINFREQ;
+  double bestPower = -1;
+  for (float f = CORPUS_MINFREQ; f <= CORPUS_MAXFREQ; f += 10)
+  {
+    double p = tonePower(wav, f);
+    if (p > bestPower)
+    {
+      bestPower = p;
+      best = f;
+    }
+  }
+  float coarse = best;
+  for (float f = coarse - 9; f <= coarse + 9; f += 1)
+  {
+    double p = tonePower(wav, f);
+    if (p > bestPower)
+    {
+      bestPower = p;
+      best = f;
+    }
+  }
+  return best;
+}
+
+// One WAV file and its reference <name>.txt. Files skipped are reported on stdout.
+inline bool loadRefFile(const std::filesystem::path &path, RefFile &r)
+{
+  std::filesystem::path txt = path;
+  txt.replace_extension(".txt");
+  std::ifstream f(txt);
+  if (!f)
+  {
+    printf("%s : no reference (%s), skipped\n", path.filename().c_str(), txt.filename().c_str());
+    return false;
+  }
+  r.name = path.filename().string();
+  if (!readWav(path.string(), r.wav))
+  {
+    printf("%s : can't read, skipped\n", r.name.c_str());
+    return false;
+  }
+  std::string line;
+  while (std::getline(f, line))
+  {
+    if (!strncmp(line.c_str(), "# freq", 6))
+      r.freq = atof(line.c_str() + 6);
+    else
+      r.reference += line + " ";
+  }
+  r.reference = normalizeText(r.reference);
+  if (r.freq == 0)
+    r.freq = findFreq(r.wav);
+  return true;
+}
+
+// The WAV files of dir with a reference, sorted by name. The names of the others go to skipped.
+inline std::vector<RefFile> loadCorpus(const std::string &dir, std::vector<std::string> *skipped = nullptr)
+{
+  std::vector<RefFile> files;
+  std::vector<std::filesystem::path> paths;
+  std::error_code ec;
+  for (const auto &e : std::filesystem::directory_iterator(dir, ec))
+    if (e.path().extension() == ".wav")
+      paths.push_back(e.path());
+  std::sort(paths.begin(), paths.end());
+  for (const auto &path : paths)
+  {
+    RefFile r;
+    if (loadRefFile(path, r))
+      files.push_back(std::move(r));
+    else if (skipped)
+      skipped->push_back(path.filename().string());
+  }
+  return files;
+}
+
+#endif
@@ -0,0 +1,222 @@
+/*
+ F4LAA : Host tools, jeu de données binaire en colonnes (.cwds), lisible par mmap sans copie
+
+   Fichier :
+     DataSetHeader (160 octets)
+     colonne des étiquettes : nbRows x uint8 (index dans labels)
+     nbTimes colonnes de durées : nbRows x int16 (ms), chacune alignée sur 8 octets
+   Les offsets sont dans l'entête : un lecteur (numpy.memmap, ...) n'a pas besoin de connaître le calcul.
+   Little endian.
+*/
+#ifndef DataSet_h
+#define DataSet_h
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "CWDecoder.h"
+
+#define DS_VERSION 1
+#define DS_ALIGN 8
+#define DS_LABELS "abcdefghijklmnopqrstuvwxyz0123456789?.,!@:-/()_$><~{" // CodeToChar ('{' : unknown code)
+
+struct DataSetHeader
+{
+  char magic[4];        // "CWDS"
+  uint16_t version;     // DS_VERSION
+  uint16_t headerSize;  // sizeof(DataSetHeader)
+  uint32_t nbRows;
+  uint16_t nbTimes;     // MAXTIMES
+  uint16_t nbLabels;
+  float sampleRate;     // Hz of the ADC (or of the audio file), 0 : unknown
+  float wpm;            // 0 : unknown
+  uint64_t labelsOffset;
+  uint64_t timesOffset; // Column i at timesOffset + i * timesStride
+  uint64_t timesStride;
+  char source[48];      // Origin of the rows (file, serial log, cwgen, ...)
+  char labels[64];      // Label set, 0 terminated when shorter
+};
+
+struct DataSetRow
+{
+  char c;
+  int16_t times[MAXTIMES];
+};
+
+// "c;t0;...;t10" (printTimes, dataSet.csv / .txt), false for any other line of a serial log
+inline bool parseTimesLine(const char *line, DataSetRow &row)
+{
+  if (!line[0] || (line[1] != ';'))
+    return false;
+  row.c = line[0];
+  const char *p = line + 2;
+  for (int i = 0; i < MAXTIMES; i++)
+  {
+    char *end;
+    long v = strtol(p, &end, 10);
+    if ((end == p) || (v < 0))
+      return false;
+    row.times[i] = (v > INT16_MAX) ? INT16_MAX : (int16_t) v;
+    p = end;
+    if (i < MAXTIMES - 1)
+    {
+      if (*p != ';')
+        return false;
+      p++;
+    }
+  }
+  while ((*p == '\r') || (*p == '\n') || (*p == ' '))
+    p++;
+  return *p == 0;
+}
+
+inline uint64_t dsAlign(uint64_t v) { return (v + DS_ALIGN - 1) & ~(uint64_t) (DS_ALIGN - 1); }
+
+// Rows whose label is not in labels are skipped : returns the number of rows written, -1 on error
+inline long writeDataSet(const std::string &fileName, const std::vector<DataSetRow> &rows,
+                         const char *source, float sampleRate, float wpm, const char *labels = DS_LABELS)
+{
+  DataSetHeader h;
+  memset(&h, 0, sizeof(h));
+  memcpy(h.magic, "CWDS", 4);
+  h.version = DS_VERSION;
+  h.headerSize = sizeof(DataSetHeader);
+  h.nbTimes = MAXTIMES;
+  h.sampleRate = sampleRate;
+  h.wpm = wpm;
+  strncpy(h.source, source, sizeof(h.source) - 1);
+  h.nbLabels = strnlen(labels, sizeof(h.labels));
+  memcpy(h.labels, labels, h.nbLabels);
+
+  int index[256];
+  for (int i = 0; i < 256; i++)
+    index[i] = -1;
+  for (int i = 0; i < h.nbLabels; i++)
+    index[(uint8_t) h.labels[i]] = i;
+  std::vector<uint8_t> labelColumn;
+  std::vector<size_t> kept;
+  for (size_t r = 0; r < rows.size(); r++)
+    if (index[(uint8_t) rows[r].c] >= 0)
+    {
+      labelColumn.push_back(index[(uint8_t) rows[r].c]);
+      kept.push_back(r);
+    }
+  h.nbRows = kept.size();
+  h.labelsOffset = sizeof(DataSetHeader);
+  h.timesOffset = dsAlign(h.labelsOffset + h.nbRows);
+  h.timesStride = dsAlign(h.nbRows * sizeof(int16_t));
+
+  FILE *f = fopen(fileName.c_str(), "wb");
+  if (!f)
+    return -1;
+  std::vector<uint8_t> pad(DS_ALIGN, 0);
+  fwrite(&h, sizeof(h), 1, f);
+  fwrite(labelColumn.data(), 1, labelColumn.size(), f);
+  fwrite(pad.data(), 1, h.timesOffset - h.labelsOffset - h.nbRows, f);
+  std::vector<int16_t> column(kept.size());
+  for (int i = 0; i < MAXTIMES; i++)
+  {
+    for (size_t k = 0; k < kept.size(); k++)
+      column[k] = rows[kept[k]].times[i];
+    fwrite(column.data(), sizeof(int16_t), column.size(), f);
+    fwrite(pad.data(), 1, h.timesStride - column.size() * sizeof(int16_t), f);
+  }
+  bool ok = !ferror(f);
+  fclose(f);
+  return ok ? (long) h.nbRows : -1;
+}
+
+// Read only view of a .cwds file : the columns point into the mapped file
+class DataSetFile
+{
+  public:
+    ~DataSetFile() { close(); }
+
+    bool open(const std::string &fileName)
+    {
+      close();
+#ifndef _WIN32
+      int fd = ::open(fileName.c_str(), O_RDONLY);
+      if (fd < 0)
+        return false;
+      struct stat st;
+      if ((fstat(fd, &st) == 0) && (st.st_size > 0))
+      {
+        size = st.st_size;
+        void *p = mmap(0, size, PROT_READ, MAP_SHARED, fd, 0);
+        data = (p == MAP_FAILED) ? 0 : (const uint8_t *) p;
+      }
+      ::close(fd);
+#else
+      FILE *f = fopen(fileName.c_str(), "rb");
+      if (!f)
+        return false;
+      uint8_t buf[65536];
+      size_t n;
+      while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+        copy.insert(copy.end(), buf, buf + n);
+      fclose(f);
+      data = copy.data();
+      size = copy.size();
+#endif
+      if (!data || !valid())
+      {
+        close();
+        return false;
+      }
+      return true;
+    }
+
+    void close()
+    {
+#ifndef _WIN32
+      if (data)
+        munmap((void *) data, size);
+#else
+      copy.clear();
+#endif
+      data = 0;
+      size = 0;
+    }
+
+    const DataSetHeader &header() const { return *(const DataSetHeader *) data; }
+    uint32_t nbRows() const { return header().nbRows; }
+    const uint8_t *labels() const { return data + header().labelsOffset; }
+    const int16_t *times(int i) const { return (const int16_t *) (data + header().timesOffset + i * header().timesStride); }
+    char label(uint32_t row) const { return header().labels[labels()[row]]; }
+
+  private:
+    bool valid() const
+    {
+      if (size < sizeof(DataSetHeader))
+        return false;
+      const DataSetHeader &h = header();
+      if (memcmp(h.magic, "CWDS", 4) || (h.version != DS_VERSION) || (h.headerSize != sizeof(DataSetHeader))
+          || (h.nbTimes != MAXTIMES) || (h.nbLabels > sizeof(h.labels)))
+        return false;
+      if ((h.labelsOffset + h.nbRows > size) || (h.timesStride < (uint64_t) h.nbRows * sizeof(int16_t))
+          || (h.timesOffset % DS_ALIGN) || (h.timesOffset + h.nbTimes * h.timesStride > size))
+        return false;
+      for (uint32_t r = 0; r < h.nbRows; r++)
+        if (labels()[r] >= h.nbLabels)
+          return false;
+      return true;
+    }
+
+    const uint8_t *data = 0;
+    size_t size = 0;
+#ifdef _WIN32
+    std::vector<uint8_t> copy;
+#endif
+};
+
+#endif
@@ -0,0 +1,208 @@
+/*
+ F4LAA : Host tools, la chaîne de décodage de loop() sur PC
+
+   Audio (WAV ou synthétique) ==> échantillons "ADC" 12 bits ==> Resampler ==> Goertzel ==> CWDecoder
+   Les blocs sont contigus (pas de temps perdu entre 2 acquisitions comme sur l'ESP32),
+   nbSamples suit le WPM comme dans loop().
+*/
+#ifndef HostDecoder_h
+#define HostDecoder_h
+
+#include <string>
+#include <vector>
+#include "CWDecoder.h"
+#include "MagCapture.h"
+#include "Goertzel.h"
+#include "Resampler.h"
+#include "Profiler.h"
+
+#define HOST_ADCMIDPOINT 1940
+#define HOST_NBSAMPLEMIN 30
+#define HOST_NBSAMPLEMAX 250
+#define HOST_TAILSILENCE 3000 // ms
+#define HOST_TAILSTEP 10      // ms between 2 blocks of the silence
+
+struct HostDecoderParams
+{
+  float freq = 640;            // Goertzel frequency (no AFC)
+  int nbSamples = 100;         // Initial value
+  bool adaptNbSamples = true;  // nbSamples follows WPM (as in loop())
+  int model = TIMING_G6EJD;   // As CWDecoder
+  int nbTime = 6;
+  int spaceDetector = 5;
+  int magReactivity = 6;
+  float adcGain = 1500;        // [-1..1] ==> ADC units around HOST_ADCMIDPOINT
+};
+
+struct HostBlock
+{
+  float magnitude;
+  unsigned long now; // ms
+};
+
+class HostDecoder
+{
+  public:
+    explicit HostDecoder(const HostDecoderParams &params) : p(params) {}
+
+    std::string decode(const std::vector<float> &samples, float rate)
+    {
+      start();
+      std::string text;
+      runDsp(samples, rate, [&](float magnitude, unsigned long now, int nbSamples) {
+        process(magnitude, now, nbSamples);
+        collect(text);
+        return decoder.wpm;
+      });
+      tail(text);
+      return text;
+    }
+
+    // DSP stage only (Resampler, Goertzel), nbSamples fixed : the blocks do not depend on the decoder
+    // parameters and can be decoded many times by decodeBlocks()
+    std::vector<HostBlock> blocks(const std::vector<float> &samples, float rate)
+    {
+      std::vector<HostBlock> b;
+      HostDecoderParams fixed = p;
+      fixed.adaptNbSamples = false;
+      std::swap(p, fixed);
+      runDsp(samples, rate, [&](float magnitude, unsigned long now, int /* nbSamples */) {
+        b.push_back({ magnitude, now });
+        return 0;
+      });
+      std::swap(p, fixed);
+      return b;
+    }
+
+    // Decision stage on blocks from blocks() : same text as decode() with adaptNbSamples false
+    std::string decodeBlocks(const std::vector<HostBlock> &b)
+    {
+      start();
+      std::string text;
+      for (const HostBlock &block : b)
+      {
+        process(block.magnitude, block.now, p.nbSamples);
+        nbBlocks++;
+        lastNow = block.now;
+        collect(text);
+      }
+      tail(text);
+      return text;
+    }
+
+    CWDecoder decoder;
+    std::vector<DecodedChar> chars; // As decoded, with their elements and margins
+    long nbBlocks = 0;
+    MagCapture *capture = 0;        // Blocks captured as in loop() when set
+    EventTrace *events = 0;         // Journal of the decoder (tools/cwevents) when set
+
+  private:
+    void start()
+    {
+      decoder = CWDecoder();
+      decoder.model = p.model;
+      decoder.nbTime = p.nbTime;
+      decoder.spaceDetector = p.spaceDetector;
+      decoder.magReactivity = p.magReactivity;
+      decoder.events = events;
+      if (capture)
+        capture->clear();
+      chars.clear();
+      nbBlocks = 0;
+      lastNow = 0;
+      lastNbSamples = p.nbSamples;
+    }
+
+    void collect(std::string &text)
+    {
+      for (int i = 0; i < decoder.nbDecoded; i++)
+      {
+        text += decoder.decoded[i].c;
+        chars.push_back(decoder.decoded[i]);
+      }
+    }
+
+    // Then silence, so that the last character is decoded
+    void tail(std::string &text)
+    {
+      for (unsigned long now = lastNow; now < lastNow + HOST_TAILSILENCE; now += HOST_TAILSTEP)
+      {
+        process(0, now, lastNbSamples);
+        collect(text);
+      }
+    }
+
+    // Audio ==> blocks ==> block(magnitude, now, nbSamples), which returns the WPM that drives nbSamples
+    template <class F>
+    void runDsp(const std::vector<float> &samples, float rate, F block)
+    {
+      Resampler resampler;
+      resampler.setRates(rate, PROCESSING_FREQ);
+      Goertzel goertzel;
+      goertzel.setFreq(p.freq, PROCESSING_FREQ);
+
+      std::vector<int> adcData(resampler.inputCount(HOST_NBSAMPLEMAX));
+      int testData[HOST_NBSAMPLEMAX];
+      int nbSamples = p.nbSamples;
+      int sNewNbSamples = nbSamples;
+      int sDecoderWpm = 0;
+
+      size_t pos = 0;
+      for (;;)
+      {
+        size_t need = resampler.inputCount(nbSamples);
+        if (pos + need > samples.size())
+          break;
+        {
+          PROF_SCOPE(PROF_ACQ);
+          for (size_t i = 0; i < need; i++)
+          {
+            int v = HOST_ADCMIDPOINT + (int) (samples[pos + i] * p.adcGain);
+            adcData[i] = v < 0 ? 0 : (v > 4095 ? 4095 : v);
+          }
+        }
+        pos += need;
+        {
+          PROF_SCOPE(PROF_RESAMPLE);
+          resampler.process(adcData.data(), testData, nbSamples);
+        }
+
+        float magnitude;
+        {
+          PROF_SCOPE(PROF_GOERTZEL);
+          magnitude = goertzel.magnitude(testData, nbSamples, HOST_ADCMIDPOINT);
+        }
+        int wpm = block(magnitude, (unsigned long) (pos * 1000.0 / rate), nbSamples);
+        nbBlocks++;
+
+        if (p.adaptNbSamples && (wpm != sDecoderWpm))
+        {
+          // Same as loop()
+          sDecoderWpm = wpm;
+          int newNbSamples = ((wpm - 15) * (70 - 110)) / (33 - 15) + 110;
+          if (newNbSamples < HOST_NBSAMPLEMIN) newNbSamples = HOST_NBSAMPLEMIN;
+          if (newNbSamples > HOST_NBSAMPLEMAX) newNbSamples = HOST_NBSAMPLEMAX;
+          if (abs(newNbSamples - sNewNbSamples) > 2)
+            nbSamples = newNbSamples;
+          sNewNbSamples = newNbSamples;
+        }
+      }
+      lastNow = pos * 1000.0 / rate;
+      lastNbSamples = nbSamples;
+    }
+
+    void process(float magnitude, unsigned long now, int nbSamples)
+    {
+      PROF_SCOPE(PROF_DECODE);
+      if (capture)
+        capture->process(decoder, magnitude, now, true, nbSamples);
+      else
+        decoder.process(magnitude, now);
+    }
+
+    HostDecoderParams p;
+    unsigned long lastNow = 0;
+    int lastNbSamples = 0;
+};
+
+#endif
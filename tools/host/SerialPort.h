@@ -0,0 +1,52 @@
+/*
+ F4LAA : Outils PC, lecture du port série du décodeur (Linux, mode raw) ou d'un flux enregistré
+*/
+#ifndef SerialPort_h
+#define SerialPort_h
+
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+
+inline speed_t serialBaud(int baud)
+{
+  switch (baud)
+  {
+    case 9600: return B9600;
+    case 57600: return B57600;
+    case 115200: return B115200;
+    case 230400: return B230400;
+    case 460800: return B460800;
+    case 921600: return B921600;
+  }
+  return 0;
+}
+
+inline bool serialIsPort(const char *name)
+{
+  return !strncmp(name, "/dev/", 5);
+}
+
+// A port under /dev (raw, baud), or a file : the descriptor, -1 if it can't be opened
+inline int serialOpen(const char *name, int baud)
+{
+  if (!serialIsPort(name))
+    return open(name, O_RDONLY);
+  int fd = open(name, O_RDONLY | O_NOCTTY);
+  if (fd < 0)
+    return -1;
+  struct termios tio;
+  if (tcgetattr(fd, &tio) == 0)
+  {
+    cfmakeraw(&tio);
+    cfsetispeed(&tio, serialBaud(baud));
+    cfsetospeed(&tio, serialBaud(baud));
+    tio.c_cc[VMIN] = 1;
+    tio.c_cc[VTIME] = 0;
+    tcsetattr(fd, TCSANOW, &tio);
+  }
+  return fd;
+}
+
+#endif
@@ -0,0 +1,102 @@
+/*
+ F4LAA : Host tools, lecture / écriture de fichiers WAV (PCM 8 ou 16 bits, mono ou stéréo ==> mono)
+*/
+#ifndef Wav_h
+#define Wav_h
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+struct Wav
+{
+  float rate = 0;
+  std::vector<float> samples; // Mono, in [-1..1]
+};
+
+inline uint32_t wavLe32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24); }
+inline uint16_t wavLe16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+
+inline bool readWav(const std::string &fileName, Wav &wav)
+{
+  FILE *f = fopen(fileName.c_str(), "rb");
+  if (!f)
+    return false;
+  std::vector<uint8_t> b;
+  uint8_t buf[65536];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+    b.insert(b.end(), buf, buf + n);
+  fclose(f);
+  if ((b.size() < 12) || memcmp(&b[0], "RIFF", 4) || memcmp(&b[8], "WAVE", 4))
+    return false;
+
+  int channels = 1;
+  int bits = 16;
+  wav.samples.clear();
+  size_t p = 12;
+  while (p + 8 <= b.size())
+  {
+    uint32_t size = wavLe32(&b[p + 4]);
+    if (!memcmp(&b[p], "fmt ", 4) && (p + 24 <= b.size()))
+    {
+      channels = wavLe16(&b[p + 10]);
+      wav.rate = wavLe32(&b[p + 12]);
+      bits = wavLe16(&b[p + 22]);
+    }
+    else if (!memcmp(&b[p], "data", 4))
+    {
+      if ((bits != 8) && (bits != 16))
+        return false;
+      size_t frame = (bits / 8) * channels;
+      size_t end = (p + 8 + size < b.size()) ? p + 8 + size : b.size();
+      for (size_t q = p + 8; q + frame <= end; q += frame)
+      {
+        float v = 0;
+        for (int c = 0; c < channels; c++)
+          v += (bits == 16) ? (int16_t) wavLe16(&b[q + 2 * c]) / 32768.0 : (b[q + c] - 128) / 128.0;
+        wav.samples.push_back(v / channels);
+      }
+      return wav.rate > 0;
+    }
+    p += 8 + size + (size & 1);
+  }
+  return false;
+}
+
+inline bool writeWav(const std::string &fileName, const std::vector<float> &samples, int rate)
+{
+  FILE *f = fopen(fileName.c_str(), "wb");
+  if (!f)
+    return false;
+  uint32_t dataSize = samples.size() * 2;
+  uint8_t h[44];
+  memcpy(h, "RIFF", 4);
+  uint32_t v = 36 + dataSize;
+  memcpy(h + 4, &v, 4); // Little endian hosts only
+  memcpy(h + 8, "WAVEfmt ", 8);
+  v = 16;                      memcpy(h + 16, &v, 4);
+  uint16_t s = 1;              memcpy(h + 20, &s, 2); // PCM
+  s = 1;                       memcpy(h + 22, &s, 2); // Mono
+  v = rate;                    memcpy(h + 24, &v, 4);
+  v = rate * 2;                memcpy(h + 28, &v, 4);
+  s = 2;                       memcpy(h + 32, &s, 2);
+  s = 16;                      memcpy(h + 34, &s, 2);
+  memcpy(h + 36, "data", 4);
+  memcpy(h + 40, &dataSize, 4);
+  fwrite(h, 1, sizeof(h), f);
+  std::vector<int16_t> pcm(samples.size());
+  for (size_t i = 0; i < samples.size(); i++)
+  {
+    float x = samples[i];
+    if (x > 1) x = 1;
+    if (x < -1) x = -1;
+    pcm[i] = (int16_t) (x * 32767);
+  }
+  fwrite(pcm.data(), 2, pcm.size(), f);
+  return fclose(f) == 0;
+}
+
+#endif
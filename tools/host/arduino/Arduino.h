@@ -0,0 +1,191 @@
+/*
+ F4LAA : Arduino minimal pour compiler les librairies de l'ESP32 (TFT_eSPI) sur PC
+
+   Broches sans effet, delay() avance une horloge simulée (millis() / micros()) sans attendre,
+   String et Print réduits à ce que les librairies utilisent.
+*/
+#ifndef HostArduino_h
+#define HostArduino_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <string>
+#include <algorithm>
+#include <type_traits>
+
+using std::min;
+using std::max;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define MSBFIRST 1
+#define LSBFIRST 0
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t *) (addr))
+#define pgm_read_word(addr) hostReadWord(addr)
+#define pgm_read_dword(addr) hostReadDword(addr)
+#define pgm_read_ptr(addr) (*(void *const *) (addr))
+
+inline uint16_t hostReadWord(const void *addr)
+{
+  uint16_t v;
+  memcpy(&v, addr, sizeof(v));
+  return v;
+}
+
+// The libraries read pointers with pgm_read_dword() (32 bits on the ESP32) : pointer size here
+template <class T> inline uintptr_t hostReadDword(const T *addr)
+{
+  if constexpr (std::is_pointer<T>::value)
+    return (uintptr_t) *addr;
+  else
+  {
+    uint32_t v;
+    memcpy(&v, addr, sizeof(v));
+    return v;
+  }
+}
+inline uintptr_t hostReadDword(const void *addr) { return *(const uintptr_t *) addr; } // Tables of pointers
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+inline void pinMode(int, int) {}
+inline uint32_t digitalPinToBitMask(int pin) { return 1UL << (pin & 31); }
+inline void digitalWrite(int, int) {}
+inline int digitalRead(int) { return HIGH; }
+
+// Time : real time since the start, plus the delays (not waited)
+inline uint64_t &hostDelayUs()
+{
+  static uint64_t us = 0;
+  return us;
+}
+
+inline unsigned long micros()
+{
+  static auto t0 = std::chrono::steady_clock::now();
+  return (unsigned long) (std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0)
+                              .count() + hostDelayUs());
+}
+
+inline unsigned long millis() { return micros() / 1000; }
+inline void delay(unsigned long ms) { hostDelayUs() += ms * 1000ULL; }
+inline void delayMicroseconds(unsigned int us) { hostDelayUs() += us; }
+inline void yield() {}
+inline long random(long howbig) { return howbig ? rand() % howbig : 0; }
+inline long random(long howsmall, long howbig) { return howsmall + random(howbig - howsmall); }
+
+inline char *ltoa(long value, char *str, int base)
+{
+  char buf[8 * sizeof(long) + 2];
+  char *p = buf + sizeof(buf) - 1;
+  unsigned long v = ((value < 0) && (base == 10)) ? -(unsigned long) value : (unsigned long) value;
+  *p = 0;
+  do
+    *--p = "0123456789abcdefghijklmnopqrstuvwxyz"[v % base];
+  while (v /= base);
+  if ((value < 0) && (base == 10))
+    *--p = '-';
+  return strcpy(str, p);
+}
+
+class String
+{
+  public:
+    String() {}
+    String(const char *c) : s(c ? c : "") {}
+    String(const std::string &x) : s(x) {}
+    String(char c) : s(1, c) {}
+    String(int v) : s(std::to_string(v)) {}
+    String(unsigned int v) : s(std::to_string(v)) {}
+    String(long v) : s(std::to_string(v)) {}
+    String(unsigned long v) : s(std::to_string(v)) {}
+    explicit String(float v, unsigned int decimals = 2) : String((double) v, decimals) {}
+    explicit String(double v, unsigned int decimals = 2)
+    {
+      char buf[48];
+      snprintf(buf, sizeof(buf), "%.*f", (int) decimals, v);
+      s = buf;
+    }
+
+    const char *c_str() const { return s.c_str(); }
+    unsigned int length() const { return s.size(); }
+    char charAt(unsigned int i) const { return (i < s.size()) ? s[i] : 0; }
+    char operator[](unsigned int i) const { return charAt(i); }
+    void toCharArray(char *buf, unsigned int size) const
+    {
+      if (!size)
+        return;
+      unsigned int n = std::min((unsigned int) s.size(), size - 1);
+      memcpy(buf, s.data(), n);
+      buf[n] = 0;
+    }
+    bool endsWith(const String &x) const
+    {
+      return (s.size() >= x.s.size()) && !s.compare(s.size() - x.s.size(), x.s.size(), x.s);
+    }
+    String operator+(const String &o) const { return String(s + o.s); }
+    friend String operator+(const char *a, const String &b) { return String(std::string(a) + b.s); }
+    String &operator+=(const String &o)
+    {
+      s += o.s;
+      return *this;
+    }
+    bool operator==(const String &o) const { return s == o.s; }
+
+    std::string s;
+};
+
+class Print
+{
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+      size_t n = 0;
+      while (size--)
+        n += write(*buffer++);
+      return n;
+    }
+    size_t write(const char *str) { return str ? write((const uint8_t *) str, strlen(str)) : 0; }
+
+    size_t print(const char *str) { return write(str); }
+    size_t print(const String &str) { return write(str.c_str()); }
+    size_t print(char c) { return write((uint8_t) c); }
+    size_t print(long v) { return print(String(v)); }
+    size_t print(int v) { return print((long) v); }
+    size_t print(unsigned long v) { return print(String(v)); }
+    size_t print(unsigned int v) { return print((unsigned long) v); }
+    size_t print(double v, int digits = 2)
+    {
+      char buf[48];
+      snprintf(buf, sizeof(buf), "%.*f", digits, v);
+      return write(buf);
+    }
+    size_t println() { return write("\r\n"); }
+    template <class T> size_t println(const T &v) { return print(v) + println(); }
+};
+
+#endif
@@ -0,0 +1,2 @@
+// F4LAA : Print est dans Arduino.h (PC)
+#include "Arduino.h"
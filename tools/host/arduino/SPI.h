@@ -0,0 +1,15 @@
+/*
+ F4LAA : SPI sur PC : pas de bus, le processeur Linux de TFT_eSPI (TFT_eSPI_Linux) simule l'écran.
+   Sans SPI_HAS_TRANSACTION, TFT_eSPI change la fréquence par setFrequency() pour les lectures.
+*/
+#ifndef HostSPI_h
+#define HostSPI_h
+
+#include "Arduino.h"
+
+#define SPI_MODE0 0
+#define SPI_MODE1 1
+#define SPI_MODE2 2
+#define SPI_MODE3 3
+
+#endif
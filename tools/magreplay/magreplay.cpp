@@ -0,0 +1,171 @@
+/*
+ F4LAA : Rejoue une capture de l'étage de décision (MagCapture) sans l'étage DSP
+
+   Usage : magreplay capture.bin [-n nbTime] [-r magReactivity] [-b spaceDetector] [-m model]
+           magreplay -w file.wav capture.bin [freq]     capture d'un fichier WAV (chaîne de loop() sur PC)
+   La capture est le dump binaire de la commande 'X', seul ou au milieu d'un log série (après "CAPTURE;").
+   Sans option, chaque bloc doit redonner exactement le seuil et les états capturés : les écarts sont affichés.
+   Avec -n / -r / -b / -m, les paramètres capturés sont remplacés : seul le texte décodé compte.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "Wav.h"
+#include "HostDecoder.h"
+#include "MagCapture.h"
+
+static std::vector<CaptureBlock> blocks;
+static CaptureHeader header;
+
+static bool readCapture(const char *fileName)
+{
+  FILE *f = fopen(fileName, "rb");
+  if (!f)
+    return false;
+  std::vector<char> data;
+  char buf[65536];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+    data.insert(data.end(), buf, buf + n);
+  fclose(f);
+
+  // Raw dump, or the dump in a serial log
+  size_t pos = 0;
+  if ((data.size() < 4) || memcmp(data.data(), "CWCP", 4))
+  {
+    std::string s(data.begin(), data.end());
+    size_t p = s.rfind("CAPTURE;");
+    if (p == std::string::npos)
+      return false;
+    pos = s.find('\n', p);
+    if (pos == std::string::npos)
+      return false;
+    pos++;
+  }
+  if (data.size() < pos + sizeof(CaptureHeader))
+    return false;
+  memcpy(&header, &data[pos], sizeof(CaptureHeader));
+  if (memcmp(header.magic, "CWCP", 4) || (header.version != CAP_VERSION)
+      || (header.blockSize != sizeof(CaptureBlock)) || (header.stateSize != sizeof(CWDecoderState)))
+  {
+    fprintf(stderr, "%s : not a capture version %d\n", fileName, CAP_VERSION);
+    return false;
+  }
+  pos += sizeof(CaptureHeader);
+  size_t nb = (data.size() - pos) / sizeof(CaptureBlock);
+  if (nb < header.nbBlocks)
+    fprintf(stderr, "%s : %u blocks, %zu read (truncated)\n", fileName, header.nbBlocks, nb);
+  else
+    nb = header.nbBlocks;
+  blocks.resize(nb);
+  memcpy(blocks.data(), &data[pos], nb * sizeof(CaptureBlock));
+  return true;
+}
+
+static FILE *out;
+static void writeFile(const void *data, int len)
+{
+  fwrite(data, 1, len, out);
+}
+
+static int capture(const char *wavName, const char *capName, float freq)
+{
+  Wav wav;
+  if (!readWav(wavName, wav))
+  {
+    fprintf(stderr, "Can't read %s\n", wavName);
+    return 1;
+  }
+  HostDecoderParams hp;
+  hp.freq = freq;
+  HostDecoder hd(hp);
+  MagCapture *cap = new MagCapture;
+  hd.capture = cap;
+  printf("%s\n", hd.decode(wav.samples, wav.rate).c_str());
+
+  out = fopen(capName, "wb");
+  if (!out)
+  {
+    fprintf(stderr, "Can't write %s\n", capName);
+    return 1;
+  }
+  cap->dump(writeFile, wav.rate, PROCESSING_FREQ, freq);
+  fclose(out);
+  // The decoder also saw the silence added after the end of the file, so that its last character is decoded
+  long nbTail = HOST_TAILSILENCE / HOST_TAILSTEP;
+  printf("%ld blocks decoded : %ld from the WAV + %ld of silence after it\n", hd.nbBlocks + nbTail, hd.nbBlocks, nbTail);
+  printf("%d blocks captured%s ==> %s\n", cap->nbBlocks(),
+         (cap->nbBlocks() < hd.nbBlocks + nbTail) ? " (the last ones, CAP_BLOCKS)" : "", capName);
+  delete cap;
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  if ((argc > 3) && !strcmp(argv[1], "-w"))
+    return capture(argv[2], argv[3], (argc > 4) ? atof(argv[4]) : 640);
+  if ((argc < 2) || !readCapture(argv[1]))
+  {
+    fprintf(stderr, "Usage : magreplay capture.bin [-n nbTime] [-r magReactivity] [-b spaceDetector] [-m model]\n"
+                    "        magreplay -w file.wav capture.bin [freq]\n");
+    return 1;
+  }
+  int nbTime = -1, magReactivity = -1, spaceDetector = -1, model = -1;
+  for (int i = 2; i + 1 < argc; i += 2)
+  {
+    int v = atoi(argv[i + 1]);
+    if (!strcmp(argv[i], "-n")) nbTime = v;
+    if (!strcmp(argv[i], "-r")) magReactivity = v;
+    if (!strcmp(argv[i], "-b")) spaceDetector = v;
+    if (!strcmp(argv[i], "-m")) model = v;
+  }
+  bool check = (nbTime < 0) && (magReactivity < 0) && (spaceDetector < 0) && (model < 0);
+
+  printf("%zu blocks, ADC %.0f Hz ==> %.0f Hz, freq %.1f Hz\n",
+         blocks.size(), header.sampleRate, header.processingRate, header.freq);
+
+  CWDecoder decoder;
+  decoder.restore(header.state);
+  unsigned long now = header.state.now;
+  std::string text;
+  long nbWrong = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < blocks.size(); i++)
+  {
+    const CaptureBlock &b = blocks[i];
+    now += b.dt;
+    decoder.nbTime = (nbTime >= 0) ? nbTime : b.nbTime;
+    decoder.magReactivity = (magReactivity >= 0) ? magReactivity : b.magReactivity;
+    decoder.spaceDetector = (spaceDetector >= 0) ? spaceDetector : b.spaceDetector;
+    decoder.model = (model >= 0) ? model : ((b.flags & CAP_ADAPTIVE) ? TIMING_ADAPTIVE : TIMING_G6EJD);
+    decoder.process(b.magnitude, now, b.flags & CAP_DECODE);
+    for (int k = 0; k < decoder.nbDecoded; k++)
+      text += decoder.decoded[k].c;
+
+    if (check && ((decoder.magnitudelimit != b.threshold)
+                  || ((decoder.filteredstate != 0) != ((b.flags & CAP_HIGH) != 0))
+                  || ((decoder.realstate != 0) != ((b.flags & CAP_REAL) != 0))))
+    {
+      if (nbWrong < 10)
+        printf("block %zu (%lu ms) : threshold %d / %d, state %d / %d\n", i, now,
+               decoder.magnitudelimit, b.threshold, decoder.filteredstate, (b.flags & CAP_HIGH) ? 1 : 0);
+      nbWrong++;
+    }
+
+    // Calls of loop() after the block
+    if (b.flags & CAP_RESET)
+      decoder.resetTiming();
+    if (b.flags & CAP_CLEAR)
+      decoder.clearCodeBuffer();
+  }
+  double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+  printf("%s\n", text.c_str());
+  if (check)
+    printf("%ld blocks differ\n", nbWrong);
+  printf("%.1f s of signal replayed in %.2f ms\n", (now - header.state.now) / 1000.0, ms);
+  return nbWrong ? 2 : 0;
+}
@@ -0,0 +1,109 @@
+"""
+ F4LAA : Génération du trie du WordCorrector (include/DictTrie.h)
+
+   A partir de tools/mkdict/words.txt : un mot par ligne, lignes vides et commentaires (//) ignorés.
+   Voir words.txt pour les jokers # @ *. Les noeuds sont rangés en largeur d'abord : les fils d'un noeud
+   sont contigus, triés.
+
+   Lancé par PlatformIO avant chaque compilation (extra_scripts = pre:...) : le fichier n'est
+   regénéré que si words.txt est plus récent. Peut aussi être lancé à la main :
+     python3 tools/mkdict/mkdict.py
+"""
+import os
+from collections import deque
+
+DICT_MAXNODES = 65535
+
+
+class Node:
+    def __init__(self):
+        self.end = False
+        self.children = {}
+
+
+def load(path):
+    root = Node()
+    words = set()
+    with open(path, encoding="utf-8") as f:
+        for n, line in enumerate(f, 1):
+            line = line.rstrip("\r\n ")
+            if not line or line.startswith("//"):
+                continue
+            star = line.find("*")
+            if star >= 0 and star != len(line) - 1:
+                raise SystemExit("%s:%d: '*' must end the word : %s" % (path, n, line))
+            if line in words:
+                continue
+            words.add(line)
+            node = root
+            for c in line:
+                node = node.children.setdefault(c, Node())
+            node.end = True
+    return root, words
+
+
+# Breadth first numbering : (node, char, last child of its parent)
+def number(root):
+    order = []
+    todo = deque([(root, "", False)])
+    while todo:
+        entry = todo.popleft()
+        order.append(entry)
+        keys = sorted(entry[0].children)
+        for c in keys:
+            todo.append((entry[0].children[c], c, c == keys[-1]))
+    return order
+
+
+def generate(src, dst):
+    root, words = load(src)
+    order = number(root)
+    if len(order) > DICT_MAXNODES:
+        raise SystemExit("%s: too many nodes (%d)" % (src, len(order)))
+    index = {id(entry[0]): i for i, entry in enumerate(order)}
+    out = []
+    out.append("/*")
+    out.append(" F4LAA : Trie du WordCorrector")
+    out.append("")
+    out.append("   Généré par tools/mkdict/mkdict.py à partir de tools/mkdict/words.txt : ne pas modifier.")
+    out.append("   %d mots, %d noeuds, %d octets (flash)" % (len(words), len(order), len(order) * 4))
+    out.append("*/")
+    out.append("#ifndef DictTrie_h")
+    out.append("#define DictTrie_h")
+    out.append("")
+    out.append('#include "WordCorrector.h"')
+    out.append("")
+    out.append("#define DICT_NBWORDS %d" % len(words))
+    out.append("#define DICT_NBNODES %d" % len(order))
+    out.append("")
+    out.append("static const DictNode dictTrie[DICT_NBNODES] = {")
+    for node, c, last in order:
+        flags = (1 if node.end else 0) | (2 if last else 0)
+        child = index[id(node.children[min(node.children)])] if node.children else 0
+        if not c:
+            out.append("  {   0, %d, %4d }," % (flags, child))
+        elif c in "'\\":
+            out.append("  { '\\%s', %d, %4d }," % (c, flags, child))
+        else:
+            out.append("  { '%s', %d, %4d }," % (c, flags, child))
+    out.append("};")
+    out.append("")
+    out.append("#endif")
+    with open(dst, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out) + "\n")
+    print("mkdict: %s (%d words, %d nodes)" % (dst, len(words), len(order)))
+
+
+def run(root):
+    src = os.path.join(root, "tools", "mkdict", "words.txt")
+    dst = os.path.join(root, "include", "DictTrie.h")
+    if not os.path.exists(dst) or os.path.getmtime(src) > os.path.getmtime(dst):
+        generate(src, dst)
+
+
+try:
+    Import("env")  # PlatformIO pre-build script
+    run(env.subst("$PROJECT_DIR"))
+except NameError:
+    if __name__ == "__main__":
+        run(os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..")))
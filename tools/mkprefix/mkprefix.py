@@ -0,0 +1,130 @@
+"""
+ F4LAA : Génération de la table des préfixes d'indicatifs (include/PrefixTable.h)
+
+   A partir de tools/mkprefix/prefixes.txt : table de hachage à adressage ouvert (sondage linéaire),
+   FNV-1a 32 bits sur le préfixe (base xor PREFIX_HASHSEED, choisi pour raccourcir les sondages). La recherche du pays d'un indicatif essaie les préfixes de 4, 3, 2
+   puis 1 caractère, chacun en PREFIX_MAXPROBE sondages au plus : O(1).
+
+   Lancé par PlatformIO avant chaque compilation (extra_scripts = pre:...) : le fichier n'est
+   regénéré que si prefixes.txt est plus récent. Peut aussi être lancé à la main :
+     python3 tools/mkprefix/mkprefix.py
+"""
+import os
+
+PREFIX_MAXLEN = 4
+
+
+def fnv1a(s, seed):
+    h = 2166136261 ^ seed
+    for c in s.encode("ascii"):
+        h ^= c
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def load(path):
+    countries = []
+    prefixes = {}
+    with open(path, encoding="utf-8") as f:
+        for n, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith("//"):
+                continue
+            keys, name = line.split(None, 1)
+            countries.append(name)
+            for p in keys.split(","):
+                if not p or len(p) > PREFIX_MAXLEN or not p.isascii() or not p.isalnum() or p != p.lower():
+                    raise SystemExit("%s:%d: bad prefix '%s'" % (path, n, p))
+                if p in prefixes:
+                    raise SystemExit("%s:%d: prefix '%s' already in %s" % (path, n, p, countries[prefixes[p]]))
+                prefixes[p] = len(countries) - 1
+    return countries, prefixes
+
+
+def place(prefixes, size, seed):
+    slots = [None] * size
+    maxProbe = 1
+    for p in sorted(prefixes):
+        i = fnv1a(p, seed) & (size - 1)
+        probe = 1
+        while slots[i] is not None:
+            i = (i + 1) & (size - 1)
+            probe += 1
+        slots[i] = p
+        maxProbe = max(maxProbe, probe)
+    return slots, maxProbe
+
+
+# Power of 2 size >= 2 x prefixes, and the seed giving the shortest probe sequences
+def build(prefixes):
+    size = 1
+    while size < 2 * len(prefixes):
+        size *= 2
+    best = None
+    for seed in range(256):
+        slots, maxProbe = place(prefixes, size, seed)
+        if best is None or maxProbe < best[2]:
+            best = (seed, slots, maxProbe)
+    return (size,) + best
+
+
+def generate(src, dst):
+    countries, prefixes = load(src)
+    size, seed, slots, maxProbe = build(prefixes)
+    out = []
+    out.append("/*")
+    out.append(" F4LAA : Table des préfixes d'indicatifs ==> pays (SpotExtractor)")
+    out.append("")
+    out.append("   Généré par tools/mkprefix/mkprefix.py à partir de tools/mkprefix/prefixes.txt : ne pas modifier.")
+    out.append("   %d préfixes, %d pays, %d cases, %d sondages max" % (len(prefixes), len(countries), size, maxProbe))
+    out.append("*/")
+    out.append("#ifndef PrefixTable_h")
+    out.append("#define PrefixTable_h")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("#define PREFIX_MAXLEN %d" % PREFIX_MAXLEN)
+    out.append("#define PREFIX_HASHSIZE %d" % size)
+    out.append("#define PREFIX_HASHSEED %d" % seed)
+    out.append("#define PREFIX_MAXPROBE %d" % maxProbe)
+    out.append("#define PREFIX_NBCOUNTRIES %d" % len(countries))
+    out.append("")
+    out.append("struct PrefixSlot")
+    out.append("{")
+    out.append("  char prefix[PREFIX_MAXLEN]; // Not \\0 terminated when 4 chars, empty slot : \"\"")
+    out.append("  uint8_t country;")
+    out.append("};")
+    out.append("")
+    out.append("static const char *const prefixCountries[PREFIX_NBCOUNTRIES] = {")
+    for c in countries:
+        out.append('  "%s",' % c.replace('"', '\\"'))
+    out.append("};")
+    out.append("")
+    out.append("static const PrefixSlot prefixTable[PREFIX_HASHSIZE] = {")
+    for p in slots:
+        if p is None:
+            out.append('  { "", 0 },')
+        else:
+            chars = ", ".join("'%s'" % c for c in p)
+            out.append("  { { %s }, %d }," % (chars, prefixes[p]))
+    out.append("};")
+    out.append("")
+    out.append("#endif")
+    with open(dst, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out) + "\n")
+    print("mkprefix: %s (%d prefixes, %d probes max)" % (dst, len(prefixes), maxProbe))
+
+
+def run(root):
+    src = os.path.join(root, "tools", "mkprefix", "prefixes.txt")
+    dst = os.path.join(root, "include", "PrefixTable.h")
+    if not os.path.exists(dst) or os.path.getmtime(src) > os.path.getmtime(dst):
+        generate(src, dst)
+
+
+try:
+    Import("env")  # PlatformIO pre-build script
+    run(env.subst("$PROJECT_DIR"))
+except NameError:
+    if __name__ == "__main__":
+        run(os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..")))
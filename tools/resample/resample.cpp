@@ -0,0 +1,99 @@
+/*
+ F4LAA : Vérification du Resampler : un même enregistrement décodé à 8000, 11025, 22050 et 48000 Hz
+
+   Usage : resample [file.wav] [-m model] [-t tolerance%]
+   Le WAV (test/MorseSample-15WPM.wav par défaut, avec sa transcription <nom>.txt) est rééchantillonné sur PC
+   (sinc fenêtré, filtre passe-bas à la plus petite des 2 fréquences de Nyquist) à chaque fréquence, puis décodé
+   par HostDecoder : le Resampler du firmware (setRates(rate, PROCESSING_FREQ)) ramène chaque bloc à 11025 Hz.
+   Affiche le CER / WER à chaque fréquence et l'écart avec le décodage à la fréquence d'origine du fichier.
+   Code de retour 1 si un CER dépasse celui de la fréquence d'origine de plus de la tolérance (0 par défaut).
+*/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "Cer.h"
+#include "Corpus.h"
+#include "HostDecoder.h"
+
+#define SINC_ZEROS 16 // Zero crossings of the kernel on each side
+
+// Band-limited resampling (Blackman windowed sinc)
+static std::vector<float> resample(const std::vector<float> &in, float inRate, float outRate)
+{
+  double ratio = inRate / outRate;
+  double cutoff = (outRate < inRate) ? outRate / inRate : 1; // Of the input Nyquist frequency
+  double halfWidth = SINC_ZEROS / cutoff;                     // In input samples
+  size_t nbOut = (size_t) (in.size() / ratio);
+  std::vector<float> out(nbOut);
+  for (size_t j = 0; j < nbOut; j++)
+  {
+    double t = j * ratio;
+    long first = (long) ceil(t - halfWidth), last = (long) floor(t + halfWidth);
+    double sum = 0;
+    for (long k = first; k <= last; k++)
+    {
+      if ((k < 0) || (k >= (long) in.size()))
+        continue;
+      double x = (k - t) * cutoff;
+      double sinc = (x == 0) ? 1 : sin(M_PI * x) / (M_PI * x);
+      double w = 0.42 + 0.5 * cos(M_PI * x / SINC_ZEROS) + 0.08 * cos(2 * M_PI * x / SINC_ZEROS);
+      sum += in[k] * sinc * w;
+    }
+    out[j] = sum * cutoff;
+  }
+  return out;
+}
+
+int main(int argc, char **argv)
+{
+  std::string fileName = "test/MorseSample-15WPM.wav";
+  HostDecoderParams hp;
+  double tolerance = 0;
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-m") && (i + 1 < argc))
+      hp.model = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-t") && (i + 1 < argc))
+      tolerance = atof(argv[++i]) / 100;
+    else if (argv[i][0] != '-')
+      fileName = argv[i];
+    else
+    {
+      fprintf(stderr, "Usage : resample [file.wav] [-m model] [-t tolerance%%]\n");
+      return 2;
+    }
+  }
+
+  RefFile ref;
+  if (!loadRefFile(fileName, ref))
+    return 2;
+  hp.freq = ref.freq;
+
+  HostDecoder native(hp);
+  std::string text = native.decode(ref.wav.samples, ref.wav.rate);
+  double nativeCer = cer(ref.reference, text);
+  printf("%s : %.0f Hz, %.1f Hz tone, %s model\n", ref.name.c_str(), ref.wav.rate, ref.freq,
+         (hp.model == TIMING_ADAPTIVE) ? "adaptive" : "G6EJD");
+  printf("%6.0f Hz (native)  CER %5.1f%%  WER %5.1f%%\n", ref.wav.rate, 100 * nativeCer, 100 * wer(ref.reference, text));
+
+  static const float rates[] = { 8000, 11025, 22050, 48000 };
+  int nbFailed = 0;
+  for (float rate : rates)
+  {
+    std::vector<float> samples = (rate == ref.wav.rate) ? ref.wav.samples : resample(ref.wav.samples, ref.wav.rate, rate);
+    HostDecoder hd(hp);
+    std::string decoded = hd.decode(samples, rate);
+    double c = cer(ref.reference, decoded);
+    bool failed = c > nativeCer + tolerance + 1e-9;
+    nbFailed += failed;
+    printf("%6.0f Hz           CER %5.1f%%  WER %5.1f%%  (%+.1f%%) %s\n", rate, 100 * c, 100 * wer(ref.reference, decoded),
+           100 * (c - nativeCer), failed ? "REGRESSION" : "");
+    if (failed)
+      printf("  %s\n", decoded.c_str());
+  }
+  printf("%d regression(s)\n", nbFailed);
+  return nbFailed ? 1 : 0;
+}
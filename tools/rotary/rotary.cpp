@@ -0,0 +1,206 @@
+/*
+ F4LAA : Vérification de l'encodeur rotatif en mode interruption (lib/Rotary), sans le matériel
+
+   Usage : rotary [nbEvents]
+   - Rafales de transitions en quadrature (avec rebonds des contacts) à différentes vitesses, données
+     à Rotary::onPins() comme par l'ISR : le nombre de pas lus doit être le nombre de crans.
+   - Accélération : pas par cran suivant le temps entre 2 crans.
+   - Bouton avec rebonds : un seul appui et un seul relâché.
+   - File sans verrou : une tâche produit (ISR) pendant qu'une autre consomme (loop()), ordre et
+     nombre des événements vérifiés, débordements comptés quand le consommateur est lent.
+   Code de retour non nul en cas d'erreur.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "Rotary.h"
+
+static long nbErrors = 0;
+
+static void check(bool ok, const char *what)
+{
+  if (!ok)
+  {
+    printf("ERROR : %s\n", what);
+    nbErrors++;
+  }
+}
+
+// Pin states (pin2 << 1 | pin1) of one detent from rest (11, pull-ups)
+static const unsigned char cwSeq[4] = { 1, 0, 2, 3 };
+static const unsigned char ccwSeq[4] = { 2, 0, 1, 3 };
+
+// One detent over dt ms, each transition bouncing nbBounces times
+static void detent(Rotary &r, bool cw, unsigned long &ms, int dt, int nbBounces)
+{
+  const unsigned char *seq = cw ? cwSeq : ccwSeq;
+  unsigned char prev = 3;
+  for (int i = 0; i < 4; i++)
+  {
+    for (int b = 0; b < nbBounces; b++)
+    {
+      r.onPins(seq[i], ms);
+      r.onPins(prev, ms);
+    }
+    r.onPins(seq[i], ms);
+    prev = seq[i];
+    ms += dt / 4;
+  }
+  ms += dt % 4;
+}
+
+static int drainSteps(Rotary &r)
+{
+  int steps = 0;
+  RotaryEvent e;
+  while (r.read(e))
+    if (e.type == ROT_EV_TURN)
+      steps += e.steps;
+  return steps;
+}
+
+static void bursts()
+{
+  Rotary r(0, 1);
+  r.accelMax = 1;
+  unsigned long ms = 0;
+  srand(1);
+  long nbDetents = 0, nbSteps = 0;
+  for (int burst = 0; burst < 1000; burst++)
+  {
+    bool cw = rand() & 1;
+    int n = 1 + rand() % 20;      // Detents : less than the queue
+    int dt = rand() % 200;        // ms per detent
+    int bounces = rand() % 4;
+    for (int i = 0; i < n; i++)
+      detent(r, cw, ms, dt, bounces);
+    nbDetents += cw ? n : -n;
+    nbSteps += drainSteps(r);
+    ms += 500;
+  }
+  printf("Bursts : %ld detents, %ld steps read, %lu lost\n", nbDetents, nbSteps, r.queue.lost);
+  check(nbDetents == nbSteps, "steps read != detents");
+  check(r.queue.lost == 0, "events lost");
+
+  // Slow loop() : a burst bigger than the queue, read once
+  unsigned long ms2 = ms;
+  for (int i = 0; i < ROT_QUEUESIZE + 10; i++)
+    detent(r, true, ms2, 5, 0);
+  int steps = drainSteps(r);
+  printf("Burst of %d detents, queue of %d : %d steps read, %lu lost\n", ROT_QUEUESIZE + 10, ROT_QUEUESIZE,
+         steps, r.queue.lost);
+  check((steps == ROT_QUEUESIZE) && (r.queue.lost == 10), "full queue");
+}
+
+static void acceleration()
+{
+  Rotary r(0, 1);
+  unsigned long ms = 0;
+  printf("Acceleration (ms per detent ==> steps) :");
+  static const int dts[] = { 300, 150, 100, 80, 60, 40, 25, 15, 5 };
+  int last = 0;
+  for (int dt : dts)
+  {
+    detent(r, true, ms, dt, 0);
+    detent(r, true, ms, dt, 0);
+    RotaryEvent e;
+    while (r.read(e))
+      last = e.steps;
+    printf(" %d ==> %d", dt, last);
+  }
+  printf("\n");
+  check(last == r.accelMax, "no acceleration");
+
+  // Direction change : no acceleration
+  detent(r, false, ms, 5, 0);
+  check(drainSteps(r) == -1, "acceleration after a direction change");
+}
+
+static void button()
+{
+  Rotary r(0, 1);
+  unsigned long ms = 1000;
+  int nbPress = 0, nbRelease = 0;
+  for (int i = 0; i < 100; i++)
+  {
+    // Bounces within ROT_DEBOUNCE ms, then held, then released with bounces
+    for (int b = 0; b < 5; b++)
+    {
+      r.onButton(true, ms);
+      r.onButton(false, ms + 1);
+      ms += 1;
+    }
+    r.onButton(true, ms);
+    ms += 200;
+    for (int b = 0; b < 5; b++)
+    {
+      r.onButton(false, ms);
+      r.onButton(true, ms + 1);
+      ms += 1;
+    }
+    r.onButton(false, ms);
+    ms += 200;
+    RotaryEvent e;
+    while (r.read(e))
+    {
+      nbPress += e.type == ROT_EV_PRESS;
+      nbRelease += e.type == ROT_EV_RELEASE;
+    }
+  }
+  printf("Button : 100 presses with bounces ==> %d presses, %d releases\n", nbPress, nbRelease);
+  check((nbPress == 100) && (nbRelease == 100), "button bounces");
+}
+
+// 2 threads : the producer pushes numbered events (retries when full), the consumer checks the order
+static void concurrent(long nbEvents)
+{
+  RotaryQueue q;
+  std::atomic<bool> done { false };
+  long retries = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  std::thread producer([&]() {
+    for (long i = 0; i < nbEvents; i++)
+    {
+      RotaryEvent e = { ROT_EV_TURN, 1, (unsigned long) i };
+      while (!q.push(e))
+      {
+        retries++;
+        std::this_thread::yield(); // 1 CPU : let the consumer run
+      }
+    }
+    done = true;
+  });
+  long expected = 0, wrong = 0;
+  RotaryEvent e;
+  for (;;)
+  {
+    if (q.pop(e))
+    {
+      if (e.ms != (unsigned long) expected)
+        wrong++;
+      expected = e.ms + 1;
+    }
+    else if (done && !q.size())
+      break;
+    else
+      std::this_thread::yield();
+  }
+  producer.join();
+  double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+  printf("Concurrent : %ld events, %ld read, %ld out of order, %ld full (%.1f ns / event)\n", nbEvents, expected,
+         wrong, retries, ms * 1e6 / nbEvents);
+  check((expected == nbEvents) && !wrong, "concurrent queue");
+}
+
+int main(int argc, char **argv)
+{
+  long nbEvents = (argc > 1) ? atol(argv[1]) : 1000000;
+  bursts();
+  acceleration();
+  button();
+  concurrent(nbEvents);
+  printf("%ld errors\n", nbErrors);
+  return nbErrors ? 1 : 0;
+}
@@ -0,0 +1,78 @@
+/*
+ F4LAA : Extraction des spots (SpotExtractor) d'un texte ou d'un fichier WAV
+
+   Usage : spots file.wav [freq]   décode le fichier puis extrait les spots
+           spots file.txt          texte déjà décodé
+           spots                   texte sur l'entrée standard
+   Affiche les spots au format série du firmware (SPOT;type;call;to;rst;country),
+   puis le temps moyen d'une recherche de pays.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include "Wav.h"
+#include "HostDecoder.h"
+#include "SpotExtractor.h"
+
+static void printSpot(const Spot &s)
+{
+  printf("SPOT;%s;%s;%s;%s;%s\n", SpotExtractor::typeName(s.type), s.call, s.to, s.rst, s.country);
+}
+
+int main(int argc, char **argv)
+{
+  std::string text;
+  if ((argc > 1) && strstr(argv[1], ".wav"))
+  {
+    Wav wav;
+    if (!readWav(argv[1], wav))
+    {
+      fprintf(stderr, "Can't read %s\n", argv[1]);
+      return 1;
+    }
+    HostDecoderParams hp;
+    if (argc > 2)
+      hp.freq = atof(argv[2]);
+    HostDecoder hd(hp);
+    text = hd.decode(wav.samples, wav.rate);
+    printf("%s\n\n", text.c_str());
+  }
+  else
+  {
+    FILE *f = (argc > 1) ? fopen(argv[1], "r") : stdin;
+    if (!f)
+    {
+      fprintf(stderr, "Can't read %s\n", argv[1]);
+      return 1;
+    }
+    int c;
+    while ((c = fgetc(f)) != EOF)
+      text += (c == '\n' || c == '\r' || c == '\t') ? ' ' : (char) tolower(c);
+    if (f != stdin)
+      fclose(f);
+  }
+
+  SpotExtractor extractor;
+  for (char c : text)
+  {
+    extractor.add(c);
+    for (int i = 0; i < extractor.nbSpots; i++)
+      printSpot(extractor.spots[i]);
+  }
+  extractor.endOfWord();
+  for (int i = 0; i < extractor.nbSpots; i++)
+    printSpot(extractor.spots[i]);
+
+  // Country lookup time
+  const char *calls[] = { "f4laa", "hb9f", "ua9abc", "ea8/f4laa", "kh6xx", "w1aw", "2e0abc", "zz9zz", "9a1aa", "vk2abc" };
+  const int nbLoops = 1000000;
+  size_t sum = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < nbLoops; i++)
+    sum += (size_t) SpotExtractor::country(calls[i % 10]);
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / nbLoops;
+  printf("\ncountry() : %.1f ns per lookup (%s)\n", ns, sum ? "ok" : "");
+  return 0;
+}
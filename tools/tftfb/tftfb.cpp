@@ -0,0 +1,126 @@
+/*
+ F4LAA : Écran du décodeur rendu sur PC par TFT_eSPI (processeur Linux : écran simulé en mémoire RGB565)
+
+   Usage : tftfb [-n nbChars] [-o snap.png|snap.ppm] [-c golden.ppm [-d diff.ppm]]
+   Dessine l'écran de setup() (entête, fréquence, bande passante, bargraph, volume), puis nbChars
+   caractères ajoutés comme par AddCharacter() : la ligne en cours est redessinée à chaque caractère
+   (DisplayLine, le code du firmware : include/DisplayLine.h), 33 caractères par ligne, 10 lignes.
+   Affiche la somme de contrôle de l'image, les octets, transactions et commandes SPI par caractère,
+   le temps sur le bus à SPI_FREQUENCY et le temps PC.
+   -o : image finale ; -c : comparaison avec une image de référence (code de retour 1 si différente),
+   -d : pixels différents en rouge. Référence : tools/tftfb/golden.ppm (330 caractères, par défaut).
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "TFT_eSPI.h"
+#include "DisplayLine.h"
+
+TFT_eSPI tft = TFT_eSPI();
+
+DisplayLine displayLine(tft); // include/DisplayLine.h, as in src/main.cpp
+
+static void drawScreen()
+{
+  tft.init();
+  tft.setRotation(1);
+  tft.fillScreen(TFT_BLACK);
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_ORANGE);
+  tft.setCursor(0, 5);
+  tft.println("CW Decoder V2.0a (03/01/2024) by F4LAA (PlatformIO)             CpuFreq: 240MHz");
+  tft.setTextSize(2);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setCursor(0, 20);
+  tft.print("Freq:");
+  tft.fillRect(60, 20, 48, 20, TFT_BLACK);
+  tft.setCursor(60, 20);
+  tft.print("640");
+  tft.setCursor(120, 20);
+  tft.print("BW:");
+  tft.fillRect(180, 20, 36, 20, TFT_BLACK);
+  tft.setCursor(180, 20);
+  tft.print("28");
+  tft.setCursor(240, 20);
+  tft.print("WPM: 18");
+  tft.fillRect(387, 23, 93, 10, TFT_BLACK);
+  tft.fillRect(387, 23, 60, 10, TFT_GREEN);
+  tft.setCursor(396, 280);
+  tft.print("50%  ");
+  displayLine.clear();
+}
+
+int main(int argc, char **argv)
+{
+  long nbText = 330;
+  const char *outName = 0, *goldenName = 0, *diffName = 0;
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-n") && (i + 1 < argc))
+      nbText = atol(argv[++i]);
+    else if (!strcmp(argv[i], "-o") && (i + 1 < argc))
+      outName = argv[++i];
+    else if (!strcmp(argv[i], "-c") && (i + 1 < argc))
+      goldenName = argv[++i];
+    else if (!strcmp(argv[i], "-d") && (i + 1 < argc))
+      diffName = argv[++i];
+    else
+    {
+      fprintf(stderr, "Usage : tftfb [-n nbChars] [-o snap.png|snap.ppm] [-c golden.ppm [-d diff.ppm]]\n");
+      return 2;
+    }
+  }
+
+  drawScreen();
+  TFT_eSPI_FB::Stats setup = tft_fb.stats;
+  tft_fb.resetStats();
+
+  // Decoded text with pseudo random confidences (always the same image)
+  static const char text[] = "CQ CQ CQ DE F4LAA F4LAA F4LAA PSE K  F5ZSF DE F4LAA GM OM UR RST 599 5NN "
+                             "NAME JEAN QTH RENNES HW? BK  ";
+  uint32_t seed = 1;
+  auto t0 = std::chrono::steady_clock::now();
+  for (long n = 0; n < nbText; n++)
+  {
+    seed = seed * 1103515245 + 12345;
+    uint8_t confidence = 40 + (seed >> 16) % 61;
+    displayLine.add(text[n % (sizeof(text) - 1)], confidence, ".-.");
+    displayLine.draw(TFT_CYAN, ".-.");
+  }
+  double hostUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+  const TFT_eSPI_FB::Stats &s = tft_fb.stats;
+
+  printf("Screen %dx%d, checksum %08x\n", (int) tft_fb.width(), (int) tft_fb.height(), tft_fb.checksum());
+  printf("setup() : %llu bytes, %llu transactions, %llu commands, %.0f us on the bus\n",
+         (unsigned long long) setup.bytesWritten, (unsigned long long) setup.transactions,
+         (unsigned long long) setup.commands, setup.busUs);
+  if (nbText > 0)
+    printf("Per char : %.0f bytes, %.1f transactions, %.1f commands, %.0f pixels, %.0f us on the bus at %d MHz, "
+           "%.1f us on this PC\n",
+           (double) s.bytesWritten / nbText, (double) s.transactions / nbText, (double) s.commands / nbText,
+           (double) s.pixels / nbText, s.busUs / nbText, SPI_FREQUENCY / 1000000, hostUs / nbText);
+
+  if (outName)
+  {
+    size_t len = strlen(outName);
+    bool png = (len > 4) && !strcmp(outName + len - 4, ".png");
+    if (!(png ? tft_fb.savePNG(outName) : tft_fb.savePPM(outName)))
+    {
+      fprintf(stderr, "Cannot write %s\n", outName);
+      return 2;
+    }
+  }
+  if (goldenName)
+  {
+    int32_t nbDiff = tft_fb.comparePPM(goldenName, diffName);
+    if (nbDiff < 0)
+    {
+      fprintf(stderr, "Cannot read %s (PPM %dx%d)\n", goldenName, (int) tft_fb.width(), (int) tft_fb.height());
+      return 2;
+    }
+    printf("%s : %d different pixels\n", goldenName, (int) nbDiff);
+    return nbDiff ? 1 : 0;
+  }
+  return 0;
+}
@@ -0,0 +1,129 @@
+/*
+ F4LAA : Vérification de TimerWheel avec une horloge virtuelle
+
+   Usage : timerwheel [steps]
+   Programme / annule / avance au hasard (délais de 0 à 400 s, passage de 2^32 compris),
+   et compare chaque déclenchement à l'échéance attendue (liste simple de référence).
+   Affiche les erreurs, puis le coût moyen de schedule / cancel / advance par bloc.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include "TimerWheel.h"
+
+#define NBTIMERS 200
+
+struct Check
+{
+  TimerWheel *wheel;
+  int id;
+  uint32_t expected;
+  bool armed;
+  long fired = 0;
+  long errors = 0;
+};
+
+static void onTimer(void *ctx)
+{
+  Check *c = (Check *) ctx;
+  c->fired++;
+  if (!c->armed || (c->wheel->now() != c->expected))
+  {
+    c->errors++;
+    printf("timer %d : fired at %u, expected %u%s\n", c->id, c->wheel->now(), c->expected, c->armed ? "" : " (not armed)");
+  }
+  c->armed = false;
+}
+
+static uint32_t rnd(uint32_t &seed)
+{
+  seed = seed * 1664525 + 1013904223;
+  return seed >> 8;
+}
+
+int main(int argc, char **argv)
+{
+  long steps = (argc > 1) ? atol(argv[1]) : 2000000;
+  TimerWheel wheel;
+  uint32_t now = 0xFFFFFFFFu - 3000000; // Wraps around during the run
+  wheel.start(now);
+
+  std::vector<Check> checks(NBTIMERS);
+  std::vector<Timer> timers(NBTIMERS);
+  for (int i = 0; i < NBTIMERS; i++)
+  {
+    checks[i].wheel = &wheel;
+    checks[i].id = i;
+    checks[i].armed = false;
+    timers[i] = Timer(onTimer, &checks[i]);
+  }
+
+  uint32_t seed = 1;
+  long nbSchedule = 0, nbCancel = 0, nbMissed = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (long s = 0; s < steps; s++)
+  {
+    int i = rnd(seed) % NBTIMERS;
+    int op = rnd(seed) % 4;
+    if (op == 0)
+    {
+      wheel.cancel(timers[i]);
+      checks[i].armed = false;
+      nbCancel++;
+    }
+    else
+    {
+      // Mostly short delays (noise blanker, end of char), some long ones (10 s, 400 s)
+      uint32_t r = rnd(seed) % 100;
+      uint32_t delay = (r < 80) ? rnd(seed) % 300 : ((r < 98) ? rnd(seed) % 10000 : rnd(seed) % 400000);
+      uint32_t expires = now + delay;
+      wheel.schedule(timers[i], expires);
+      checks[i].expected = (delay == 0) ? now + 1 : expires;
+      checks[i].armed = true;
+      nbSchedule++;
+    }
+    // One block : 1 to 20 ms
+    now += 1 + rnd(seed) % 20;
+    wheel.advance(now);
+    for (int k = 0; k < NBTIMERS; k++)
+      if (checks[k].armed && ((int32_t) (now - checks[k].expected) >= 0))
+      {
+        nbMissed++;
+        checks[k].armed = false;
+        printf("timer %d : missed, expected %u, now %u\n", k, checks[k].expected, now);
+      }
+  }
+  double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+
+  long fired = 0, errors = 0;
+  for (Check &c : checks)
+  {
+    fired += c.fired;
+    errors += c.errors;
+  }
+  printf("%ld steps, %ld schedule, %ld cancel, %ld fired : %ld wrong, %ld missed\n",
+         steps, nbSchedule, nbCancel, fired, errors, nbMissed);
+  printf("%.3f us per block (operation + advance + reference check of %d timers)\n", us / steps, NBTIMERS);
+
+  // Cost of the wheel alone : a block with the firmware timers
+  TimerWheel w;
+  w.start(0);
+  Timer blanker, endOfChar, lowSound;
+  auto t1 = std::chrono::steady_clock::now();
+  uint32_t clock = 0;
+  for (long s = 0; s < steps; s++)
+  {
+    clock += 9; // 100 samples at 11025 Hz
+    if ((s % 7) == 0)
+      w.schedule(blanker, clock + 6);
+    if ((s % 11) == 0)
+      w.schedule(endOfChar, clock + 400);
+    if (!lowSound.pending())
+      w.schedule(lowSound, clock + 10001);
+    w.advance(clock);
+  }
+  us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t1).count();
+  printf("%.1f ns per block with the firmware timers\n", 1000 * us / steps);
+  return (errors || nbMissed) ? 1 : 0;
+}
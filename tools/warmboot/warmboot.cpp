@@ -0,0 +1,157 @@
+/*
+ F4LAA : Démarrage à froid / à chaud du décodeur sur un fichier WAV : temps jusqu'au premier caractère
+
+   Usage : warmboot file.wav [freq] [-s setupMs] [-t ms] [-b stepMs] [-n noise] [-m model]
+   Le signal commence à la mise sous tension. Le décodage commence :
+   - à froid : après setup() (setupMs), 1.2s d'attente de Serial et 4s de mesure de la vitesse de l'ADC ;
+   - à chaud : après setup() seulement (vitesse de l'ADC en NVS), sans ou avec l'état verrouillé de la
+     dernière session (WPM et seuil, CWDecoder::warmStart()), pris à la fin d'un premier décodage du fichier.
+   Affiche pour chaque cas le temps du premier caractère (depuis la mise sous tension), le texte décodé
+   pendant les t premières ms et le CER du texte complet contre celui de la dernière session.
+   Puis la mise sous tension au milieu du signal, toutes les stepMs (1700 par défaut) : CER moyen des t
+   premières ms à chaud, sans et avec warmStart(), contre ce que la dernière session a décodé au même moment.
+   -n : bruit blanc ajouté au fichier (écart type, pleine échelle 1). -m : modèle de temps (0 G6EJD par défaut,
+   1 adaptatif).
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "Wav.h"
+#include "Cer.h"
+#include "CWSynth.h"
+#include "HostDecoder.h"
+
+#define COLD_WAIT (1200 + 4000) // delay() for Serial, then the measure of the ADC rate
+
+struct BootRun
+{
+  long firstChar = -1; // ms since power on
+  std::string text;
+  std::vector<unsigned long> times; // ms, of each character of text
+  std::string early;   // Decoded before the t first ms
+  int wpm = 0;
+  int limit = 0;       // magnitudelimit when the last character was decoded
+};
+
+static int model = TIMING_G6EJD;
+
+static BootRun run(const std::vector<HostBlock> &blocks, unsigned long boot, int wpm, int limit, unsigned long earlyMs)
+{
+  BootRun r;
+  CWDecoder decoder;
+  decoder.model = model;
+  decoder.warmStart(wpm, limit);
+  unsigned long last = 0;
+  auto collect = [&](unsigned long now) {
+    for (int i = 0; i < decoder.nbDecoded; i++)
+    {
+      char c = decoder.decoded[i].c;
+      if ((r.firstChar < 0) && (c != ' '))
+        r.firstChar = now;
+      r.text += c;
+      r.times.push_back(now);
+      if (now < earlyMs)
+        r.early += c;
+      r.limit = decoder.magnitudelimit;
+    }
+  };
+  for (const HostBlock &b : blocks)
+  {
+    if (b.now < boot)
+      continue; // Still in setup()
+    decoder.process(b.magnitude, b.now);
+    collect(b.now);
+    last = b.now;
+  }
+  r.wpm = decoder.wpm;
+  for (unsigned long now = last; now < last + HOST_TAILSILENCE; now += 10)
+  {
+    decoder.process(0, now);
+    collect(now);
+  }
+  return r;
+}
+
+// Characters of r decoded in ]from, to[
+static std::string between(const BootRun &r, unsigned long from, unsigned long to)
+{
+  std::string s;
+  for (size_t i = 0; i < r.text.size(); i++)
+    if ((r.times[i] > from) && (r.times[i] < to))
+      s += r.text[i];
+  return s;
+}
+
+static void print(const char *name, const BootRun &r, const std::string &reference)
+{
+  printf("%-16s first char %6ld ms  CER %5.1f %%  | %s\n", name, r.firstChar, 100 * cer(reference, r.text),
+         r.early.c_str());
+}
+
+int main(int argc, char **argv)
+{
+  const char *wavName = 0;
+  float freq = 640;
+  unsigned long setupMs = 300, earlyMs = 10000, stepMs = 1700;
+  float noise = 0;
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-s") && (i + 1 < argc))
+      setupMs = atol(argv[++i]);
+    else if (!strcmp(argv[i], "-t") && (i + 1 < argc))
+      earlyMs = atol(argv[++i]);
+    else if (!strcmp(argv[i], "-b") && (i + 1 < argc))
+      stepMs = atol(argv[++i]);
+    else if (!strcmp(argv[i], "-n") && (i + 1 < argc))
+      noise = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-m") && (i + 1 < argc))
+      model = atoi(argv[++i]);
+    else if (!wavName)
+      wavName = argv[i];
+    else
+      freq = atof(argv[i]);
+  }
+  Wav wav;
+  if (!wavName || !readWav(wavName, wav))
+  {
+    fprintf(stderr, "Usage : warmboot file.wav [freq] [-s setupMs] [-t ms] [-b stepMs] [-n noise] [-m model]\n");
+    return 1;
+  }
+  CWNoise rnd;
+  for (float &x : wav.samples)
+    x += noise * rnd.gauss();
+  HostDecoderParams hp;
+  hp.freq = freq;
+  hp.model = model;
+  HostDecoder hd(hp);
+  std::vector<HostBlock> blocks = hd.blocks(wav.samples, wav.rate);
+
+  // Last session : the whole file, its speed and threshold are saved
+  BootRun last = run(blocks, 0, 0, 0, earlyMs);
+  printf("Last session : %d WPM, magnitudelimit %d\n", last.wpm, last.limit);
+  printf("Decoded text in the first %lu ms after power on :\n", earlyMs);
+
+  BootRun cold = run(blocks, setupMs + COLD_WAIT, 0, 0, earlyMs);
+  BootRun warmRate = run(blocks, setupMs, 0, 0, earlyMs);
+  BootRun warmLock = run(blocks, setupMs, last.wpm, last.limit, earlyMs);
+  print("cold", cold, last.text);
+  print("warm (rate)", warmRate, last.text);
+  print("warm (rate+lock)", warmLock, last.text);
+
+  // Power on while the signal is on the air : the speed is not learnt on the first marks any more
+  double sumRate = 0, sumLock = 0;
+  int nbBoots = 0;
+  for (unsigned long boot = setupMs; blocks.size() && (boot + earlyMs < blocks.back().now); boot += stepMs)
+  {
+    std::string reference = between(last, boot, boot + earlyMs);
+    sumRate += cer(reference, between(run(blocks, boot, 0, 0, earlyMs), boot, boot + earlyMs));
+    sumLock += cer(reference, between(run(blocks, boot, last.wpm, last.limit, earlyMs), boot, boot + earlyMs));
+    nbBoots++;
+  }
+  if (nbBoots)
+    printf("Power on during the signal (%d boots, every %lu ms), CER of the first %lu ms : warm (rate) %5.1f %%  "
+           "warm (rate+lock) %5.1f %%\n", nbBoots, stepMs, earlyMs, 100 * sumRate / nbBoots, 100 * sumLock / nbBoots);
+  return 0;
+}